@@ -47,7 +47,12 @@
 
 #include <vortex_alive.h>
 
-#define VORTEX_ALIVE_CHECK_ENABLED "vo:co:al"
+/* name of the connection slot holding the alive check state */
+#define VORTEX_ALIVE_CHECK_ENABLED "vortex-alive:check"
+
+/* connection slot registered by vortex_alive_init and
+ * vortex_alive_enable_check */
+static int __vortex_alive_slot = -1;
 
 typedef struct _VortexAliveData {
 	long                 check_period;
@@ -156,6 +161,9 @@ void vortex_alive_frame_received (VortexChannel    * channel,
  */
 axl_bool           vortex_alive_init                       (VortexCtx * ctx)
 {
+	/* register connection slot */
+	__vortex_alive_slot = vortex_connection_slot_register (VORTEX_ALIVE_CHECK_ENABLED);
+
 	/* register profile */
 	vortex_profiles_register (ctx,
 				  VORTEX_ALIVE_PROFILE_URI,
@@ -300,7 +308,7 @@ void __vortex_alive_channel_created (int                channel_num,
 	int                iterator;
 	VortexCtx        * ctx  = CONN_CTX (conn);
 
-	if (data->conn == NULL || data->event_id == -1 || vortex_connection_get_data (conn, VORTEX_ALIVE_CHECK_ENABLED) == NULL) {
+	if (data->conn == NULL || data->event_id == -1 || vortex_connection_get_slot (conn, __vortex_alive_slot) == NULL) {
 		vortex_log (VORTEX_LEVEL_WARNING, "received channel alive created after perioed was expired for conn-id=%d",
 			    vortex_connection_get_id (conn));
 		return;
@@ -496,8 +504,17 @@ axl_bool           vortex_alive_enable_check               (VortexConnection * c
 		return axl_false;
 	}
 
+	/* register connection slot (alive check may be enabled
+	 * without calling vortex_alive_init) */
+	if (__vortex_alive_slot == -1)
+		__vortex_alive_slot = vortex_connection_slot_register (VORTEX_ALIVE_CHECK_ENABLED);
+	if (__vortex_alive_slot == -1) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to register alive connection slot, unable to enable alive check");
+		return axl_false;
+	} /* end if */
+
 	/* check if the connection is already checked */
-	if (PTR_TO_INT (vortex_connection_get_data (conn, VORTEX_ALIVE_CHECK_ENABLED))) {
+	if (vortex_connection_get_slot (conn, __vortex_alive_slot)) {
 		vortex_log (VORTEX_LEVEL_WARNING, "Calling to enable connection alive check where it is already enabled");
 		return axl_false;
 	} /* end if */
@@ -530,7 +547,7 @@ axl_bool           vortex_alive_enable_check               (VortexConnection * c
 	}
 
 	/* create data */
-	vortex_connection_set_data_full (conn, VORTEX_ALIVE_CHECK_ENABLED, data, NULL, __vortex_alive_free);
+	vortex_connection_set_slot (conn, __vortex_alive_slot, data, __vortex_alive_free);
 	
 	/* also configure connection close to detect and react */
 	vortex_connection_set_on_close_full (conn, __vortex_alive_connection_closed, data);
@@ -435,6 +435,72 @@ axl_bool       vortex_conf_get             (VortexCtx      * ctx,
 	case VORTEX_SKIP_THREAD_POOL_WAIT:
 		*value = ctx->skip_thread_pool_wait;
 		return axl_true;
+	case VORTEX_READER_THREADS:
+		/* return reader threads to be used */
+		*value = ctx->reader_threads > 1 ? ctx->reader_threads : 1;
+		return axl_true;
+	case VORTEX_SEQUENCER_FLUSH_SIZE:
+		/* return max bytes joined by the sequencer */
+		*value = ctx->sequencer_flush_size;
+		return axl_true;
+	case VORTEX_SEQUENCER_FLUSH_LATENCY:
+		/* return max time joined frames may wait */
+		*value = ctx->sequencer_flush_latency;
+		return axl_true;
+	case VORTEX_ASYNC_WRITES:
+		/* return if asynchronous writes are enabled */
+		*value = ctx->async_writes;
+		return axl_true;
+	case VORTEX_OUTPUT_HIGH_WATER_MARK:
+		/* return output queued limit */
+		*value = ctx->output_high_water_mark;
+		return axl_true;
+	case VORTEX_SEQUENCER_THREADS:
+		/* return sequencer threads to be used */
+		*value = ctx->sequencer_threads > 1 ? ctx->sequencer_threads : 1;
+		return axl_true;
+	case VORTEX_FRAME_POOL_LIMIT:
+		/* return items cached by the frame pool */
+		*value = ctx->frame_pool_limit;
+		return axl_true;
+	case VORTEX_READER_FRAME_BUDGET:
+		/* return max frames processed per connection and round */
+		*value = ctx->reader_frame_budget;
+		return axl_true;
+	case VORTEX_THREAD_POOL_WORK_STEALING:
+		/* return if the thread pool uses work stealing */
+		*value = ctx->thread_pool_work_stealing;
+		return axl_true;
+	case VORTEX_THREAD_POOL_CPU_AFFINITY:
+		/* return if thread pool threads are bound to a CPU */
+		*value = ctx->thread_pool_cpu_affinity;
+		return axl_true;
+	case VORTEX_LISTENER_REUSEPORT:
+		/* return listening sockets opened per listener */
+		*value = ctx->listener_reuseport;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE:
+		/* return if channel windows are autotuned */
+		*value = ctx->channel_autotune;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MAX_WINDOW:
+		/* return max window reached by autotuning */
+		*value = ctx->channel_autotune_max_window;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MEMORY:
+		/* return max memory windows can grow */
+		*value = ctx->channel_autotune_memory;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MAX_FRAME_SIZE:
+		/* return max frame size sent with autotuning */
+		*value = ctx->channel_autotune_max_frame_size;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_USED:
+		/* return memory currently reserved by windows grown */
+		vortex_mutex_lock (&ctx->channel_autotune_mutex);
+		*value = ctx->channel_autotune_used;
+		vortex_mutex_unlock (&ctx->channel_autotune_mutex);
+		return axl_true;
 	default:
 		/* configuration found, return axl_false */
 		vortex_log (VORTEX_LEVEL_CRITICAL, "found a requested for a non existent configuration item");
@@ -444,6 +510,29 @@ axl_bool       vortex_conf_get             (VortexCtx      * ctx,
 	return axl_true;
 }
 
+/** 
+ * @internal Returns if the provided configuration item accepts 0 as
+ * value (to disable the feature it configures).
+ */
+axl_bool __vortex_conf_accepts_zero (VortexConfItem item)
+{
+	switch (item) {
+	case VORTEX_SEQUENCER_FLUSH_SIZE:
+	case VORTEX_SEQUENCER_FLUSH_LATENCY:
+	case VORTEX_ASYNC_WRITES:
+	case VORTEX_OUTPUT_HIGH_WATER_MARK:
+	case VORTEX_FRAME_POOL_LIMIT:
+	case VORTEX_READER_FRAME_BUDGET:
+	case VORTEX_THREAD_POOL_WORK_STEALING:
+	case VORTEX_THREAD_POOL_CPU_AFFINITY:
+	case VORTEX_LISTENER_REUSEPORT:
+	case VORTEX_CHANNEL_AUTOTUNE:
+		return axl_true;
+	default:
+		return axl_false;
+	} /* end switch */
+}
+
 /** 
  * @brief Allows to configure the provided item, with either the
  * integer or the string value, according to the item configuration
@@ -471,9 +560,10 @@ axl_bool       vortex_conf_set             (VortexCtx      * ctx,
 	/* variables for nix world */
 	struct rlimit _limit;
 #endif	
-	/* do common check */
+	/* do common check (0 is only accepted by items where it
+	 * disables the feature configured) */
 	v_return_val_if_fail (ctx,   axl_false);
-	v_return_val_if_fail (value, axl_false);
+	v_return_val_if_fail (value || __vortex_conf_accepts_zero (item), axl_false);
 
 #if defined (AXL_OS_WIN32)
 #elif defined(AXL_OS_UNIX)
@@ -555,6 +645,81 @@ axl_bool       vortex_conf_set             (VortexCtx      * ctx,
 	case VORTEX_SKIP_THREAD_POOL_WAIT:
 		ctx->skip_thread_pool_wait = value;
 		return axl_true;
+	case VORTEX_READER_THREADS:
+		/* configure reader threads (used at next
+		 * vortex_init_ctx) */
+		ctx->reader_threads = value;
+		return axl_true;
+	case VORTEX_SEQUENCER_FLUSH_SIZE:
+		/* configure max bytes joined by the sequencer (0
+		 * disables write batching) */
+		ctx->sequencer_flush_size = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_SEQUENCER_FLUSH_LATENCY:
+		/* configure max time joined frames may wait */
+		ctx->sequencer_flush_latency = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_ASYNC_WRITES:
+		/* configure asynchronous writes (used at next
+		 * vortex_init_ctx) */
+		ctx->async_writes = value;
+		return axl_true;
+	case VORTEX_OUTPUT_HIGH_WATER_MARK:
+		/* configure output queued limit */
+		ctx->output_high_water_mark = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_SEQUENCER_THREADS:
+		/* configure sequencer threads (used at next
+		 * vortex_init_ctx) */
+		ctx->sequencer_threads = value;
+		return axl_true;
+	case VORTEX_FRAME_POOL_LIMIT:
+		/* configure items cached by the frame pool (items
+		 * already cached are kept until reused) */
+		ctx->frame_pool_limit = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_READER_FRAME_BUDGET:
+		/* configure max frames processed per connection and
+		 * round (0 removes the limit) */
+		ctx->reader_frame_budget = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_THREAD_POOL_WORK_STEALING:
+		/* configure work stealing (used at next
+		 * vortex_init_ctx) */
+		ctx->thread_pool_work_stealing = value;
+		return axl_true;
+	case VORTEX_THREAD_POOL_CPU_AFFINITY:
+		/* configure CPU affinity (used at next
+		 * vortex_init_ctx) */
+		ctx->thread_pool_cpu_affinity = value;
+		return axl_true;
+	case VORTEX_LISTENER_REUSEPORT:
+		/* configure listening sockets opened per listener
+		 * (used by next listeners created) */
+		ctx->listener_reuseport = value > 0 ? value : 0;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE:
+		/* configure window and frame size autotuning (used
+		 * by channels from now on) */
+		ctx->channel_autotune = value;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MAX_WINDOW:
+		/* configure max window reached by autotuning */
+		ctx->channel_autotune_max_window = value;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MEMORY:
+		/* configure max memory windows can grow (windows
+		 * already grown are kept) */
+		ctx->channel_autotune_memory = value;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_MAX_FRAME_SIZE:
+		/* configure max frame size sent with autotuning */
+		ctx->channel_autotune_max_frame_size = value;
+		return axl_true;
+	case VORTEX_CHANNEL_AUTOTUNE_USED:
+		/* read only value */
+		vortex_log (VORTEX_LEVEL_CRITICAL, "VORTEX_CHANNEL_AUTOTUNE_USED can't be configured");
+		return axl_false;
 	default:
 		/* configuration found, return axl_false */
 		vortex_log (VORTEX_LEVEL_CRITICAL, "found a requested for a non existent configuration item");
@@ -980,8 +1145,6 @@ axl_bool    vortex_init_ctx (VortexCtx * ctx)
 	vortex_io_init (ctx);
 
 	/**** vortex.c: init global mutex *****/
-	vortex_mutex_create (&ctx->frame_id_mutex);
-	vortex_mutex_create (&ctx->connection_id_mutex);
 	vortex_mutex_create (&ctx->listener_mutex);
 	vortex_mutex_create (&ctx->listener_unlock);
 	vortex_mutex_create (&ctx->exit_mutex);
@@ -1234,8 +1397,6 @@ void vortex_exit_ctx (VortexCtx * ctx, axl_bool  free_ctx)
 	vortex_greetings_cleanup (ctx);
 
 	/* destroy global mutex */
-	vortex_mutex_destroy (&ctx->frame_id_mutex);
-	vortex_mutex_destroy (&ctx->connection_id_mutex);
 	vortex_mutex_destroy (&ctx->listener_mutex);
 	vortex_mutex_destroy (&ctx->listener_unlock);
 	vortex_mutex_destroy (&ctx->profiles_list_mutex);
@@ -3726,8 +3887,8 @@ axl_bool vortex_is_exiting           (VortexCtx * ctx)
  *
  * This method also requires that \ref VortexOnFrameReceived "frame received" 
  * activation to be serialized because you have to place all
- * pieces received in other. This is archived by using \ref
- * vortex_channel_set_serialize.
+ * pieces received in other. This is the default channel behaviour
+ * (see \ref vortex_channel_set_serialize).
  *
  * This method is more difficult but results are better. The same
  * happens to the following method.
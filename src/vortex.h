@@ -157,6 +157,7 @@
 #include <fcntl.h>
 #include <netdb.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <sys/select.h>
@@ -557,7 +558,239 @@ typedef enum {
 	 * vortex_conf_set (ctx, VORTEX_SKIP_THREAD_POOL_WAIT, axl_true, NULL);
 	 * \endcode
 	 */
-	VORTEX_SKIP_THREAD_POOL_WAIT = 6
+	VORTEX_SKIP_THREAD_POOL_WAIT = 6,
+	/** 
+	 * @brief Allows to configure the number of threads used by
+	 * the vortex reader to watch connections (by default 1).
+	 *
+	 * When more than one thread is configured, connections are
+	 * spread among reader threads (by connection id), each one
+	 * with its own I/O waiting set, so frames received on
+	 * different connections can be read and dispatched in
+	 * parallel. Listeners are always watched by the first
+	 * reader thread.
+	 *
+	 * The value must be configured before calling \ref
+	 * vortex_init_ctx, for example:
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_READER_THREADS, 4, NULL);
+	 * \endcode
+	 */
+	VORTEX_READER_THREADS = 7,
+	/** 
+	 * @brief Allows to configure the max amount of bytes (by
+	 * default 65536) the sequencer joins before writing them
+	 * into a connection.
+	 *
+	 * Frames built by the sequencer for the same connection
+	 * (for example, small replies sent over several channels)
+	 * are joined and written with a single send operation.
+	 * Frames larger than this value are written directly. Use 0
+	 * to disable write batching (each frame is written as soon
+	 * as it is built):
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_SEQUENCER_FLUSH_SIZE, 0, NULL);
+	 * \endcode
+	 */
+	VORTEX_SEQUENCER_FLUSH_SIZE = 8,
+	/** 
+	 * @brief Allows to configure the max amount of time
+	 * (microseconds) frames joined by the sequencer may wait
+	 * before being written (by default 0).
+	 *
+	 * With 0, frames joined are written at the end of each
+	 * sequencer round. Otherwise, frames joined for a connection
+	 * may wait (while there is more content to be sequenced) up
+	 * to the provided time or until \ref
+	 * VORTEX_SEQUENCER_FLUSH_SIZE bytes are joined. In any case,
+	 * pending frames are written before the sequencer waits for
+	 * new content.
+	 */
+	VORTEX_SEQUENCER_FLUSH_LATENCY = 9,
+	/** 
+	 * @brief Allows to enable asynchronous writes (by default
+	 * disabled).
+	 *
+	 * By default, when a socket is not ready to accept more
+	 * content, the thread writing (usually the sequencer) waits
+	 * until it is, which delays content to be sent to other
+	 * connections. With asynchronous writes enabled, content
+	 * that can't be written is queued on the connection and
+	 * written by an output thread once the socket becomes
+	 * writable. See also \ref VORTEX_OUTPUT_HIGH_WATER_MARK.
+	 *
+	 * Only connections using the default send handler are
+	 * written asynchronously (for example, TLS connections keep
+	 * on using blocking writes). The value must be configured
+	 * before calling \ref vortex_init_ctx:
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_ASYNC_WRITES, axl_true, NULL);
+	 * \endcode
+	 */
+	VORTEX_ASYNC_WRITES = 10,
+	/** 
+	 * @brief Allows to configure the amount of bytes queued on a
+	 * connection (asynchronous writes) after which the sequencer
+	 * stops sending on its channels until queued content is
+	 * written (by default 1048576). Use 0 to disable the limit.
+	 *
+	 * Content sent by channels affected is kept on their pending
+	 * queues as if they were stalled.
+	 */
+	VORTEX_OUTPUT_HIGH_WATER_MARK = 11,
+	/** 
+	 * @brief Allows to configure the number of threads used by
+	 * the vortex sequencer to build and write frames (by default
+	 * 1).
+	 *
+	 * When more than one thread is configured, connections are
+	 * spread among sequencer threads (by connection id) so
+	 * content sent over different connections is framed and
+	 * written in parallel, while content sent over the same
+	 * connection keeps on being handled, in order, by the same
+	 * thread.
+	 *
+	 * The value must be configured before calling \ref
+	 * vortex_init_ctx, for example:
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_SEQUENCER_THREADS, 4, NULL);
+	 * \endcode
+	 */
+	VORTEX_SEQUENCER_THREADS = 12,
+	/** 
+	 * @brief Allows to configure how many frames and payload
+	 * buffers (for each size class) are kept by the context to
+	 * be reused once released (by default 256).
+	 *
+	 * Frames received are allocated from this pool and returned
+	 * to it when \ref vortex_frame_unref releases them, avoiding
+	 * a malloc/free pair per frame. Use 0 to disable the
+	 * pool. See \ref vortex_frame_pool_stats.
+	 */
+	VORTEX_FRAME_POOL_LIMIT = 13,
+	/** 
+	 * @brief Allows to configure the max number of frames the
+	 * vortex reader processes from a connection each time it is
+	 * found ready (by default 64).
+	 *
+	 * The reader keeps on reading and dispatching frames from a
+	 * connection until the socket has no more content. Once this
+	 * amount of frames is reached, the rest is processed after
+	 * serving other connections, so a peer sending a long burst
+	 * can't delay the rest. Use 0 to remove the limit.
+	 */
+	VORTEX_READER_FRAME_BUDGET = 14,
+	/** 
+	 * @brief Allows to configure the thread pool to use per
+	 * thread task queues with work stealing (by default 0,
+	 * disabled).
+	 *
+	 * By default, all threads in the pool take their tasks from
+	 * a single shared queue. With this option enabled, each
+	 * thread owns its own queue, new tasks are spread among
+	 * them, and idle threads steal tasks from busy ones, which
+	 * removes the contention found on the shared queue when many
+	 * threads process small tasks. \ref vortex_thread_pool_stats
+	 * and automatic resize (\ref vortex_thread_pool_setup2)
+	 * behave the same. The value is used at the next \ref
+	 * vortex_init_ctx:
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_THREAD_POOL_WORK_STEALING, 1, NULL);
+	 * \endcode
+	 */
+	VORTEX_THREAD_POOL_WORK_STEALING = 15,
+	/** 
+	 * @brief Allows to configure the thread pool to bind each
+	 * thread to a CPU (thread N is bound to CPU N modulo the
+	 * number of CPUs available). By default 0, disabled. Only
+	 * applies when \ref VORTEX_THREAD_POOL_WORK_STEALING is
+	 * enabled. The value is used at the next \ref
+	 * vortex_init_ctx.
+	 */
+	VORTEX_THREAD_POOL_CPU_AFFINITY = 16,
+	/** 
+	 * @brief Allows to configure the number of listening sockets
+	 * opened for each listener created (by default 0, only one
+	 * socket).
+	 *
+	 * When a value greater than 1 is configured, listeners
+	 * created with \ref vortex_listener_new (and its variants)
+	 * open that many sockets bound to the same host:port using
+	 * SO_REUSEPORT, so the kernel spreads incoming connections
+	 * among them. Each socket is watched by a different reader
+	 * thread (see \ref VORTEX_READER_THREADS), so accepting is
+	 * done in parallel. Connections accepted on any of them
+	 * report the listener returned as their master listener, and
+	 * closing it closes all sockets. On platforms without
+	 * SO_REUSEPORT only one socket is opened.
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_LISTENER_REUSEPORT, 4, NULL);
+	 * \endcode
+	 */
+	VORTEX_LISTENER_REUSEPORT = 17,
+	/** 
+	 * @brief Allows to enable flow control window and frame size
+	 * autotuning for channels (by default 0, disabled).
+	 *
+	 * Channels start with a 4096 bytes window and send frames of
+	 * up to 4096 bytes, so bulk transfers over links with high
+	 * latency are limited to one window per round trip. With
+	 * autotuning enabled, each channel (but channel 0) measures
+	 * the round trip time (from the SEQ frame sent to the first
+	 * content received beyond the previous window) and the bytes
+	 * received per round trip. While the remote peer fills most
+	 * of the window each round trip, the window advertised
+	 * (desired window size, see \ref vortex_channel_set_window_size)
+	 * grows to twice that amount, up to \ref
+	 * VORTEX_CHANNEL_AUTOTUNE_MAX_WINDOW and while the memory
+	 * reserved by all channels is under \ref
+	 * VORTEX_CHANNEL_AUTOTUNE_MEMORY. Windows are never reduced.
+	 *
+	 * Frames sent are also allowed to grow with the window
+	 * advertised by the remote peer (a quarter of it) up to \ref
+	 * VORTEX_CHANNEL_AUTOTUNE_MAX_FRAME_SIZE. Channels with a
+	 * frame size handler configured (\ref
+	 * vortex_channel_set_next_frame_size_handler) keep on using
+	 * it.
+	 *
+	 * \code
+	 * vortex_conf_set (ctx, VORTEX_CHANNEL_AUTOTUNE, axl_true, NULL);
+	 * \endcode
+	 */
+	VORTEX_CHANNEL_AUTOTUNE = 18,
+	/** 
+	 * @brief Allows to configure the max window size a channel
+	 * can reach with autotuning (by default 4194304). See \ref
+	 * VORTEX_CHANNEL_AUTOTUNE.
+	 */
+	VORTEX_CHANNEL_AUTOTUNE_MAX_WINDOW = 19,
+	/** 
+	 * @brief Allows to configure the max amount of bytes all
+	 * channels of the context can grow their windows, with
+	 * autotuning, beyond the size they had (by default
+	 * 67108864). Once reached, windows stop growing until other
+	 * channels are released. See \ref VORTEX_CHANNEL_AUTOTUNE.
+	 */
+	VORTEX_CHANNEL_AUTOTUNE_MEMORY = 20,
+	/** 
+	 * @brief Allows to configure the max frame size (payload)
+	 * sent with autotuning (by default 65536). See \ref
+	 * VORTEX_CHANNEL_AUTOTUNE.
+	 */
+	VORTEX_CHANNEL_AUTOTUNE_MAX_FRAME_SIZE = 21,
+	/** 
+	 * @brief Allows to get the amount of bytes channel windows of
+	 * the context have currently grown with autotuning (counted
+	 * against \ref VORTEX_CHANNEL_AUTOTUNE_MEMORY and released
+	 * when channels are freed). This item can't be configured.
+	 */
+	VORTEX_CHANNEL_AUTOTUNE_USED = 22
 } VortexConfItem;
 
 axl_bool  vortex_conf_get             (VortexCtx      * ctx,
@@ -44,6 +44,12 @@
 #define VORTEX_CHANNEL_WAIT_REPLY           "ch:wa:rp"
 #define VORTEX_CHANNEL_CLOSE_HANDLER_CALLED "ch:co:ha:ca"
 
+/** 
+ * @internal Max number of frames delivered by a channel delivery
+ * task before yielding the thread to other pending tasks.
+ */
+#define VORTEX_CHANNEL_DELIVERY_BATCH 64
+
 #include <vortex_channel.h>
 
 /* local include */
@@ -202,6 +208,23 @@ struct _VortexChannel {
 	 * window_size. The actual window_size will not be adjusted until
 	 * the current window fills up and a new SEQ frame is sent. */
 	int                     desired_window_size;
+
+	/* window autotuning (see VORTEX_CHANNEL_AUTOTUNE)
+	 *
+	 * tune_seqno and tune_stamp record the first seqno beyond
+	 * the window advertised before the last SEQ frame sent and
+	 * when it was sent: content received beyond that seqno
+	 * provides a round trip time sample (tune_rtt keeps the min
+	 * value found, in microseconds). tune_bytes counts bytes
+	 * received since tune_round, and tune_reserved the bytes the
+	 * window has grown (reserved from the context). */
+	axl_bool                tune_measuring;
+	unsigned int            tune_seqno;
+	struct timeval          tune_stamp;
+	long                    tune_rtt;
+	int                     tune_bytes;
+	struct timeval          tune_round;
+	int                     tune_reserved;
 	
 	axl_bool                complete_flag;
 	int                     complete_frame_limit;
@@ -345,16 +368,24 @@ struct _VortexChannel {
 	VortexCond             pending_cond;
 
 	/** 
-	 * @internal Allows to serialize replies received on frame
-	 * received for a particular channel. Because frame delivery
-	 * is done using threads by default, this could be required to
-	 * enforce a serial deliver order when frames are acknoledge
-	 * on second level handlers.
+	 * @internal Serialize (ordered) delivery for frames received
+	 * on this channel (enabled by default). Frames to be notified
+	 * are stored in order into the delivery ring (delivery_frames)
+	 * and a single thread pool task (delivery_scheduled) drains
+	 * it, invoking the frame received handler for each frame, so
+	 * delivery order is kept and no task is created per frame.
+	 * The task holds a reference to the channel and to the
+	 * connection (delivery_conn) until the ring is drained. All
+	 * delivery_* fields are protected by delivery_mutex.
 	 */
-	VortexMutex            serialize_mutex;
 	axl_bool               serialize;
-	axlHash              * serialize_hash;
-	unsigned int           serialize_next_seqno;
+	VortexMutex            delivery_mutex;
+	VortexFrame         ** delivery_frames;
+	int                    delivery_size;
+	int                    delivery_head;
+	int                    delivery_count;
+	axl_bool               delivery_scheduled;
+	VortexConnection     * delivery_conn;
 
 	/* the pool
 	 *
@@ -1615,9 +1646,8 @@ VortexChannel * vortex_channel_empty_new (int                channel_num,
 	vortex_cond_create  (&channel->pending_cond);
 	vortex_mutex_create (&channel->ref_mutex);
 	channel->ref_count                      = 1; /* one reference */
-	vortex_mutex_create (&channel->serialize_mutex);
-	channel->serialize                      = axl_false;
-	channel->serialize_next_seqno           = 0;
+	vortex_mutex_create (&channel->delivery_mutex);
+	channel->serialize                      = axl_true;
 	channel->waiting_replies                = axl_false;
 	channel->data                           = vortex_hash_new_full (axl_hash_string, axl_hash_equal_string, NULL, NULL);
 	channel->stored_replies                 = axl_hash_new (axl_hash_int, axl_hash_equal_int);
@@ -2390,46 +2420,54 @@ axl_bool vortex_channel_check_msg_no_find_item_outgoing (VortexCtx * ctx, Vortex
 }
 
 /** 
- * @internal
- * @brief Common function support other function to send message.
- * 
- * @param channel the channel where the message will be sent.
- * @param message the message to be sent.
- * @param message_size the message size.
+ * @internal Prepares the content hold by the provided sequencer data
+ * to reference the caller buffer (without copying it), placing MIME
+ * headers configured (if any) on its own buffer.
  *
- * @param proposed_msg_no The message number to be used for the next
- * send operation. If not defined (-1) vortex will allocate
- * automatically a new one.
- *
- * @param msg_no message number reference used for this message
- * sending attempt.
- *
- * @param wait_reply optional wait reply to implement Wait Reply
- * method.
- *
- * @param feeder optional content feeder used to send the message. If
- * this value is defined, message and message_size paramter is ignored
- * but the caller still have to define message_size (the total amount
- * of bytes that will be feeded).
- *
- * @param fixed_more Allows to signal if more flag should be enabled
- * on this send operation. Note that, unlike \ref
- * vortex_channel_send_rpy_more and \ref
- * vortex_channel_send_rpy_error, this function will make the next
- * operation to close or continue the send operation (because the
- * function must reuse MSG numbers to put together all the content
- * into a single, though fragmented, content).
- * 
- * @return axl_true if channel was sent or axl_false if not.
+ * @return axl_true if the data was prepared, otherwise axl_false is
+ * returned (memory allocation failure).
  */
-axl_bool    vortex_channel_send_msg_common (VortexChannel       * channel,
-					    const void          * message,
-					    size_t                message_size,
-					    int                   proposed_msg_no, 
-					    int                 * msg_no,
-					    WaitReplyData       * wait_reply,
-					    VortexPayloadFeeder * feeder,
-					    axl_bool              fixed_more)
+axl_bool __vortex_channel_prepare_nocopy (VortexChannel       * channel,
+					  VortexSequencerData * data,
+					  const void          * message,
+					  int                   mime_header_size,
+					  axlDestroyFunc        release)
+{
+	data->no_copy           = axl_true;
+	data->release           = release;
+	data->message           = (char *) message;
+	data->mime_headers_size = mime_header_size;
+
+	if (mime_header_size > 0) {
+		data->mime_headers = axl_new (char, mime_header_size + 1);
+		if (data->mime_headers == NULL) {
+			/* do not release caller buffer, caller still
+			 * owns it because the operation failed */
+			data->message = NULL;
+			return axl_false;
+		} /* end if */
+		__vortex_channel_get_mime_headers (channel, data->mime_headers);
+	} /* end if */
+
+	return axl_true;
+}
+
+/** 
+ * @internal Full version of \ref vortex_channel_send_msg_common
+ * which also allows to send the message without copying it (no_copy),
+ * calling release (if defined) once the content is no longer
+ * required.
+ */
+axl_bool    __vortex_channel_send_msg_common_full (VortexChannel       * channel,
+						   const void          * message,
+						   size_t                message_size,
+						   int                   proposed_msg_no, 
+						   int                 * msg_no,
+						   WaitReplyData       * wait_reply,
+						   VortexPayloadFeeder * feeder,
+						   axl_bool              fixed_more,
+						   axl_bool              no_copy,
+						   axlDestroyFunc        release)
 {
 	VortexSequencerData * data;
 	int                   mime_header_size;
@@ -2533,27 +2571,42 @@ check_limit:
 			    data->type, data->channel_num, data->msg_no, proposed_msg_no,
 			    data->message_size, (int) message_size, (int) mime_header_size);
 
-		/* copy mime headers according to channel configuration, that
-		 * comes from profile configuration. */
-		data->message = axl_new (char , data->message_size + 1);
-		/* check alloc operation */
-		if (data->message == NULL) {
-			axl_free (data);
-			/* unlock send mutex */
-			vortex_mutex_unlock (&channel->send_mutex);
+		if (no_copy) {
+			/* reference caller content and place mime
+			 * headers apart */
+			if (! __vortex_channel_prepare_nocopy (channel, data, message, mime_header_size, release)) {
+				axl_free (data);
+				/* unlock send mutex */
+				vortex_mutex_unlock (&channel->send_mutex);
 
-			/* release channel */
-			vortex_channel_unref2 (channel, "send-msg");
+				/* release channel */
+				vortex_channel_unref2 (channel, "send-msg");
 
-			return axl_false;
-		}
+				return axl_false;
+			} /* end if */
+		} else {
+			/* copy mime headers according to channel configuration, that
+			 * comes from profile configuration. */
+			data->message = axl_new (char , data->message_size + 1);
+			/* check alloc operation */
+			if (data->message == NULL) {
+				axl_free (data);
+				/* unlock send mutex */
+				vortex_mutex_unlock (&channel->send_mutex);
 
-		/* according to mime headers size */
-		if (mime_header_size > 0)
-			__vortex_channel_get_mime_headers (channel, data->message);
+				/* release channel */
+				vortex_channel_unref2 (channel, "send-msg");
+
+				return axl_false;
+			}
+
+			/* according to mime headers size */
+			if (mime_header_size > 0)
+				__vortex_channel_get_mime_headers (channel, data->message);
 	
-		/* copy message content */
-		memcpy (data->message + mime_header_size, message, message_size);
+			/* copy message content */
+			memcpy (data->message + mime_header_size, message, message_size);
+		} /* end if */
 	} else {
 		/* feeder configured, set it */
 		data->feeder = feeder;
@@ -2654,6 +2707,52 @@ check_limit:
 	return axl_true;
 }
 
+/** 
+ * @internal
+ * @brief Common function support other function to send message.
+ * 
+ * @param channel the channel where the message will be sent.
+ * @param message the message to be sent.
+ * @param message_size the message size.
+ *
+ * @param proposed_msg_no The message number to be used for the next
+ * send operation. If not defined (-1) vortex will allocate
+ * automatically a new one.
+ *
+ * @param msg_no message number reference used for this message
+ * sending attempt.
+ *
+ * @param wait_reply optional wait reply to implement Wait Reply
+ * method.
+ *
+ * @param feeder optional content feeder used to send the message. If
+ * this value is defined, message and message_size paramter is ignored
+ * but the caller still have to define message_size (the total amount
+ * of bytes that will be feeded).
+ *
+ * @param fixed_more Allows to signal if more flag should be enabled
+ * on this send operation. Note that, unlike \ref
+ * vortex_channel_send_rpy_more and \ref
+ * vortex_channel_send_rpy_error, this function will make the next
+ * operation to close or continue the send operation (because the
+ * function must reuse MSG numbers to put together all the content
+ * into a single, though fragmented, content).
+ * 
+ * @return axl_true if channel was sent or axl_false if not.
+ */
+axl_bool    vortex_channel_send_msg_common (VortexChannel       * channel,
+					    const void          * message,
+					    size_t                message_size,
+					    int                   proposed_msg_no, 
+					    int                 * msg_no,
+					    WaitReplyData       * wait_reply,
+					    VortexPayloadFeeder * feeder,
+					    axl_bool              fixed_more)
+{
+	return __vortex_channel_send_msg_common_full (channel, message, message_size, proposed_msg_no, msg_no, 
+						      wait_reply, feeder, fixed_more, axl_false, NULL);
+}
+
 /** 
  * @brief Request to send a new MSG frame on the provided channel,
  * taking as input the content received from the feeder provided.
@@ -2774,6 +2873,62 @@ axl_bool        vortex_channel_send_msg   (VortexChannel    * channel,
 	return vortex_channel_send_msg_common (channel, message, message_size, -1, msg_no, NULL, NULL, axl_false);
 }
 
+/** 
+ * @brief Sends the <i>message</i> over the selected <i>channel</i>
+ * without copying it.
+ *
+ * This function works like \ref vortex_channel_send_msg but, rather
+ * than creating a local copy of the message, the buffer provided is
+ * referenced until all its content is written to the socket. This
+ * allows to send large messages without copying them (twice)
+ * in memory.
+ *
+ * Because the buffer is used after this function returns, the caller
+ * must keep it valid and unmodified until the release handler is
+ * called. Once the library no longer requires the buffer (content
+ * sent or discarded), the release handler is called with the
+ * message as parameter. For example, to transfer ownership of a
+ * dynamically allocated message:
+ *
+ * \code
+ * // send the message, the library will call axl_free once done
+ * if (! vortex_channel_send_msg_nocopy (channel, message, message_size, NULL, axl_free)) {
+ *       // failed to send the message, we still own the buffer
+ *       axl_free (message);
+ * }
+ * \endcode
+ *
+ * @param channel The channel used to send the message.
+ *
+ * @param message The message to send. The buffer is not copied.
+ *
+ * @param message_size The message size.
+ *
+ * @param msg_no Optional reference. If defined returns the message
+ * number used for this deliver (BEEP msgno). 
+ *
+ * @param release Optional handler called once the message is no
+ * longer required. If NULL is provided, the caller must ensure the
+ * buffer is valid until the message is sent (for example, using a
+ * static buffer or waiting for the reply).
+ *
+ * @return axl_true if the message was queued to be sent, otherwise
+ * axl_false is returned. In the case axl_false is returned, release
+ * handler is not called and the caller keeps the ownership of the
+ * buffer.
+ *
+ * <i><b>NOTE:</b> See MIME considerations described at \ref
+ * vortex_channel_send_msg which also applies to this function.</i>
+ */
+axl_bool        vortex_channel_send_msg_nocopy (VortexChannel    * channel,
+						const void       * message,
+						size_t             message_size,
+						int              * msg_no,
+						axlDestroyFunc     release)
+{
+	return __vortex_channel_send_msg_common_full (channel, message, message_size, -1, msg_no, NULL, NULL, axl_false, axl_true, release);
+}
+
 /** 
  * @brief Allows to send a message, producing required fragments, but
  * ensuring all frames have more flag enabled.
@@ -2979,7 +3134,7 @@ void __vortex_channel_free_sequencer_data (VortexSequencerData * data)
 	if (data == NULL)
 		return;
 	axl_list_free (data->ans_nul_list); 
-	axl_free (data->message);
+	vortex_sequencer_release_message (data);
 	axl_free (data);
 	return;
 }
@@ -3047,7 +3202,9 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 				       size_t                message_size,
 				       int                   msg_no_rpy,
 				       VortexPayloadFeeder * feeder, 
-				       axl_bool              fixed_more)
+				       axl_bool              fixed_more,
+				       axl_bool              no_copy,
+				       axlDestroyFunc        release)
 {
 	VortexSequencerData * data;
 	VortexSequencerData * data2;
@@ -3111,8 +3268,25 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 		mime_header_size = __vortex_channel_get_mime_headers_size (ctx, channel);
 	data->message_size = message_size + mime_header_size;
 	
-	/* copy the message to be send using memcpy */
-	if (feeder == NULL && (message != NULL || data->message_size > 0)) {
+	/* reference the message to be sent without copying it */
+	if (feeder == NULL && no_copy) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "new reply message to sent (not copied) size (%d) = msg size (%d) + mime size (%d)",
+			    data->message_size, (int) message_size, mime_header_size);
+
+		if (! __vortex_channel_prepare_nocopy (channel, data, message, mime_header_size, release)) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "failed to allocate memory to hold mime headers for the message to be sent");
+			axl_free (data);
+			/* flag the channels non being sending */
+			vortex_mutex_unlock (&channel->send_mutex);
+
+			/* release channel */
+			vortex_channel_unref2 (channel, "send-rpy");
+
+			return axl_false;
+		} /* end if */
+
+	} else if (feeder == NULL && (message != NULL || data->message_size > 0)) {
+		/* copy the message to be send using memcpy */
 		vortex_log (VORTEX_LEVEL_DEBUG, "new reply message to sent size (%d) = msg size (%d) + mime size (%d)",
 			    data->message_size, (int) message_size, mime_header_size);
 
@@ -3182,6 +3356,8 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 			vortex_mutex_unlock (&channel->send_mutex);
 
 			/* free data to be sent */
+			/* caller keeps ownership of its buffer on failure */
+			data->release = NULL;
 			__vortex_channel_free_sequencer_data (data);
 
 			/* release channel */
@@ -3208,6 +3384,8 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 				/* check memory allocation */
 				if (data2 == NULL || data2->ans_nul_list == NULL) {
 					/* free, unlock and return failure */
+					/* caller keeps ownership of its buffer on failure */
+					data->release = NULL;
 					__vortex_channel_free_sequencer_data (data);
 					vortex_mutex_unlock (&channel->send_mutex);
 
@@ -3222,6 +3400,8 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 					    data2->type, data->type);
 
 				/* free, unlock and return failure */
+				/* caller keeps ownership of its buffer on failure */
+				data->release = NULL;
 				__vortex_channel_free_sequencer_data (data);
 				vortex_mutex_unlock (&channel->send_mutex);
 
@@ -3247,6 +3427,8 @@ axl_bool  __vortex_channel_common_rpy (VortexChannel       * channel,
 				vortex_log (VORTEX_LEVEL_WARNING, "Found NUL frame termination twice replying to message %d on channel %d at connection id=%d, dropping frame",
 					    msg_no_rpy, channel->channel_num, vortex_connection_get_id (channel->connection));
 				/* free, unlock and return failure */
+				/* caller keeps ownership of its buffer on failure */
+				data->release = NULL;
 				__vortex_channel_free_sequencer_data (data);
 				vortex_mutex_unlock (&channel->send_mutex);
 
@@ -3448,7 +3630,7 @@ axl_bool           vortex_channel_send_rpy_from_feeder            (VortexChannel
 								   int                   msg_no_rpy)
 {
 	/* call to common implementation */
-	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_RPY, NULL, 0, msg_no_rpy, feeder, axl_false);
+	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_RPY, NULL, 0, msg_no_rpy, feeder, axl_false, axl_false, NULL);
 }
 
 /** 
@@ -3497,10 +3679,10 @@ axl_bool           vortex_channel_send_rpy_from_feeder            (VortexChannel
  *  the same order the message were sent. This have a <i>"serial
  *  behavior"</i>. 
  *  
- *  <i><b>NOTE:</b> Take also a look into \ref
- *  vortex_channel_set_serialize to avoid thread planner decisions
- *  that could make frame received handlers to "appear" to be invoked
- *  in an unordered fashion.</i></li>
+ *  <i><b>NOTE:</b> Frame received handlers are invoked in order
+ *  because channels deliver frames serialized by default. Take a
+ *  look into \ref vortex_channel_set_serialize to change this
+ *  behaviour.</i></li>
  *  
  *  <li>Message sent over different channels will receive replies as
  *  fast as the remote BEEP node replies to them. This have a <i>"parallel behavior"</i></li>
@@ -3525,7 +3707,38 @@ axl_bool        vortex_channel_send_rpy        (VortexChannel    * channel,
 						int                msg_no_rpy)
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_RPY,
-					    message, message_size, msg_no_rpy, NULL, axl_false);
+					    message, message_size, msg_no_rpy, NULL, axl_false, axl_false, NULL);
+}
+
+/** 
+ * @brief Replies to the given message number without copying the
+ * reply content.
+ *
+ * This function works like \ref vortex_channel_send_rpy but the
+ * message provided is not copied. See \ref
+ * vortex_channel_send_msg_nocopy for details about how the buffer and
+ * the release handler are handled.
+ *
+ * @param channel the channel where the reply will be sent.
+ * @param message the message to sent (it is not copied)
+ * @param message_size the message size
+ * @param msg_no_rpy the message number this function is going to reply to.
+ *
+ * @param release Optional handler called once the message is no
+ * longer required.
+ * 
+ * @return axl_true if message was queued to be sent, otherwise
+ * axl_false is returned (in such case, release handler is not
+ * called).
+ */
+axl_bool        vortex_channel_send_rpy_nocopy (VortexChannel    * channel,  
+						const void       * message,
+						size_t             message_size,
+						int                msg_no_rpy,
+						axlDestroyFunc     release)
+{
+	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_RPY,
+					    message, message_size, msg_no_rpy, NULL, axl_false, axl_true, release);
 }
 
 /** 
@@ -3571,7 +3784,7 @@ axl_bool           vortex_channel_send_rpy_more                   (VortexChannel
 								   int                msg_no_rpy)
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_RPY,
-					    message, message_size, msg_no_rpy, NULL, axl_true);
+					    message, message_size, msg_no_rpy, NULL, axl_true, axl_false, NULL);
 }
 
 /** 
@@ -3684,7 +3897,7 @@ axl_bool           vortex_channel_send_ans_rpy                    (VortexChannel
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_ANS,
 					    message, message_size,
-					    msg_no_rpy, NULL, axl_false);
+					    msg_no_rpy, NULL, axl_false, axl_false, NULL);
 }
 
 /** 
@@ -3705,7 +3918,7 @@ axl_bool           vortex_channel_send_ans_rpy_from_feeder        (VortexChannel
 								   VortexPayloadFeeder * feeder,
 								   int                   msg_no_rpy)
 {
-	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_ANS, NULL, 0, msg_no_rpy, feeder, axl_false);
+	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_ANS, NULL, 0, msg_no_rpy, feeder, axl_false, axl_false, NULL);
 }
 
 /** 
@@ -3778,7 +3991,7 @@ axl_bool           vortex_channel_finalize_ans_rpy                (VortexChannel
 								   int             msg_no_rpy)
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_NUL,
-					    NULL, 0, msg_no_rpy, NULL, axl_false);
+					    NULL, 0, msg_no_rpy, NULL, axl_false, axl_false, NULL);
 }
 
 /** 
@@ -3817,7 +4030,7 @@ axl_bool   vortex_channel_send_err        (VortexChannel    * channel,
 					   int                msg_no_rpy)
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_ERR,
-					    message, message_size, msg_no_rpy, NULL, axl_false);
+					    message, message_size, msg_no_rpy, NULL, axl_false, axl_false, NULL);
 }
 
 /** 
@@ -3841,7 +4054,7 @@ axl_bool           vortex_channel_send_err_more                  (VortexChannel
 								  int                msg_no_rpy)
 {
 	return __vortex_channel_common_rpy (channel, VORTEX_FRAME_TYPE_ERR,
-					    message, message_size, msg_no_rpy, NULL, axl_true);
+					    message, message_size, msg_no_rpy, NULL, axl_true, axl_false, NULL);
 }
 
 /** 
@@ -3962,6 +4175,10 @@ int             vortex_channel_get_window_size (VortexChannel * channel)
  * configured value if you call to that function just after calling
  * \ref vortex_channel_set_window_size.
  *
+ * Lowering the window below a size grown by \ref VORTEX_CHANNEL_AUTOTUNE
+ * returns the released part of the channel reservation to the
+ * context budget (see \ref VORTEX_CHANNEL_AUTOTUNE_USED).
+ *
  * @param channel the channel to operate on.
  *
  * @param desired_size the desired window size; it is recomended to be
@@ -3970,10 +4187,31 @@ int             vortex_channel_get_window_size (VortexChannel * channel)
 void            vortex_channel_set_window_size (VortexChannel * channel,
                                                                                                int desired_size)
 {
+       VortexCtx * ctx;
+       int         release;
+
        v_return_if_fail (channel);
        v_return_if_fail (desired_size > 0);
-       
+
+       ctx = channel->ctx;
+       if (ctx == NULL) {
+	       channel->desired_window_size = desired_size;
+	       return;
+       } /* end if */
+
+       /* lowering the window below an autotuned size gives back
+        * the part of this channel's reservation that is no longer
+        * in use to the context memory budget */
+       vortex_mutex_lock (&ctx->channel_autotune_mutex);
+       if (desired_size < channel->desired_window_size && channel->tune_reserved > 0) {
+	       release = channel->desired_window_size - desired_size;
+	       if (release > channel->tune_reserved)
+		       release = channel->tune_reserved;
+	       channel->tune_reserved     -= release;
+	       ctx->channel_autotune_used -= release;
+       } /* end if */
        channel->desired_window_size = desired_size;
+       vortex_mutex_unlock (&ctx->channel_autotune_mutex);
 
        return;
 }
@@ -4242,6 +4480,7 @@ int                vortex_channel_get_next_frame_size         (VortexChannel * c
 	VortexCtx   * ctx = vortex_channel_get_ctx (channel);
 	int           size;
 	int           remote_buffer_available;
+	int           frame_size;
 
 	v_return_val_if_fail (channel, -1);
 
@@ -4272,6 +4511,21 @@ int                vortex_channel_get_next_frame_size         (VortexChannel * c
 	else
 		remote_buffer_available = (MAX_SEQ_MOD - next_seq_no) + max_seq_no + 1;
 	
+	/* autotuning: frames grow with the window advertised by the
+	 * remote peer (a quarter of it, so several frames are sent
+	 * between SEQ frames, which are received every half window) */
+	if (ctx->channel_autotune) {
+		vortex_mutex_lock (&channel->ref_mutex);
+		frame_size = channel->remote_window / 4;
+		vortex_mutex_unlock (&channel->ref_mutex);
+
+		if (frame_size < 4096)
+			frame_size = 4096;
+		if (frame_size > ctx->channel_autotune_max_frame_size)
+			frame_size = ctx->channel_autotune_max_frame_size;
+		return VORTEX_MIN (remote_buffer_available, VORTEX_MIN (message_size, frame_size));
+	} /* end if */
+
 	/* use default implementation */
 	return VORTEX_MIN (remote_buffer_available, VORTEX_MIN (channel->window_size, VORTEX_MIN (message_size, 4096)));
 }
@@ -4344,6 +4598,102 @@ int vortex_channel_incoming_bytes_available (VortexChannel * channel, VortexFram
 	return channel->seq_no_window - (vortex_frame_get_seqno (frame) - channel->consumed_seqno)  - vortex_frame_get_content_size (frame);
 }
 
+/** 
+ * @internal Returns the microseconds elapsed between the provided
+ * stamps.
+ */
+long __vortex_channel_tune_elapsed (struct timeval * start, struct timeval * stop)
+{
+	return ((long) (stop->tv_sec - start->tv_sec)) * 1000000 + (stop->tv_usec - start->tv_usec);
+}
+
+/** 
+ * @internal Window autotuning (see VORTEX_CHANNEL_AUTOTUNE): updates
+ * the round trip time and the bytes received per round trip with the
+ * frame received, growing the desired window size while the remote
+ * peer fills most of it each round trip (the window is what limits
+ * the transfer).
+ */
+void __vortex_channel_autotune (VortexCtx * ctx, VortexChannel * channel, VortexFrame * frame)
+{
+	struct timeval now;
+	unsigned int   last_seqno;
+	long           elapsed;
+	double         per_rtt;
+	int            window;
+	int            grow;
+
+	if (! ctx->channel_autotune || channel->channel_num == 0)
+		return;
+
+	gettimeofday (&now, NULL);
+	last_seqno = vortex_frame_get_seqno (frame) + vortex_frame_get_content_size (frame);
+
+	/* round trip time sample: content beyond the window
+	 * advertised before the last SEQ frame can't be sent until
+	 * the remote peer receives it (seqno rotation is handled by
+	 * the signed difference) */
+	if (channel->tune_measuring && ((int) (last_seqno - channel->tune_seqno)) > 0) {
+		elapsed = __vortex_channel_tune_elapsed (&channel->tune_stamp, &now);
+		if (elapsed < 1)
+			elapsed = 1;
+		if (channel->tune_rtt == 0 || elapsed < channel->tune_rtt)
+			channel->tune_rtt = elapsed;
+		channel->tune_measuring = axl_false;
+	} /* end if */
+
+	/* count bytes received during current round */
+	if (channel->tune_round.tv_sec == 0)
+		channel->tune_round = now;
+	channel->tune_bytes += vortex_frame_get_content_size (frame);
+
+	/* wait until a round trip time is known and elapsed */
+	if (channel->tune_rtt == 0)
+		return;
+	elapsed = __vortex_channel_tune_elapsed (&channel->tune_round, &now);
+	if (elapsed < channel->tune_rtt)
+		return;
+
+	/* bytes received per round trip (the round may have lasted
+	 * longer, for example if the remote peer was idle) */
+	per_rtt             = ((double) channel->tune_bytes) * channel->tune_rtt / elapsed;
+	channel->tune_bytes = 0;
+	channel->tune_round = now;
+
+	/* allow twice the amount received (rounded to 4096) */
+	window = (int) VORTEX_MIN (per_rtt * 2, ctx->channel_autotune_max_window);
+	window = ((window + 4095) / 4096) * 4096;
+	if (window > ctx->channel_autotune_max_window)
+		window = ctx->channel_autotune_max_window;
+	grow   = window - channel->desired_window_size;
+	if (grow <= 0)
+		return;
+
+	/* reserve memory from the context */
+	vortex_mutex_lock (&ctx->channel_autotune_mutex);
+	if (grow > (ctx->channel_autotune_memory - ctx->channel_autotune_used))
+		grow = ctx->channel_autotune_memory - ctx->channel_autotune_used;
+	if (grow > 0) {
+		ctx->channel_autotune_used   += grow;
+
+		/* applied with the next SEQ frame, updated under the
+		 * same lock so vortex_channel_set_window_size sees
+		 * the reservation together with the window */
+		channel->tune_reserved       += grow;
+		channel->desired_window_size += grow;
+		window                        = channel->desired_window_size;
+	} /* end if */
+	vortex_mutex_unlock (&ctx->channel_autotune_mutex);
+	if (grow <= 0)
+		return;
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "autotuning channel=%d window from %d to %d (rtt: %ld us, bytes per rtt: %d)",
+		    channel->channel_num, window - grow, window,
+		    channel->tune_rtt, (int) per_rtt);
+
+	return;
+}
+
 /** 
  * @internal
  * 
@@ -4376,9 +4726,9 @@ axl_bool      vortex_channel_update_incoming_buffer (VortexChannel * channel,
  	unsigned int consumed_seqno;
  	int          window_size;
 	int          bytes_available;
+	VortexCtx  * ctx     = vortex_channel_get_ctx (channel);
 #if defined(ENABLE_VORTEX_LOG)
  	unsigned int new_max_seq_no_accepted;
-	VortexCtx * ctx     = vortex_channel_get_ctx (channel);
 #endif
 
 	if (channel == NULL || frame == NULL)
@@ -4408,6 +4758,9 @@ axl_bool      vortex_channel_update_incoming_buffer (VortexChannel * channel,
 		return axl_false;
 	}
 
+	/* measure and autotune window size */
+	__vortex_channel_autotune (ctx, channel, frame);
+
 	/* Next sentence allows to get the next sequence that should
 	 * be used for the next frame received on the given
 	 * channel. With this value, a check for the maximum sequence
@@ -4487,6 +4840,15 @@ axl_bool      vortex_channel_update_incoming_buffer (VortexChannel * channel,
   			    channel_max_seq_no_accepted, new_max_seq_no_accepted, 
  			    (new_max_seq_no_accepted - channel_max_seq_no_accepted), consumed_seqno, window_size);
 
+		/* start a round trip time measurement (autotuning):
+		 * content beyond the window advertised so far can only
+		 * be sent once this SEQ frame is received */
+		if (ctx->channel_autotune && ! channel->tune_measuring) {
+			channel->tune_measuring = axl_true;
+			channel->tune_seqno     = channel_max_seq_no_accepted + 1;
+			gettimeofday (&channel->tune_stamp, NULL);
+		} /* end if */
+
 		/* update new max seq no accepted value */
 		channel->consumed_seqno     = consumed_seqno;
 		channel->seq_no_window      = window_size;
@@ -4707,41 +5069,40 @@ axlPointer        vortex_channel_remove_pending_message        (VortexChannel *
 }
 
 /** 
- * @brief Allows to serialize all messages/replies (MSG, ERR, RPY,
- * ANS/NUL) received on a particular channel, by checking that
- * previous messages/replies were delivered, avoiding thread race conditions.
+ * @brief Allows to configure if all messages/replies (MSG, ERR, RPY,
+ * ANS/NUL) received on a particular channel are delivered serialized
+ * (in order, one at a time) to the frame received handler (\ref
+ * VortexOnFrameReceived), or if they are delivered in parallel.
  *
- * This function allows to *ensure* that all calls to the frame
- * received handler (\ref VortexOnFrameReceived) are done in a way they are ordered. By calling to
- * this function, the vortex engine will ensure that all frames
- * received will be serialized without taking into consideration the
- * thread planner.
+ * Serialized delivery is the default for all channels but channel 0.
+ * Frames received are stored in order into a per channel delivery
+ * queue which is drained by a single thread pool task, invoking the
+ * frame received handler for each frame, in the order they were
+ * received, without considering the thread planner. 
  *
- * <b>FUNCTION BACKGROUND: why?</b>
- * 
- * Though all frames received are ordered, once they are processed by
- * the vortex reader, they are passed in to the second level handler
- * (for the frame received activation) by using threads.
+ * <b>FUNCTION BACKGROUND: why disable it?</b>
  * 
- * Beyond this point, the thread planner could decide to stop a thread
+ * With serialized delivery, a frame received handler blocked on a
+ * channel delays delivery of all frames received after it on the
+ * same channel (frames received on other channels are not
+ * affected). If your frame received handler may block for a long
+ * period (for example, waiting for an event triggered by another
+ * message received on the same channel), disable serialize so each
+ * frame is delivered by its own thread pool task.
+ *
+ * In that case, the thread planner could decide to stop a thread
  * that carries the RPY 1, and give priority to the thread carrying
  * the RPY 2, causing that the frame receiver to process the frame RPY
  * 2 before its preceding.
- * 
- * In most cases this is not a problem because all replies are matched
- * with its corresponding MSG, but under some circumstances where
- * replies have a relation, like chunks of a file transferred, it is
- * really required to process chunks received in an strict order.
  *
  * <b>CONFIGURING LISTENER SIDE:</b>
  *
- * Because the function enforces ordered delivery without considering
- * how the thread planner will do, the function must be called at the
- * side where it is required. If serial behaviour if required at the
- * listener side, then a call on this side is required. The same
- * applies to the initiator/client side.
+ * The function must be called at the side where it is required. If
+ * parallel behaviour is required at the listener side, then a call on
+ * this side is required. The same applies to the initiator/client
+ * side.
  *
- * In the case you want ordered delivery at the listener side, you
+ * In the case you want to configure it at the listener side, you
  * must configure the channel before receiving any message/reply. To
  * do so, configure a start channel handler (\ref VortexOnStartChannel
  * or \ref VortexOnStartChannelExtended), and get access to the
@@ -4756,8 +5117,8 @@ axlPointer        vortex_channel_remove_pending_message        (VortexChannel *
  *      // get channel reference 
  *      VortexChannel * channel = vortex_connection_get_channel (connection, channel_num);
  *
- *      // configure serialize behaviour 
- *      vortex_channel_set_serialize (channel, axl_true);
+ *      // configure parallel delivery
+ *      vortex_channel_set_serialize (channel, axl_false);
  *
  *      // accept channel 
  *      return axl_true;
@@ -4768,7 +5129,8 @@ axlPointer        vortex_channel_remove_pending_message        (VortexChannel *
  * @param channel The channel to make frame received handler to behave
  * in a serialize fashion.
  *
- * @param serialize axl_true to enable serialize, axl_false if not.
+ * @param serialize axl_true to enable serialize (default), axl_false
+ * if not.
  */
 void               vortex_channel_set_serialize                   (VortexChannel * channel,
 								   axl_bool        serialize)
@@ -4777,27 +5139,26 @@ void               vortex_channel_set_serialize                   (VortexChannel
 	if (channel == NULL)
 		return;
 	
-	/* lock the mutex */
-	vortex_mutex_lock (&channel->serialize_mutex);
-	
-	/* configure serialize */
+	/* configure serialize: frames already queued are still
+	 * delivered by the channel delivery task */
+	vortex_mutex_lock (&channel->delivery_mutex);
 	channel->serialize = serialize;
-	if (channel->serialize && channel->serialize_hash == NULL) {
-		/* create the hash to store pending frames */
-		channel->serialize_hash = axl_hash_new (axl_hash_int, axl_hash_equal_int);
-
-		/* also set seqno at this point to deliver next message */
-		channel->serialize_next_seqno = channel->last_seq_no_expected;
-	} /* end if */
-
-	/* lock the mutex */
-	vortex_mutex_unlock (&channel->serialize_mutex);
-	
+	vortex_mutex_unlock (&channel->delivery_mutex);
 
 	/* nothing more */
 	return;
 }
 
+/** 
+ * @internal Returns if frames received on the channel must be
+ * delivered through the channel delivery queue (serialize enabled and
+ * not channel 0, whose handlers may block).
+ */
+axl_bool           __vortex_channel_delivery_enabled              (VortexChannel * channel)
+{
+	return channel->serialize && channel->channel_num != 0;
+}
+
 /** 
  * @brief Allows to store a pair key/value associated to the channel.
  * 
@@ -4961,7 +5322,7 @@ axlPointer         vortex_channel_get_data                        (VortexChannel
  * channel. If the reference count for the channel provided reach 0,
  * the channel is deallocated.
  *
- * The function is thread-safe, internally protected with mutex.
+ * The function is thread-safe (the counter is updated atomically).
  * 
  * @param channel The channel to increase its reference counting.
  *
@@ -4979,7 +5340,7 @@ axl_bool           vortex_channel_ref                             (VortexChannel
  * provided. In the channel reference count reach 0 value, the channel
  * is deallocated, automatically calling to \ref vortex_channel_free.
  *
- * The function is thread-safe, internally protected with mutex.
+ * The function is thread-safe (the counter is updated atomically).
  * 
  * @param channel The channel to decrease its reference counting.
  *
@@ -4995,7 +5356,7 @@ void               vortex_channel_unref                           (VortexChannel
  * channel. If the reference count for the channel provided reach 0,
  * the channel is deallocated.
  *
- * The function is thread-safe, internally protected with mutex.
+ * The function is thread-safe (the counter is updated atomically).
  * 
  * @param channel The channel to increase its reference counting.
  *
@@ -5011,26 +5372,23 @@ axl_bool            vortex_channel_ref2                             (VortexChann
 #endif
 	axl_bool    result;
 
+	int         count;
+
 	/* check channel received */
 	v_return_val_if_fail (channel,                axl_false);
-	
-	/* lock ref/unref operations over this connection */
-	vortex_mutex_lock   (&channel->ref_mutex);
 
 #if defined(ENABLE_VORTEX_LOG)
 	ctx = channel->ctx;
 #endif
 
-	/* increase the channel reference counting */
-	channel->ref_count++;
+	/* increase the channel reference counting (atomically) */
+	count = vortex_atomic_add (&channel->ref_count, 1);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "VortexChannel=%d (%p) ref called %s, ref count status after calling=%d", 
-		    channel->channel_num, channel, label, channel->ref_count);
+		    channel->channel_num, channel, label, count);
 
 	/* return channel reference counting */
-	result = channel->ref_count >= 2;
-
-	vortex_mutex_unlock (&channel->ref_mutex);
+	result = count >= 2;
 
 	/* reference increased */
 	return result;
@@ -5041,7 +5399,7 @@ axl_bool            vortex_channel_ref2                             (VortexChann
  * provided. In the channel reference count reach 0 value, the channel
  * is deallocated, automatically calling to \ref vortex_channel_free.
  *
- * The function is thread-safe, internally protected with mutex.
+ * The function is thread-safe (the counter is updated atomically).
  * 
  * @param channel The channel to decrease its reference counting.
  *
@@ -5052,28 +5410,23 @@ void               vortex_channel_unref2                           (VortexChanne
 #if defined(ENABLE_VORTEX_LOG)
 	VortexCtx     * ctx;
 #endif
+	int             count;
 
 	/* check reference */
 	v_return_if_fail (channel);
 
-	/* lock the channel */
-	vortex_mutex_lock (&channel->ref_mutex);
-
-	/* decrease the channel */
-	channel->ref_count--;
-
 #if defined(ENABLE_VORTEX_LOG)
 	ctx = vortex_channel_get_ctx (channel);
 #endif
 
+	/* decrease the channel (atomically) */
+	count = vortex_atomic_add (&channel->ref_count, -1);
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "VortexChannel=%d (%p) unref called %s, ref count status after calling=%d", 
-		    channel->channel_num, channel, label, channel->ref_count);
+		    channel->channel_num, channel, label, count);
 
 	/* check reference counting */
-	if (channel->ref_count == 0) {
-		/* unlock the mutex and free the channel */
-		vortex_mutex_unlock (&channel->ref_mutex);
-
+	if (count == 0) {
 		vortex_log (VORTEX_LEVEL_DEBUG, "  freeing channel=%d, ref count is 0", 
 			    channel->channel_num);
 
@@ -5081,8 +5434,7 @@ void               vortex_channel_unref2                           (VortexChanne
 		return;
 	} /* end if */
 		
-	/* unlock and return, reference counting isn't exhausted. */
-	vortex_mutex_unlock (&channel->ref_mutex);
+	/* reference counting isn't exhausted. */
 	return;
 }
 
@@ -5103,14 +5455,8 @@ int                vortex_channel_ref_count                       (VortexChannel
 	if (channel == NULL)
 		return -1;
 
-	/* lock the channel */
-	vortex_mutex_lock (&channel->ref_mutex);
-
 	/* get reference counting */
-	result = channel->ref_count;
-
-	/* unlock the channel */
-	vortex_mutex_unlock (&channel->ref_mutex);
+	result = vortex_atomic_get (&channel->ref_count);
 
 	return result;
 }
@@ -6254,118 +6600,248 @@ typedef struct _ReceivedInvokeData {
 }ReceivedInvokeData;
 
 /** 
- * @internal Function used to check for previously stored frames. If
- * the function returns a reference, the caller must continue with the
- * delivery.
- * 
- * @param channel The channel where the operation will be implemented.
- * 
- * @return axl_true if the frame provided was deallocated and a new frame
- * was configured on the reference to continue with the delivery. If
- * axl_false is returned the frame is left untouched.
+ * @internal Delivers a single frame received on the provided
+ * channel, invoking the second level frame received handler (channel)
+ * or, if not defined, the first level one (profile). The frame is not
+ * released.
  */
-axl_bool  vortex_channel_check_serialize_pending (VortexCtx          * ctx,
-						  VortexConnection   * conn,
-						  VortexChannel      * channel, 
-						  VortexFrame       ** caller_frame)
+void __vortex_channel_deliver_frame (VortexCtx        * ctx,
+				     VortexConnection * connection,
+				     VortexChannel    * channel,
+				     int                channel_num,
+				     VortexFrame      * frame)
 {
-	VortexFrame * frame = (*caller_frame);
+	/* record actual connection state */
+	if (! vortex_connection_is_ok (connection, axl_false)) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "invoking frame receive on a non-connected session, conn-id=%d, channel-num=%d",
+			    vortex_connection_get_id (connection), channel_num);
+		return;
+	} /* end if */
 
-	if (channel->serialize) {
+	/* invoke handler */
+	if (channel->received) 
+		channel->received (channel, connection, frame, channel->received_user_data);
+	else if (! vortex_profiles_deliver_frame (channel, connection, frame)) 
+		vortex_log (VORTEX_LEVEL_CRITICAL, "invoking frame received on channel %d with not handler defined",
+			    channel_num);
 
-		/* get mutex */
-		vortex_mutex_lock (&channel->serialize_mutex);
+	/* check if the connection was closed inside frame received */
+	if (! vortex_connection_is_ok (connection, axl_false))
+		return;
 
-		/* frame points to delivered frame, update next seqno
-		 * to get next frame */
-		vortex_log (VORTEX_LEVEL_WARNING, "Channel serialize frame delivered seqno: %u, updating next...",
-			    vortex_frame_get_seqno (frame));
-		channel->serialize_next_seqno = vortex_frame_get_seqno (frame) + vortex_frame_get_content_size (frame);
-		vortex_log (VORTEX_LEVEL_WARNING, "        next seqno serialize is: %u ",
-			    vortex_frame_get_seqno (frame));
+	/* The function __vortex_channel_0_frame_received_close_msg
+	 * can be blocked awaiting to receive all replies
+	 * expected. The following signal tries to wake up a possible
+	 * thread blocked until last_reply_expected change. */
+	if (vortex_connection_channel_exists (connection, channel_num))
+		vortex_channel_signal_on_close_blocked (channel);
+	return;
+}
 
-		/* check if there are pending frames */
-		(*caller_frame) = (VortexFrame *) axl_hash_get (channel->serialize_hash, INT_TO_PTR (channel->serialize_next_seqno));
-		vortex_log (VORTEX_LEVEL_WARNING, "Channel serialize next frame to deliver is: %u (ref: %p)...",
-			    channel->serialize_next_seqno, *caller_frame);
+/** 
+ * @internal Drops frames queued for delivery and releases the
+ * references held by the delivery task. Used when the task can't be
+ * queued on the thread pool (for example, because it is being
+ * stopped).
+ */
+void __vortex_channel_delivery_cancel (VortexChannel * channel)
+{
+	VortexCtx        * ctx        = vortex_channel_get_ctx (channel);
+	VortexConnection * connection;
 
-		/* remove from the hash without dealloc */
-		axl_hash_delete (channel->serialize_hash, INT_TO_PTR (channel->serialize_next_seqno));
+	vortex_mutex_lock (&channel->delivery_mutex);
+	vortex_log (VORTEX_LEVEL_CRITICAL, "unable to queue delivery task for channel=%d, dropping %d pending frames",
+		    channel->channel_num, channel->delivery_count);
+	while (channel->delivery_count > 0) {
+		vortex_frame_unref (channel->delivery_frames[channel->delivery_head]);
+		channel->delivery_frames[channel->delivery_head] = NULL;
+		channel->delivery_head                           = (channel->delivery_head + 1) % channel->delivery_size;
+		channel->delivery_count--;
+	} /* end while */
+	connection                  = channel->delivery_conn;
+	channel->delivery_scheduled = axl_false;
+	channel->delivery_conn      = NULL;
+	vortex_mutex_unlock (&channel->delivery_mutex);
+
+	/* release references acquired when the task was scheduled */
+	vortex_channel_unref2 (channel, "delivery queue");
+	vortex_connection_unref (connection, "delivery queue");
+	return;
+}
 
-		/* check to reduce refence counting on connection due
-		 * to frame deliver */
-		if ((*caller_frame) != NULL) {
-			vortex_connection_unref (conn, "second level handler (check serialize pending)");
-			vortex_channel_unref2 (channel, "check serialize pending");
-		}
+/** 
+ * @internal Thread pool task that drains the channel delivery
+ * queue, delivering frames in the order they were received. Only one
+ * task per channel is running at a time. After \ref
+ * VORTEX_CHANNEL_DELIVERY_BATCH frames the task is queued again
+ * (keeping its references) so other channels are not starved.
+ */
+axlPointer __vortex_channel_delivery_run (VortexChannel * channel)
+{
+	VortexCtx        * ctx         = vortex_channel_get_ctx (channel);
+	VortexConnection * connection  = channel->delivery_conn;
+	int                channel_num = channel->channel_num;
+	int                delivered   = 0;
+	VortexFrame      * frame;
 
-		/* remove previous frame */
+	while (axl_true) {
+		vortex_mutex_lock (&channel->delivery_mutex);
+		if (channel->delivery_count == 0) {
+			/* queue drained, next frame received will
+			 * schedule a new task */
+			channel->delivery_scheduled = axl_false;
+			channel->delivery_conn      = NULL;
+			vortex_mutex_unlock (&channel->delivery_mutex);
+			break;
+		} /* end if */
+
+		if (delivered == VORTEX_CHANNEL_DELIVERY_BATCH) {
+			/* batch finished, queue again to let other
+			 * tasks to run */
+			vortex_mutex_unlock (&channel->delivery_mutex);
+			if (! vortex_thread_pool_new_task (ctx, (VortexThreadFunc) __vortex_channel_delivery_run, channel))
+				__vortex_channel_delivery_cancel (channel);
+			return NULL;
+		} /* end if */
+
+		/* get next frame */
+		frame                                            = channel->delivery_frames[channel->delivery_head];
+		channel->delivery_frames[channel->delivery_head] = NULL;
+		channel->delivery_head                           = (channel->delivery_head + 1) % channel->delivery_size;
+		channel->delivery_count--;
+		vortex_mutex_unlock (&channel->delivery_mutex);
+
+		/* deliver and release */
+		__vortex_channel_deliver_frame (ctx, connection, channel, channel_num, frame);
 		vortex_frame_unref (frame);
+		delivered++;
+	} /* end while */
 
-		/* unlock mutex */
-		vortex_mutex_unlock (&channel->serialize_mutex);
-		return (*caller_frame) ? axl_true : axl_false;
-	}
+	vortex_log (VORTEX_LEVEL_DEBUG, "channel=%d delivery queue drained (conn-id=%d, frames delivered on last run: %d)",
+		    channel_num, vortex_connection_get_id (connection), delivered);
 
-	/* if reached this point, no frame to deliver */
-	return axl_false;
+	/* release references acquired when the task was scheduled */
+	vortex_channel_unref2 (channel, "delivery queue");
+	vortex_connection_unref (connection, "delivery queue");
+	return NULL;
 }
 
 /** 
- * @internal Function that implements channel ordered delivery
- * (serialize) by checking its activation, and return axl_true if the
- * frame was stored for later delivery.
+ * @internal Queues the frame for ordered delivery on the provided
+ * channel, scheduling the delivery task if it is not already
+ * running. The frame is owned by the channel if the function returns
+ * axl_true.
+ *
+ * @return axl_true if the frame was queued, otherwise axl_false is
+ * returned (the frame must be released by the caller).
+ */
+axl_bool __vortex_channel_delivery_push (VortexConnection * connection,
+					 VortexChannel    * channel,
+					 VortexFrame      * frame)
+{
+	VortexCtx    * ctx      = vortex_channel_get_ctx (channel);
+	axl_bool       schedule = axl_false;
+	VortexFrame ** frames;
+	int            size;
+	int            iterator;
+
+	vortex_mutex_lock (&channel->delivery_mutex);
+
+	/* grow the ring (unrolling pending frames) if it is full */
+	if (channel->delivery_count == channel->delivery_size) {
+		size   = channel->delivery_size > 0 ? channel->delivery_size * 2 : 16;
+		frames = axl_new (VortexFrame *, size);
+		if (frames == NULL) {
+			vortex_mutex_unlock (&channel->delivery_mutex);
+			vortex_log (VORTEX_LEVEL_CRITICAL, "Allocation failed, unable to deliver frame");
+			return axl_false;
+		} /* end if */
+		for (iterator = 0; iterator < channel->delivery_count; iterator++)
+			frames[iterator] = channel->delivery_frames[(channel->delivery_head + iterator) % channel->delivery_size];
+		axl_free (channel->delivery_frames);
+		channel->delivery_frames = frames;
+		channel->delivery_size   = size;
+		channel->delivery_head   = 0;
+	} /* end if */
+
+	/* acquire references for the delivery task if it is not
+	 * running */
+	if (! channel->delivery_scheduled) {
+		if (! vortex_connection_ref (connection, "delivery queue")) {
+			vortex_mutex_unlock (&channel->delivery_mutex);
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to increase connection reference, avoiding delivering data (dropping frame)..");
+			return axl_false;
+		} /* end if */
+		vortex_channel_ref2 (channel, "delivery queue");
+		channel->delivery_conn      = connection;
+		channel->delivery_scheduled = axl_true;
+		schedule                    = axl_true;
+	} /* end if */
+
+	/* store frame */
+	channel->delivery_frames[(channel->delivery_head + channel->delivery_count) % channel->delivery_size] = frame;
+	channel->delivery_count++;
+	vortex_mutex_unlock (&channel->delivery_mutex);
+
+	/* if the task can't be queued the frame is dropped along with
+	 * the references acquired */
+	if (schedule && ! vortex_thread_pool_new_task (ctx, (VortexThreadFunc) __vortex_channel_delivery_run, channel))
+		__vortex_channel_delivery_cancel (channel);
+	return axl_true;
+}
+
+/** 
+ * @internal Kept for API compatibility: stores the frame into the
+ * channel delivery queue when ordered delivery (serialize) is
+ * enabled.
+ *
+ * <b>NOTE: </b> this function is deprecated and should not be used
+ * anymore. Frames received on serialized channels are already
+ * delivered in order through the channel delivery queue.
  * 
+ * @param ctx The context where the operation takes place.
+ * @param connection The connection where the frame was received.
  * @param channel The channel were the check will be implemented.
+ * @param frame The frame received.
  * 
- * @return axl_true if the function is signaling that the frame was stored
- * for later delivery, ortherwise axl_false is returned and delivery
- * continue.
+ * @return axl_true if the frame was stored for later delivery (and it
+ * is owned by the channel), otherwise axl_false is returned and
+ * delivery continue.
  */
 axl_bool  vortex_channel_check_serialize (VortexCtx        * ctx,
 					  VortexConnection * connection, 
 					  VortexChannel    * channel, 
 					  VortexFrame      * frame)
 {
-	if (channel->serialize) {
-		/* lock the mutex */
-		vortex_mutex_lock (&channel->serialize_mutex);
-
-		/* check for the first frame on the channel to
-		 * initialize next seqno to deliver */
-		if (vortex_frame_get_seqno (frame) == channel->serialize_next_seqno) {
-			/* next seqno expected */
-			vortex_log (VORTEX_LEVEL_WARNING, "Channel serialize for channel %u activated due to frame seqno %u == next serialize seqno %u (pending frames: %d)",
-				    channel->channel_num, vortex_frame_get_seqno (frame), channel->serialize_next_seqno, axl_hash_items (channel->serialize_hash));
-			vortex_log (VORTEX_LEVEL_WARNING, "Channel serialize for channel %u activated, next frame with seqno to deliver is: %u (skip store)", 
-				    channel->channel_num, channel->serialize_next_seqno);
-			/* first frame is not queued */
-			vortex_mutex_unlock (&channel->serialize_mutex);
-			return axl_false;
-		}
-
-		/* ok, reached this point, the frame can't be
-		 * delivered at this moment, store for future
-		 * delivery */
-		vortex_log (VORTEX_LEVEL_WARNING, "Channel serialize for channel %d, storing frame %p with seqno %u (expected %u) for later deliver (pending frames: %d)",
-			    channel->channel_num, frame,  vortex_frame_get_seqno (frame), channel->serialize_next_seqno, axl_hash_items (channel->serialize_hash));
-		axl_hash_insert_full (channel->serialize_hash,
-				      /* key */
-				      INT_TO_PTR (vortex_frame_get_seqno (frame)), NULL, 
-				      /* value */
-				      frame, (axlDestroyFunc) vortex_frame_unref);
-
-		/* unlock and retun frame stored */
-		vortex_mutex_unlock (&channel->serialize_mutex);
-		/* hold delivery (axl_true -> stop delivery) */
-		return axl_true;
-	} /* end if */
+	if (channel == NULL || connection == NULL || frame == NULL)
+		return axl_false;
 
-	/* continue delivery (axl_false -> continue with delivery) */
+	if (__vortex_channel_delivery_enabled (channel))
+		return __vortex_channel_delivery_push (connection, channel, frame);
 	return axl_false;
 }
 
-
+/** 
+ * @internal Kept for API compatibility.
+ *
+ * <b>NOTE: </b> this function is deprecated and should not be used
+ * anymore. Pending frames are delivered by the channel delivery
+ * queue, so there is never a pending frame to return.
+ * 
+ * @param ctx The context where the operation takes place.
+ * @param conn The connection where the frame was received.
+ * @param channel The channel where the operation will be implemented.
+ * @param caller_frame The frame delivered (left untouched).
+ * 
+ * @return axl_false (no frame to deliver).
+ */
+axl_bool  vortex_channel_check_serialize_pending (VortexCtx          * ctx,
+						  VortexConnection   * conn,
+						  VortexChannel      * channel, 
+						  VortexFrame       ** caller_frame)
+{
+	return axl_false;
+}
 
 /** 
  * @internal
@@ -6444,17 +6920,6 @@ axlPointer __vortex_channel_invoke_received_handler (ReceivedInvokeData * data)
 		goto free_resources;
 	}
 
-	/* check to enforce serialize */
-	if (vortex_channel_check_serialize (ctx, connection, channel, frame)) {
-
-		/* if the function returns axl_true, we must return
-		 * because the message was stored for later
-		 * delivery */
-		return NULL;
-	} /* end if */
-
- deliver_frame:
-
 	/* invoke handler */
 	if (channel->received) {
 		channel->received (channel, channel->connection, frame, channel->received_user_data);
@@ -6487,13 +6952,6 @@ axlPointer __vortex_channel_invoke_received_handler (ReceivedInvokeData * data)
 		       vortex_channel_get_number (channel));
 	}
 
-	/* check serialize to broadcast other waiting threads */
-	if (vortex_channel_check_serialize_pending (ctx, connection, channel, &frame)) {
-		/* if previous function returns axl_true, a new frame
-		 * reference we have to deliver */
-		goto deliver_frame;
-	}
-
 	/* before frame receive handler we have to check if client
 	 * have closed its connection */
 	is_connected = vortex_connection_is_ok (connection, axl_false);
@@ -6625,6 +7083,11 @@ axl_bool      vortex_channel_invoke_received_handler (VortexConnection * connect
 		return axl_false;
 	}
 
+	/* serialized channels (but channel 0, whose handlers may
+	 * block) use the delivery queue */
+	if (__vortex_channel_delivery_enabled (channel))
+		return __vortex_channel_delivery_push (connection, channel, frame);
+
 	/* prepare data to be passed in to thread */
 	data              = malloc (sizeof (ReceivedInvokeData));
 	if (data == NULL) {
@@ -7952,14 +8415,26 @@ void vortex_channel_free (VortexChannel * channel)
 	vortex_log (VORTEX_LEVEL_DEBUG, "freeing pending_mutex");
 	vortex_mutex_destroy (&channel->pending_mutex);
 
-	vortex_log (VORTEX_LEVEL_DEBUG, "freeing serialize_mutex");
-	vortex_mutex_destroy (&channel->serialize_mutex);
-	axl_hash_free (channel->serialize_hash);
+	vortex_log (VORTEX_LEVEL_DEBUG, "freeing delivery_mutex");
+	vortex_mutex_destroy (&channel->delivery_mutex);
+	while (channel->delivery_count > 0) {
+		vortex_frame_unref (channel->delivery_frames[channel->delivery_head]);
+		channel->delivery_head = (channel->delivery_head + 1) % channel->delivery_size;
+		channel->delivery_count--;
+	} /* end while */
+	axl_free (channel->delivery_frames);
 	axl_hash_free (channel->stored_replies);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "freeing ref_mutex");
 	vortex_mutex_destroy (&channel->ref_mutex);
 
+	/* release window grown with autotuning */
+	if (channel->tune_reserved > 0 && ctx) {
+		vortex_mutex_lock (&ctx->channel_autotune_mutex);
+		ctx->channel_autotune_used -= channel->tune_reserved;
+		vortex_mutex_unlock (&ctx->channel_autotune_mutex);
+	} /* end if */
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "freeing close_cond");
 	vortex_cond_destroy  (&channel->close_cond);
 
@@ -9191,7 +9666,7 @@ void              __vortex_channel_release_pending_messages (VortexChannel * cha
 		
 		/* free message and node itself */
 		vortex_payload_feeder_unref (next_data->feeder);
-		axl_free (next_data->message);
+		vortex_sequencer_release_message (next_data);
 		axl_free (next_data);
 
 		/* get next pending */
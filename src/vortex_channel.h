@@ -269,6 +269,12 @@ axl_bool           vortex_channel_send_msg                        (VortexChannel
 								   size_t             message_size,
 								   int              * msg_no);
 
+axl_bool           vortex_channel_send_msg_nocopy                 (VortexChannel    * channel,
+								   const void       * message,
+								   size_t             message_size,
+								   int              * msg_no,
+								   axlDestroyFunc     release);
+
 axl_bool           vortex_channel_send_msgv                       (VortexChannel * channel,
 								   int           * msg_no,
 								   const char    * format,
@@ -308,6 +314,12 @@ axl_bool           vortex_channel_send_rpy                        (VortexChannel
 								   size_t             message_size,
 								   int                msg_no_rpy);
 
+axl_bool           vortex_channel_send_rpy_nocopy                 (VortexChannel    * channel,  
+								   const void       * message,
+								   size_t             message_size,
+								   int                msg_no_rpy,
+								   axlDestroyFunc     release);
+
 axl_bool           vortex_channel_send_rpyv                       (VortexChannel * channel,
 								   int             msg_no_rpy,
 								   const   char  * format,
@@ -463,6 +475,12 @@ void                vortex_channel_cleanup                        (VortexCtx * c
 axl_bool            vortex_channel_block_until_replies_are_sent   (VortexChannel * channel, 
 								   long            microseconds_to_wait);
 
+axl_bool            __vortex_channel_delivery_enabled              (VortexChannel    * channel);
+
+axl_bool            __vortex_channel_delivery_push                 (VortexConnection * connection,
+								    VortexChannel    * channel,
+								    VortexFrame      * frame);
+
 axl_bool            vortex_channel_check_serialize                (VortexCtx        * ctx,
 								   VortexConnection * connection, 
 								   VortexChannel    * channel, 
@@ -335,6 +335,7 @@ void __vortex_connection_init_mutex (VortexConnection * connection)
 	vortex_mutex_create (&connection->pending_errors_mutex);
 	vortex_mutex_create (&connection->channel_update_mutex);
 	vortex_mutex_create (&connection->profile_masks_mutex);
+	vortex_mutex_create (&connection->output_mutex);
 
 	return;
 }
@@ -395,6 +396,18 @@ int  vortex_connection_default_send (VortexConnection * connection,
 	return send (connection->session, buffer, buffer_len, 0);
 }
 
+/** 
+ * @internal Allows to check if the connection is using the default
+ * send handler, that is, content is written directly to the socket
+ * (see \ref vortex_frame_send_raw_pieces).
+ */
+axl_bool vortex_connection_is_default_send (VortexConnection * connection)
+{
+	if (connection == NULL)
+		return axl_false;
+	return connection->send == vortex_connection_default_send;
+}
+
 /** 
  * @internal
  * @brief Default handler to be used while receiving data
@@ -409,6 +422,18 @@ int  vortex_connection_default_receive (VortexConnection * connection,
 	return recv (connection->session, buffer, buffer_len, 0);
 }
 
+/** 
+ * @internal Allows to check if the connection is using the default
+ * receive handler, that is, content is read directly from the
+ * socket.
+ */
+axl_bool vortex_connection_is_default_receive (VortexConnection * connection)
+{
+	if (connection == NULL)
+		return axl_false;
+	return connection->receive == vortex_connection_default_receive;
+}
+
 /** 
  * @internal Support function for connection identificators.
  *
@@ -420,20 +445,8 @@ int  vortex_connection_default_receive (VortexConnection * connection,
  */
 int  __vortex_connection_get_next_id (VortexCtx * ctx)
 {
-	/* get current context */
-	int         result;
-
-	/* lock */
-	vortex_mutex_lock (&ctx->connection_id_mutex);
-	
-	/* increase */
-	result = ctx->connection_id;
-	ctx->connection_id++;
-
-	/* unlock */
-	vortex_mutex_unlock (&ctx->connection_id_mutex);
-
-	return result;
+	/* increase without locking */
+	return vortex_atomic_add (&ctx->connection_id, 1) - 1;
 }
 
 /** 
@@ -953,6 +966,12 @@ VortexConnection * vortex_connection_new_empty_from_connection2 (VortexCtx
 								       NULL,
 								       NULL);
 
+			/* transfer fixed slots too */
+			memcpy (connection->slots, __connection->slots, sizeof (connection->slots));
+			memcpy (connection->slots_destroy, __connection->slots_destroy, sizeof (connection->slots_destroy));
+			memset (__connection->slots, 0, sizeof (__connection->slots));
+			memset (__connection->slots_destroy, 0, sizeof (__connection->slots_destroy));
+
 			/* remove being closed flag if found */
 			vortex_connection_set_data (connection, "being_closed", NULL);
 		} else 
@@ -2887,7 +2906,7 @@ axl_bool                    vortex_connection_close                  (VortexConn
 
 		/* update the connection reference to avoid race
 		 * conditions caused by deallocations */
-		refcount = connection->ref_count;
+		refcount = vortex_atomic_get (&connection->ref_count);
 		vortex_connection_unref (connection, "vortex_connection_close");
 
 		/* check special case where the caller have stoped a
@@ -2932,6 +2951,7 @@ axl_bool               vortex_connection_ref_internal                    (Vortex
 #if defined(ENABLE_VORTEX_LOG)
 	VortexCtx * ctx;
 #endif
+	int         count;
 
 	v_return_val_if_fail (connection, axl_false);
 	if (check_ref)
@@ -2942,21 +2962,15 @@ axl_bool               vortex_connection_ref_internal                    (Vortex
 	ctx = connection->ctx;
 #endif
 	
-	/* lock ref/unref operations over this connection */
-	vortex_mutex_lock   (&connection->ref_mutex);
-
-	/* increase and log the connection increased */
-	connection->ref_count++;
+	/* increase (atomically) and log the connection increased */
+	count = vortex_atomic_add (&connection->ref_count, 1);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "%d increased connection id=%d (%p) reference to %d by %s\n",
 		    vortex_getpid (),
 		    connection->id, connection,
-		    connection->ref_count, who ? who : "??" ); 
+		    count, who ? who : "??" ); 
 
-	/* unlock ref/unref options over this connection */
-	vortex_mutex_unlock (&connection->ref_mutex);
-
-	return connection->ref_count > 1;
+	return count > 1;
 }
 
 /** 
@@ -3060,25 +3074,19 @@ void               vortex_connection_unref                  (VortexConnection *
 	if (connection == NULL)
 		return;
 
-	/* lock the connection being unrefered */
-	vortex_mutex_lock     (&(connection->ref_mutex));
-
 #if defined(ENABLE_VORTEX_LOG)
 	/* get context */
 	ctx = connection->ctx;
 #endif
 
-	/* decrease reference counting */
-	connection->ref_count--;
+	/* decrease reference counting (atomically) and get current
+	 * count */
+	count = vortex_atomic_add (&connection->ref_count, -1);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "%d decreased connection id=%d (%p) reference count to %d decreased by %s\n", 
 		    vortex_getpid (),
 		    connection->id, connection,
-		    connection->ref_count, who ? who : "??");  
-		
-	/* get current count */
-	count = connection->ref_count;
-	vortex_mutex_unlock (&(connection->ref_mutex));
+		    count, who ? who : "??");  
 
 	/* if counf is 0, free the connection */
 	if (count == 0) {
@@ -3110,9 +3118,7 @@ int                 vortex_connection_ref_count              (VortexConnection *
 		return -1;
 
 	/* return the reference count */
-	/* vortex_mutex_lock     (&(connection->ref_mutex)); */
-	result = connection->ref_count;
-	/* vortex_mutex_unlock     (&(connection->ref_mutex)); */
+	result = vortex_atomic_get (&connection->ref_count);
 	return result;
 }
 
@@ -3601,6 +3607,7 @@ void                vortex_connection_push_channel_error     (VortexConnection
 void               vortex_connection_free (VortexConnection * connection)
 {
 	VortexChannelError * error;
+	int                  iterator;
 #if defined(ENABLE_VORTEX_LOG)
 	VortexCtx          * ctx;
 #endif
@@ -3640,6 +3647,13 @@ void               vortex_connection_free (VortexConnection * connection)
 		connection->data = NULL;
 	}
 
+	/* release fixed slots */
+	for (iterator = 0; iterator < VORTEX_CONNECTION_SLOTS; iterator++) {
+		if (connection->slots[iterator] != NULL && connection->slots_destroy[iterator] != NULL)
+			connection->slots_destroy[iterator] (connection->slots[iterator]);
+		connection->slots[iterator] = NULL;
+	} /* end for */
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "freeing connection message id=%d", connection->id);
 
         /* free all resources */
@@ -3684,9 +3698,16 @@ void               vortex_connection_free (VortexConnection * connection)
 	connection->features = NULL;
 	connection->localize = NULL;
 
-	/* free pending line */
-	axl_free (connection->pending_line);
-	connection->pending_line = NULL;
+	/* free input buffer */
+	axl_free (connection->input_buffer);
+	connection->input_buffer = NULL;
+
+	/* write and free output queued (asynchronous writes) */
+	if (connection->close_session && connection->session != -1)
+		vortex_frame_flush_output (connection);
+	axl_free (connection->output_buffer);
+	connection->output_buffer = NULL;
+	vortex_mutex_destroy (&connection->output_mutex);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "freeing connection channel pools id=%d", connection->id);
 	/* free channel pools */
@@ -4659,21 +4680,56 @@ void                vortex_connection_remove_channel_common  (VortexConnection *
  * has either writen or received content, setting a timestamp, which
  * allows checking if the connection was idle.
  *
+ * This is called on every read and write, so it takes no lock: the
+ * counters are updated with relaxed atomic operations and the stamp
+ * is taken from the coarse clock refreshed by the vortex reader
+ * (only written when it changes, so the cache line is not dirtied
+ * on each call).
+ *
  * @param conn The connection that received or produced content.
- * @param bytes Bytes received on this stamp.
+ * @param bytes_received Bytes received on this stamp.
+ * @param bytes_sent Bytes sent on this stamp.
  */
 void                vortex_connection_set_receive_stamp            (VortexConnection * conn, long bytes_received, long bytes_sent)
 {
+	long now;
+
 	/* set that content was received */
-	vortex_mutex_lock (&conn->ref_mutex);
-	conn->last_idle_stamp  = (long) time (NULL);
-	conn->bytes_received  += bytes_received;
-	conn->bytes_sent      += bytes_sent;
-	vortex_mutex_unlock (&conn->ref_mutex);
+	now = __vortex_ctx_get_coarse_time (conn->ctx);
+	if (vortex_atomic_get_long (&conn->last_idle_stamp) != now)
+		vortex_atomic_set_long (&conn->last_idle_stamp, now);
+	if (bytes_received != 0)
+		vortex_atomic_add_long (&conn->bytes_received, bytes_received);
+	if (bytes_sent != 0)
+		vortex_atomic_add_long (&conn->bytes_sent, bytes_sent);
 
 	return;
 }
 
+/** 
+ * @brief Allows transports that buffer content (for example, TLS or
+ * WebSocket) to report the amount of octets they are holding after a
+ * read operation.
+ *
+ * That content is not visible to the I/O waiting mechanism (the
+ * socket itself may be empty) so, while this value is greater than 0,
+ * the vortex reader keeps on reading from the connection rather than
+ * waiting for the socket to be ready again. The value is cleared by
+ * the reader before reading again, so it must be reported after each
+ * read (including 0 when nothing is pending).
+ *
+ * @param conn The connection to update.
+ *
+ * @param pending Octets buffered by the transport.
+ */
+void                vortex_connection_set_pending_input            (VortexConnection * conn, int pending)
+{
+	if (conn == NULL)
+		return;
+	conn->pending_input = pending;
+	return;
+}
+
 /** 
  * @internal allows to get bytes received so far and last idle stamp
  * (idle since that stamp) on the provided connection.
@@ -4691,14 +4747,12 @@ void                vortex_connection_get_receive_stamp            (VortexConnec
 		(*last_idle_stamp) = 0;
 	if (conn == NULL)
 		return;
-	vortex_mutex_lock (&conn->ref_mutex);
 	if (bytes_received != NULL)
-		(*bytes_received) = conn->bytes_received;
+		(*bytes_received) = vortex_atomic_get_long (&conn->bytes_received);
 	if (bytes_sent != NULL)
-		(*bytes_sent) = conn->bytes_sent;
+		(*bytes_sent) = vortex_atomic_get_long (&conn->bytes_sent);
 	if (last_idle_stamp != NULL)
-		(*last_idle_stamp) = conn->last_idle_stamp;
-	vortex_mutex_unlock (&conn->ref_mutex);
+		(*last_idle_stamp) = vortex_atomic_get_long (&conn->last_idle_stamp);
 
 	return;
 }
@@ -4710,18 +4764,21 @@ void                vortex_connection_get_receive_stamp            (VortexConnec
  */
 void                vortex_connection_check_idle_status            (VortexConnection * conn, VortexCtx * ctx, long time_stamp)
 {
+	long last_idle_stamp;
+
 	/* do not notify master listeners activity (they don't have) */
 	if (conn->role == VortexRoleMasterListener)
 		return;
 
 	/* check if the connection was never checked */
-	if (conn->last_idle_stamp == 0) {
+	last_idle_stamp = vortex_atomic_get_long (&conn->last_idle_stamp);
+	if (last_idle_stamp == 0) {
 		vortex_connection_set_receive_stamp (conn, 0, 0);
 		return;
 	} /* end if */
 
 	/* check idle status */
-	if ((time_stamp - conn->last_idle_stamp) > ctx->max_idle_period) {
+	if ((time_stamp - last_idle_stamp) > ctx->max_idle_period) {
 		vortex_log (VORTEX_LEVEL_DEBUG, "Found idle connection id=%d, notifying..", vortex_connection_get_id (conn));
 		/* notify idle ref */
 		vortex_ctx_notify_idle (ctx, conn);
@@ -5423,6 +5480,32 @@ void                vortex_connection_block                        (VortexConnec
 	return;
 }
 
+/** 
+ * @brief Same as \ref vortex_connection_block but without waiting
+ * for the vortex reader to apply the change, which is done on its
+ * next iteration (a reader blocked waiting is woken up). Unlike \ref vortex_connection_block, it can be
+ * called from the vortex reader itself (for example, from a preread
+ * handler, see \ref vortex_connection_set_preread_handler).
+ *
+ * @param conn The connection to (un)block.
+ *
+ * @param enable axl_true to block the connection, axl_false to make
+ * it accept incoming data again.
+ */
+void                vortex_connection_block_nowait                 (VortexConnection * conn,
+								    axl_bool           enable)
+{
+	v_return_if_fail (conn);
+
+	/* set blocking state */
+	conn->is_blocked = enable;
+
+	/* request readers to review connections watched */
+	__vortex_reader_review (vortex_connection_get_ctx (conn));
+
+	return;
+}
+
 /** 
  * @brief Allows to check if the connection provided is blocked.
  * 
@@ -5442,6 +5525,29 @@ axl_bool             vortex_connection_is_blocked                   (VortexConne
 	return conn->is_blocked;
 }
 
+/** 
+ * @brief Allows to get the amount of bytes queued on the connection
+ * that are still pending to be written (see \ref VORTEX_ASYNC_WRITES).
+ * 
+ * @param conn The connection to check.
+ * 
+ * @return Bytes queued pending to be written. The function returns 0
+ * when asynchronous writes are not enabled or if the reference
+ * provided is NULL.
+ */
+int                  vortex_connection_get_pending_output           (VortexConnection  * conn)
+{
+	int result;
+
+	v_return_val_if_fail (conn, 0);
+
+	vortex_mutex_lock (&conn->output_mutex);
+	result = conn->output_size;
+	vortex_mutex_unlock (&conn->output_mutex);
+
+	return result;
+}
+
 /** 
  * @brief Allows to check if the provided connection is still in
  * transit of being accepted.
@@ -5787,6 +5893,11 @@ void           __vortex_connection_set_not_connected (VortexConnection * connect
 	ctx = connection->ctx;
 #endif
 
+	/* write output queued (asynchronous writes) before the
+	 * socket is closed: it was already reported as sent */
+	if (connection->close_session && vortex_connection_is_ok (connection, axl_false))
+		vortex_frame_flush_output (connection);
+
 	/* set connection status to axl_false if weren't */
 	vortex_mutex_lock (&connection->op_mutex);
 
@@ -6090,6 +6201,124 @@ axlPointer          vortex_connection_get_hook               (VortexConnection *
 	return connection->hook;
 }
 
+/** 
+ * @internal Names of the slots registered so far (shared by all
+ * contexts) and the spin lock protecting their registration.
+ */
+static const char * __vortex_connection_slot_names[VORTEX_CONNECTION_SLOTS];
+static int          __vortex_connection_slot_count = 0;
+static int          __vortex_connection_slot_lock  = 0;
+
+/** 
+ * @brief Allows to register a fixed slot to store per connection
+ * state that is accessed too often to pay a string hash lookup (like
+ * \ref vortex_connection_get_data does), for example, state required
+ * by a send or receive handler.
+ *
+ * Slots are intended for modules (TLS, WebSocket, tunnel, alive...)
+ * which register them once at init, keeping the identifier returned
+ * to later call \ref vortex_connection_set_slot and \ref
+ * vortex_connection_get_slot. Identifiers are shared by all contexts
+ * and registering the same name again returns the same identifier,
+ * so the module can keep it in a static variable.
+ *
+ * There are \ref VORTEX_CONNECTION_SLOTS available.
+ *
+ * @param name The slot name. The reference must remain valid for the
+ * rest of the process (usually a string literal).
+ *
+ * @return The slot identifier or -1 if it fails (name is NULL or
+ * there are no more slots available).
+ */
+int                 vortex_connection_slot_register          (const char       * name)
+{
+	int slot;
+
+	if (name == NULL)
+		return -1;
+
+	/* registration only happens at module init */
+	while (! vortex_atomic_compare_and_swap (&__vortex_connection_slot_lock, 0, 1))
+		;
+
+	for (slot = 0; slot < __vortex_connection_slot_count; slot++) {
+		if (axl_cmp (__vortex_connection_slot_names[slot], name))
+			break;
+	} /* end for */
+
+	if (slot == __vortex_connection_slot_count) {
+		if (slot == VORTEX_CONNECTION_SLOTS) {
+			slot = -1;
+		} else {
+			__vortex_connection_slot_names[slot] = name;
+			__vortex_connection_slot_count++;
+		} /* end if */
+	} /* end if */
+
+	vortex_atomic_compare_and_swap (&__vortex_connection_slot_lock, 1, 0);
+	return slot;
+}
+
+/** 
+ * @brief Stores a value on the provided slot (see \ref
+ * vortex_connection_slot_register), releasing the value previously
+ * stored with its destroy function.
+ *
+ * Values are released when the connection is finished. They are
+ * transferred, like data configured with \ref
+ * vortex_connection_set_data, when a connection is created from
+ * another (for example, during TLS negotiation).
+ *
+ * Because \ref vortex_connection_get_slot does not lock, values must
+ * be configured before other threads may use them (for example,
+ * before installing the send and receive handlers that use them).
+ *
+ * @param connection The connection where the value will be stored.
+ * @param slot The slot identifier.
+ * @param value The value to store or NULL to release current value.
+ * @param value_destroy Optional function to release the value.
+ */
+void                vortex_connection_set_slot               (VortexConnection * connection,
+							      int                slot,
+							      axlPointer         value,
+							      axlDestroyFunc     value_destroy)
+{
+	axlPointer     old_value;
+	axlDestroyFunc old_destroy;
+
+	if (connection == NULL || slot < 0 || slot >= VORTEX_CONNECTION_SLOTS)
+		return;
+
+	vortex_mutex_lock (&connection->ref_mutex);
+	old_value   = connection->slots[slot];
+	old_destroy = connection->slots_destroy[slot];
+	connection->slots[slot]         = value;
+	connection->slots_destroy[slot] = value_destroy;
+	vortex_mutex_unlock (&connection->ref_mutex);
+
+	/* release previous value */
+	if (old_value != NULL && old_value != value && old_destroy != NULL)
+		old_destroy (old_value);
+	return;
+}
+
+/** 
+ * @brief Returns the value stored on the provided slot (see \ref
+ * vortex_connection_set_slot).
+ *
+ * @param connection The connection where the value is stored.
+ * @param slot The slot identifier.
+ *
+ * @return The value stored or NULL if it fails or nothing is stored.
+ */
+axlPointer          vortex_connection_get_slot               (VortexConnection * connection,
+							      int                slot)
+{
+	if (connection == NULL || slot < 0 || slot >= VORTEX_CONNECTION_SLOTS)
+		return NULL;
+	return connection->slots[slot];
+}
+
 
 /** 
  * @brief Allows to define custom actions to be implemented (by
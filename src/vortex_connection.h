@@ -80,6 +80,13 @@
  */
 #define CONN_CTX(c) vortex_connection_get_ctx(c)
 
+/** 
+ * @brief Number of fixed slots available on each connection to store
+ * per connection state without a hash lookup (see \ref
+ * vortex_connection_slot_register).
+ */
+#define VORTEX_CONNECTION_SLOTS 16
+
 VortexConnection  * vortex_connection_new                    (VortexCtx            * ctx,
 							      const char           * host, 
 							      const char           * port,
@@ -304,6 +311,16 @@ void                vortex_connection_set_hook               (VortexConnection *
 
 axlPointer          vortex_connection_get_hook               (VortexConnection * connection);
 
+int                 vortex_connection_slot_register          (const char       * name);
+
+void                vortex_connection_set_slot               (VortexConnection * connection,
+							      int                slot,
+							      axlPointer         value,
+							      axlDestroyFunc     value_destroy);
+
+axlPointer          vortex_connection_get_slot               (VortexConnection * connection,
+							      int                slot);
+
 void                vortex_connection_delete_key_data        (VortexConnection * connection,
 							      const char       * key);
 
@@ -409,6 +426,8 @@ void                vortex_connection_remove_handler               (VortexConnec
 
 void                vortex_connection_set_receive_stamp            (VortexConnection * conn, long bytes_received, long bytes_sent);
 
+void                vortex_connection_set_pending_input            (VortexConnection * conn, int pending);
+
 void                vortex_connection_get_receive_stamp            (VortexConnection * conn, long * bytes_received, long * bytes_sent, long * last_idle_stamp);
 
 void                vortex_connection_check_idle_status            (VortexConnection * conn, VortexCtx * ctx, long time_stamp);
@@ -416,8 +435,13 @@ void                vortex_connection_check_idle_status            (VortexConnec
 void                vortex_connection_block                        (VortexConnection * conn,
 								    axl_bool           enable);
 
+void                vortex_connection_block_nowait                 (VortexConnection * conn,
+								    axl_bool           enable);
+
 axl_bool            vortex_connection_is_blocked                   (VortexConnection  * conn);
 
+int                 vortex_connection_get_pending_output           (VortexConnection  * conn);
+
 axl_bool            vortex_connection_half_opened                  (VortexConnection  * conn);
 
 int                 vortex_connection_get_next_frame_size          (VortexConnection * connection,
@@ -475,6 +499,14 @@ void                __vortex_connection_check_and_notify     (VortexConnection *
 
 int                 vortex_connection_get_mss                (VortexConnection * connection);
 
+int                 vortex_connection_default_send           (VortexConnection * connection,
+							      const char       * buffer,
+							      int                buffer_len);
+
+axl_bool            vortex_connection_is_default_send        (VortexConnection * connection);
+
+axl_bool            vortex_connection_is_default_receive     (VortexConnection * connection);
+
 axl_bool            vortex_connection_check_socket_limit     (VortexCtx        * ctx, 
 							      VORTEX_SOCKET      socket);
 
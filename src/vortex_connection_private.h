@@ -97,6 +97,13 @@ void freeaddrinfo(struct addrinfo *ai);
 #  endif
 #endif
 
+/** 
+ * @internal Size of the per connection input buffer used by the
+ * frame factory to read content from the transport. Frame payloads
+ * bigger than this value are read directly into the frame buffer.
+ */
+#define VORTEX_FRAME_INPUT_BUFFER_SIZE 16384
+
 /** 
  * @internal
  * @brief Internal VortexConnection representation.
@@ -193,6 +200,13 @@ struct _VortexConnection {
 	 *   - \ref vortex_connection_set_data
 	 */
 	VortexHash * data;
+	/** 
+	 * @internal Fixed slots, with their destroy functions,
+	 * handed out by vortex_connection_slot_register. Read
+	 * without locking (see vortex_connection_get_slot).
+	 */
+	axlPointer     slots[VORTEX_CONNECTION_SLOTS];
+	axlDestroyFunc slots_destroy[VORTEX_CONNECTION_SLOTS];
 	/** 
 	 * @brief Keeps track for the last channel created on this
 	 * session. The connection role modifies the way channel
@@ -381,7 +395,8 @@ struct _VortexConnection {
 
 	/** 
 	 * @internal Value to track now many bytes has being received
-	 * and sent on this connection.
+	 * and sent on this connection. These and last_idle_stamp are
+	 * only accessed through vortex_atomic_*_long.
 	 */
 	long                    bytes_received;
 	long                    bytes_sent;
@@ -392,6 +407,51 @@ struct _VortexConnection {
 	 */
 	axl_bool                reader_unwatch;
 
+	/** 
+	 * @internal Socket registered on the reader fd group when
+	 * the I/O mechanism is used in incremental mode.
+	 */
+	axl_bool                reader_registered;
+	VORTEX_SOCKET           reader_fd;
+
+	/** 
+	 * @internal Value that signals the connection still holds
+	 * complete frames (already read) after the reader used the
+	 * frame budget configured (VORTEX_READER_FRAME_BUDGET), so
+	 * they must be processed without waiting for the transport.
+	 */
+	axl_bool                reader_backlog;
+
+	/** 
+	 * @internal Octets buffered by the transport where the I/O
+	 * waiting mechanism can't see them (for example, TLS or
+	 * WebSocket). See vortex_connection_set_pending_input.
+	 */
+	int                     pending_input;
+
+	/** 
+	 * @internal Output queued because it couldn't be written
+	 * without blocking (asynchronous writes, see
+	 * VORTEX_ASYNC_WRITES). Pending content is found at
+	 * output_buffer + output_offset (output_size bytes).
+	 * output_watched signals the connection is watched by the
+	 * output thread and output_blocked signals the sequencer
+	 * stopped sending on this connection because the high
+	 * water mark was reached. output_writable is the handler
+	 * notified once by the output thread when the socket can be
+	 * written (see vortex_sequencer_watch_writable). All
+	 * protected by output_mutex.
+	 */
+	VortexMutex                  output_mutex;
+	char                       * output_buffer;
+	int                          output_buffer_size;
+	int                          output_offset;
+	int                          output_size;
+	axl_bool                     output_watched;
+	axl_bool                     output_blocked;
+	VortexConnectionOnWritable   output_writable;
+	axlPointer                   output_writable_data;
+
 	/** 
 	 * @internal Value to signal initial accept stage associated
 	 * to a connection in the middle of the greetings.
@@ -400,10 +460,15 @@ struct _VortexConnection {
 	axl_bool                transport_detected;
 
 	/** 
-	 * @internal Reference to a line that wasn't totally read when
-	 * call vortex_frame_readline.
+	 * @internal Input buffer used by the frame factory to read
+	 * from the transport in large chunks rather than byte by
+	 * byte. Content not consumed yet is found between
+	 * input_start and input_end. The buffer is allocated on first
+	 * read (see vortex_frame_readline).
 	 */ 
-	char                  * pending_line;
+	char                  * input_buffer;
+	int                     input_start;
+	int                     input_end;
 
 	/** 
 	 * @internal Value that signals if seq frame emision is
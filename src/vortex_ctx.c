@@ -92,6 +92,8 @@ VortexCtx * vortex_ctx_new (void)
 
 	/**** vortex_frame_factory.c: init module ****/
 	ctx->frame_id = 1;
+	vortex_mutex_create (&ctx->frame_pool_mutex);
+	ctx->frame_pool_limit = 256;
 
 	/* init mutex for the log */
 	vortex_mutex_create (&ctx->log_mutex);
@@ -99,6 +101,19 @@ VortexCtx * vortex_ctx_new (void)
 	/**** vortex_thread_pool.c: init ****/
 	ctx->thread_pool_exclusive = axl_true;
 
+	/**** vortex_reader.c: init ****/
+	ctx->reader_frame_budget   = 64;
+
+	/**** vortex_sequencer.c: init ****/
+	ctx->sequencer_flush_size  = 65536;
+	ctx->output_high_water_mark = 1048576;
+
+	/**** vortex_channel.c: init ****/
+	vortex_mutex_create (&ctx->channel_autotune_mutex);
+	ctx->channel_autotune_max_window     = 4194304;
+	ctx->channel_autotune_memory         = 67108864;
+	ctx->channel_autotune_max_frame_size = 65536;
+
 	/* init reference counting */
 	vortex_mutex_create (&ctx->ref_mutex);
 	ctx->ref_count = 1;
@@ -118,6 +133,8 @@ void      vortex_ctx_reinit (VortexCtx * ctx)
 {
 	vortex_mutex_create (&ctx->log_mutex);
 	vortex_mutex_create (&ctx->ref_mutex);
+	vortex_mutex_create (&ctx->frame_pool_mutex);
+	vortex_mutex_create (&ctx->channel_autotune_mutex);
 
 	/* the rest of mutexes are initialized by vortex_init_ctx. */
 	ctx->ref_count = 1;
@@ -660,17 +677,16 @@ void        vortex_ctx_ref                       (VortexCtx  * ctx)
  */
 void        vortex_ctx_ref2                       (VortexCtx  * ctx, const char * who)
 {
+	int count;
+
 	/* do nothing */
 	if (ctx == NULL)
 		return;
 
-	/* acquire the mutex */
-	vortex_mutex_lock (&ctx->ref_mutex);
-	ctx->ref_count++;
-
-	vortex_log (VORTEX_LEVEL_DEBUG, "%s: increased references to VortexCtx %p (refs: %d)", who, ctx, ctx->ref_count);
+	/* update reference counting */
+	count = vortex_atomic_add (&ctx->ref_count, 1);
 
-	vortex_mutex_unlock (&ctx->ref_mutex);
+	vortex_log (VORTEX_LEVEL_DEBUG, "%s: increased references to VortexCtx %p (refs: %d)", who, ctx, count);
 
 	return;
 }
@@ -689,10 +705,7 @@ int         vortex_ctx_ref_count                 (VortexCtx  * ctx)
 	if (ctx == NULL)
 		return -1;
 	
-	/* acquire the mutex */
-	/* vortex_mutex_lock (&ctx->ref_mutex);  */
-	result = ctx->ref_count;
-	/* vortex_mutex_unlock (&ctx->ref_mutex); */
+	result = vortex_atomic_get (&ctx->ref_count);
 
 	return result;
 }
@@ -734,21 +747,16 @@ void        vortex_ctx_unref2                     (VortexCtx ** ctx, const char
 	/* get local reference */
 	_ctx = (*ctx);
 
-	/* check if we have to nullify after unref */
-	vortex_mutex_lock (&_ctx->ref_mutex);
-
 	/* do sanity check */
-	if (_ctx->ref_count <= 0) {
-		vortex_mutex_unlock (&_ctx->ref_mutex);
-
+	if (vortex_atomic_get (&_ctx->ref_count) <= 0) {
 		_vortex_log (NULL, __AXL_FILE__, __AXL_LINE__, VORTEX_LEVEL_CRITICAL, "attempting to unref VortexCtx %p object more times than references supported", _ctx);
 		/* nullify */
 		(*ctx) = NULL;
 		return;
 	}
 
-	nullify =  (_ctx->ref_count == 1);
-	vortex_mutex_unlock (&_ctx->ref_mutex);
+	/* check if we have to nullify after unref */
+	nullify =  (vortex_atomic_get (&_ctx->ref_count) == 1);
 
 	/* call to unref */
 	vortex_ctx_free2 (*ctx, who);
@@ -781,19 +789,16 @@ void        vortex_ctx_free (VortexCtx * ctx)
  */
 void        vortex_ctx_free2 (VortexCtx * ctx, const char * who)
 {
+	int count;
+
 	/* do nothing */
 	if (ctx == NULL)
 		return;
 
-	/* acquire the mutex */
-	vortex_mutex_lock (&ctx->ref_mutex);
-	ctx->ref_count--;
-
-	if (ctx->ref_count != 0) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "%s: decreased references to VortexCtx %p (refs: %d)", who, ctx, ctx->ref_count);
-
-		/* release mutex */
-		vortex_mutex_unlock (&ctx->ref_mutex);
+	/* update reference counting */
+	count = vortex_atomic_add (&ctx->ref_count, -1);
+	if (count != 0) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "%s: decreased references to VortexCtx %p (refs: %d)", who, ctx, count);
 		return;
 	} /* end if */
 
@@ -801,13 +806,17 @@ void        vortex_ctx_free2 (VortexCtx * ctx, const char * who)
 	vortex_hash_destroy (ctx->data);
 	ctx->data = NULL;
 
+	/* release frames and buffers cached */
+	vortex_frame_pool_cleanup (ctx);
+	vortex_mutex_destroy (&ctx->frame_pool_mutex);
+	vortex_mutex_destroy (&ctx->channel_autotune_mutex);
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "finishing VortexCtx %p", ctx);
 
 	/* release log mutex */
 	vortex_mutex_destroy (&ctx->log_mutex);
 	
 	/* release and clean mutex */
-	vortex_mutex_unlock (&ctx->ref_mutex);
 	vortex_mutex_destroy (&ctx->ref_mutex);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "about.to.free VortexCtx %p", ctx);
@@ -841,6 +850,38 @@ void        __vortex_ctx_set_cleanup (VortexCtx * ctx)
 	return;
 }
 
+/** 
+ * @internal Refreshes the coarse clock kept by the context. Called
+ * by reader threads once per loop iteration (the reader wakes up at
+ * least once per second).
+ *
+ * @return The current time, in seconds.
+ */
+long        __vortex_ctx_update_coarse_time (VortexCtx * ctx)
+{
+	long now = (long) time (NULL);
+
+	if (ctx == NULL)
+		return now;
+	if (vortex_atomic_get_long (&ctx->coarse_time) != now)
+		vortex_atomic_set_long (&ctx->coarse_time, now);
+	return now;
+}
+
+/** 
+ * @internal Returns the coarse clock kept by the context (see
+ * __vortex_ctx_update_coarse_time), falling back to time () when no
+ * reader has refreshed it yet.
+ */
+long        __vortex_ctx_get_coarse_time (VortexCtx * ctx)
+{
+	long now = ctx ? vortex_atomic_get_long (&ctx->coarse_time) : 0;
+
+	if (now == 0)
+		now = __vortex_ctx_update_coarse_time (ctx);
+	return now;
+}
+
 /** 
  * @}
  */
@@ -131,6 +131,10 @@ void        vortex_ctx_reinit (VortexCtx * ctx);
 
 void        __vortex_ctx_set_cleanup (VortexCtx * ctx);
 
+long        __vortex_ctx_update_coarse_time (VortexCtx * ctx);
+
+long        __vortex_ctx_get_coarse_time (VortexCtx * ctx);
+
 END_C_DECLS
 
 #endif /* __VORTEX_CTX_H__ */
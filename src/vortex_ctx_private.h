@@ -43,7 +43,22 @@
 #include <axl.h>
 #include <vortex.h>
 
+/** 
+ * @internal Number of size classes used by the frame pool to cache
+ * payload buffers (64 << class bytes).
+ */
+#define VORTEX_FRAME_POOL_CLASSES 12
+
+/** 
+ * @internal State of a vortex sequencer thread. The sequencer runs
+ * one thread per state, each one handling channels of its own set of
+ * connections (selected by connection id) so frames of a connection
+ * are always built and written in order by the same thread.
+ */
 typedef struct _VortexSequencerState {
+	VortexCtx     * ctx;
+	int             id;
+
 	axlHash       * ready;
 	axlHashCursor * ready_cursor;
 
@@ -51,8 +66,86 @@ typedef struct _VortexSequencerState {
 	VortexCond      cond;
 
 	axl_bool        exit;
+
+	/* write batching: frames built during a sequencer round are
+	 * joined per connection and flushed with a single write
+	 * (VortexConnection -> VortexSequencerBatch). Only used by
+	 * the sequencer thread. */
+	axlHash       * batches;
+
+	/* buffers used to build frames to be sent (and their
+	 * associated sizes) */
+	char          * send_buffer;
+	int             send_buffer_size;
+	char          * feeder_buffer;
+	int             feeder_buffer_size;
+
+	/* thread running this state */
+	VortexThread    thread;
 } VortexSequencerState;
 
+/** 
+ * @internal Frames pending to be written on a connection, joined by
+ * the sequencer to be flushed with a single write operation.
+ */
+typedef struct _VortexSequencerBatch {
+	VortexConnection        * conn;
+	char                    * buffer;
+	int                       buffer_size;
+	int                       size;
+	/* when the first frame was placed in the batch */
+	struct timeval            stamp;
+	/* replies to be signaled as sent once flushed */
+	axlList                 * replies;
+} VortexSequencerBatch;
+
+/** 
+ * @internal State of a vortex reader thread. The reader runs one
+ * thread per shard, each one watching its own set of connections
+ * with its own I/O waiting group. Shard 0 is the main reader: it also
+ * watches listeners.
+ */
+typedef struct _VortexReaderShard {
+	VortexCtx               * ctx;
+	int                       id;
+
+	VortexAsyncQueue        * queue;
+	VortexAsyncQueue        * stopped;
+	axlPointer                on_reading;
+	axlList                 * conn_list;
+	axlList                 * srv_list;
+	axlListCursor           * conn_cursor;
+	axlListCursor           * srv_cursor;
+	/* connections and listeners in conn_list and srv_list, read
+	 * by other threads (only accessed through vortex_atomic_*) */
+	int                       watched;
+
+	/* incremental I/O waiting mode: sockets are kept in
+	 * on_reading between waits and the set is only reviewed
+	 * when requested (review) or once per second (last_review) */
+	axl_bool                  incremental;
+	axl_bool                  review;
+	long                      last_review;
+
+	/* connections with complete frames pending to be processed
+	 * (flagged with reader_backlog) */
+	axl_bool                  backlog;
+
+	/* pipe used to wake up the thread while it is blocked
+	 * waiting (see __vortex_reader_review): wake_added tells if
+	 * the read end is already registered into an incremental
+	 * on_reading and wake_pending (only accessed through
+	 * vortex_atomic_*) avoids filling the pipe */
+	VORTEX_SOCKET             wake[2];
+	axl_bool                  wake_added;
+	int                       wake_pending;
+
+	/** 
+	 * @internal Reference to the thread created for this shard.
+	 */
+	VortexThread              thread;
+} VortexReaderShard;
+
 struct _VortexCtx {
 
 	VortexMutex          ref_mutex;
@@ -70,8 +163,6 @@ struct _VortexCtx {
 	axl_bool             vortex_initialized;
 
 	/* global mutex */
-	VortexMutex          frame_id_mutex;
-	VortexMutex          connection_id_mutex;
 	VortexMutex          search_path_mutex;
 	VortexMutex          exit_mutex;
 	VortexMutex          listener_mutex;
@@ -165,7 +256,7 @@ struct _VortexCtx {
 	 * @internal
 	 * @brief A connection identifier (for internal vortex use).
 	 */
-	long                 connection_id;
+	int                  connection_id;
 	axl_bool             connection_enable_sanity_check;
 
 	/**
@@ -200,16 +291,32 @@ struct _VortexCtx {
 	/** 
 	 * @internal
 	 *
-	 * Internal variables (frame_id and frame_id_mutex) to make frame
-	 * identification for the on going process. This allows to check if
-	 * two frames are equal or to track which frames are not properly
-	 * released by the Vortex Library.
+	 * Internal variable (frame_id, updated atomically) to make
+	 * frame identification for the on going process. This allows
+	 * to check if two frames are equal or to track which frames
+	 * are not properly released by the Vortex Library.
 	 *
 	 * Frames are generated calling to __vortex_frame_get_next_id. Thus,
 	 * every frame created while the running process is alive have a
 	 * different frame unique identifier. 
 	 */
-	long                frame_id;
+	int                 frame_id;
+
+	/** 
+	 * @internal Frame pool: VortexFrame structs and payload
+	 * buffers (by size class, from 64 bytes up to 128KB)
+	 * released, kept to be reused by next frames created. Up to
+	 * frame_pool_limit items are cached on each list (see
+	 * VORTEX_FRAME_POOL_LIMIT). Protected by frame_pool_mutex.
+	 */
+	VortexMutex         frame_pool_mutex;
+	int                 frame_pool_limit;
+	axlPointer          frame_pool_frames;
+	int                 frame_pool_frames_num;
+	axlPointer          frame_pool_buffers[VORTEX_FRAME_POOL_CLASSES];
+	int                 frame_pool_buffers_num[VORTEX_FRAME_POOL_CLASSES];
+	long                frame_pool_reused;
+	long                frame_pool_allocated;
 
 	/**** vortex profiles module state ****/
 	VortexHash        * registered_profiles;
@@ -222,6 +329,7 @@ struct _VortexCtx {
 	VortexIoClearFdGroup   waiting_clear;
 	VortexIoWaitOnFdGroup  waiting_wait_on;
 	VortexIoAddToFdGroup   waiting_add_to;
+	VortexIoRemoveFromFdGroup waiting_remove_from;
 	VortexIoIsSetFdGroup   waiting_is_set;
 	VortexIoHaveDispatch   waiting_have_dispatch;
 	VortexIoDispatch       waiting_dispatch;
@@ -232,27 +340,24 @@ struct _VortexCtx {
 	axlDtd               * xml_rpc_boot_dtd;
 
 	/**** vortex reader module state ****/
-	VortexAsyncQueue        * reader_queue;
-	VortexAsyncQueue        * reader_stopped;
-	axlPointer                on_reading;
-	axlList                 * conn_list;
-	axlList                 * srv_list;
-	axlListCursor           * conn_cursor;
-	axlListCursor           * srv_cursor;
+	/* @internal Reader threads running (reader_shards_num) and
+	 * the number requested for the next start (reader_threads,
+	 * see VORTEX_READER_THREADS) */
+	VortexReaderShard      ** reader_shards;
+	int                       reader_shards_num;
+	int                       reader_threads;
+	/* @internal Max frames processed from a connection on each
+	 * readiness event (see VORTEX_READER_FRAME_BUDGET) */
+	int                       reader_frame_budget;
+	/* @internal Coarse clock (seconds) refreshed by reader
+	 * threads once per loop iteration, used to stamp connection
+	 * activity without calling time () on every read */
+	long                      coarse_time;
 	/* the following flag is used to detecte vortex
 	   reinitialization escenarios where it is required to release
 	   memory but without perform all release operatios like mutex
 	   locks */
 	axl_bool                  reader_cleanup;
-	
-	/** 
-	 * @internal Reference to the thread created for the reader loop.
-	 */
-	VortexThread              reader_thread;
-
-	/* @internal Buffer used to produce the SEQ frame generated by
-	 * the vortex reader */
-	char                      reader_seq_frame[50];
 
 	/**** vortex pull module ****/
 	VortexAsyncQueue        * pull_pending_events;
@@ -261,17 +366,34 @@ struct _VortexCtx {
 	axlList                 * support_search_path;
 
 	/**** vortex sequender module state ****/
-	VortexSequencerState    * sequencer_state;
-	/* @internal Definition for the thread created for the sequencer.
-	 */
-	VortexThread              sequencer_thread;
-
-	/* @internal buffer used by the sequencer to build frames to
-	 * be sent (and its associated size). */
-	char                    * sequencer_send_buffer;
-	int                       sequencer_send_buffer_size;
-	char                    * sequencer_feeder_buffer;
-	int                       sequencer_feeder_buffer_size;
+	/* @internal Sequencer threads running (sequencer_states_num)
+	 * and the number requested for the next start
+	 * (sequencer_threads, see VORTEX_SEQUENCER_THREADS) */
+	VortexSequencerState   ** sequencer_states;
+	int                       sequencer_states_num;
+	int                       sequencer_threads;
+	/* @internal write batching configuration (see
+	 * VORTEX_SEQUENCER_FLUSH_SIZE and
+	 * VORTEX_SEQUENCER_FLUSH_LATENCY) */
+	int                       sequencer_flush_size;
+	int                       sequencer_flush_latency;
+
+	/* @internal asynchronous writes (see VORTEX_ASYNC_WRITES):
+	 * content that can't be written without blocking is queued
+	 * on its connection and written by the output thread once
+	 * the socket is writable. output_conns holds connections
+	 * with output queued (protected by output_mutex).
+	 * output_wake is the pipe used to wake up the output thread
+	 * while it waits for sockets to be writable. */
+	axl_bool                  async_writes;
+	int                       output_high_water_mark;
+	axl_bool                  output_running;
+	axl_bool                  output_exit;
+	VortexThread              output_thread;
+	VortexMutex               output_mutex;
+	VortexCond                output_cond;
+	axlList                 * output_conns;
+	VORTEX_SOCKET             output_wake[2];
 
 	/**** vortex thread pool module state ****/
 	/** 
@@ -280,6 +402,12 @@ struct _VortexCtx {
 	axl_bool                  thread_pool_exclusive;
 	VortexThreadPool *        thread_pool;
 	axl_bool                  thread_pool_being_stopped;
+	/** 
+	 * @internal Thread pool work stealing and CPU affinity (see
+	 * VORTEX_THREAD_POOL_WORK_STEALING), used at pool init.
+	 */
+	axl_bool                  thread_pool_work_stealing;
+	axl_bool                  thread_pool_cpu_affinity;
 
 	/**** vortex greetings module state ****/
 	char                    * greetings_features;
@@ -295,6 +423,21 @@ struct _VortexCtx {
 	 * server side */
 	char                    * listener_default_realm;
 
+	/* @internal Listening sockets opened per listener with
+	 * SO_REUSEPORT (see VORTEX_LISTENER_REUSEPORT) */
+	int                       listener_reuseport;
+
+	/* @internal Channel window and frame size autotuning (see
+	 * VORTEX_CHANNEL_AUTOTUNE). channel_autotune_used tracks the
+	 * bytes channels have grown their windows, protected by
+	 * channel_autotune_mutex. */
+	axl_bool                  channel_autotune;
+	int                       channel_autotune_max_window;
+	int                       channel_autotune_memory;
+	int                       channel_autotune_max_frame_size;
+	int                       channel_autotune_used;
+	VortexMutex               channel_autotune_mutex;
+
 	/** 
 	 * @internal Handler used to decide how to split frames.
 	 */
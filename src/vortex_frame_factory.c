@@ -41,6 +41,11 @@
 #include <vortex_ctx_private.h>
 #include <vortex_connection_private.h>
 
+#if defined(AXL_OS_UNIX) && defined(__linux__)
+# include <sys/sendfile.h>
+# include <netinet/tcp.h>
+#endif
+
 #define LOG_DOMAIN "vortex-frame-factory"
 
 /** 
@@ -95,9 +100,8 @@ typedef struct _VortexMimeStatus {
 	/* headers count */
 	int                counting;
 	
-	/* ref counting */
+	/* ref counting (updated atomically) */
 	int                ref_count;
-	VortexMutex        ref_mutex;
 } VortexMimeStatus;
 
 /** 
@@ -128,7 +132,6 @@ VortexMimeStatus * vortex_frame_mime_status_new (void)
 	} /* end if */
 
 	/* init reference counting */
-	vortex_mutex_create (&status->ref_mutex);
 	status->ref_count = 1;
 
 	return status;
@@ -143,9 +146,7 @@ void vortex_frame_mime_status_ref (VortexMimeStatus * status)
 {
 	if (status == NULL)
 		return;
-	vortex_mutex_lock (&status->ref_mutex);
-	status->ref_count ++;
-	vortex_mutex_unlock (&status->ref_mutex);
+	vortex_atomic_add (&status->ref_count, 1);
 	return;
 }
 
@@ -155,20 +156,15 @@ void vortex_frame_mime_status_free (VortexMimeStatus * status)
 		return;
 
 	/* check reference counting */
-	vortex_mutex_lock (&status->ref_mutex);
-	status->ref_count--;
-	if (status->ref_count != 0) {
+	if (vortex_atomic_add (&status->ref_count, -1) != 0) {
 		/* this caller won't terminate this mime status */
-		vortex_mutex_unlock (&status->ref_mutex);
 		return;
 	}
-	vortex_mutex_unlock (&status->ref_mutex);
 
 	/* free factories */
 	axl_string_factory_free (status->mime_headers_name);
 	axl_string_factory_free (status->mime_headers_content);
 	axl_factory_free        (status->header_factory);
-	vortex_mutex_destroy    (&status->ref_mutex);
 	axl_free (status);
 
 	return;
@@ -275,6 +271,11 @@ struct _VortexFrame {
 	 * be shared with other frames, mostly due to
 	 * vortex_frame_copy and vortex_frame_join* functions */
 	VortexMimeStatus   * mime_headers;
+
+	/* frame pool size class of the memory holding the payload
+	 * (buffer, content or payload, in that order), or -1 if it
+	 * was not allocated from the pool */
+	int                  pool_class;
 };
 
 /** 
@@ -292,18 +293,172 @@ int  __vortex_frame_get_next_id (VortexCtx * ctx, char  * from)
 	/* get current context */
 	int         result;
 
-	vortex_mutex_lock (&ctx->frame_id_mutex);
-	
-	result = ctx->frame_id;
-	ctx->frame_id++;
+	/* get next id without locking */
+	result = vortex_atomic_add (&ctx->frame_id, 1) - 1;
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "Created frame id=%d", result);
 
-	vortex_mutex_unlock (&ctx->frame_id_mutex);
-
 	return result;
 }
 
+/** 
+ * @internal Returns the frame pool size class for a buffer of the
+ * provided size or -1 if it is too large to be cached.
+ */
+int __vortex_frame_pool_class (int size)
+{
+	int pool_class = 0;
+
+	while (pool_class < VORTEX_FRAME_POOL_CLASSES) {
+		if (size <= (64 << pool_class))
+			return pool_class;
+		pool_class++;
+	} /* end while */
+
+	return -1;
+}
+
+/** 
+ * @internal Allocates a new frame (all fields cleared), reusing a
+ * frame from the context pool if available.
+ */
+VortexFrame * __vortex_frame_pool_new_frame (VortexCtx * ctx)
+{
+	VortexFrame * frame = NULL;
+
+	vortex_mutex_lock (&ctx->frame_pool_mutex);
+	if (ctx->frame_pool_frames != NULL) {
+		/* frames cached are linked through their payload */
+		frame                  = ctx->frame_pool_frames;
+		ctx->frame_pool_frames = frame->payload;
+		ctx->frame_pool_frames_num--;
+		ctx->frame_pool_reused++;
+	} else
+		ctx->frame_pool_allocated++;
+	vortex_mutex_unlock (&ctx->frame_pool_mutex);
+
+	if (frame == NULL)
+		frame = axl_new (VortexFrame, 1);
+	else
+		memset (frame, 0, sizeof (VortexFrame));
+	if (frame != NULL)
+		frame->pool_class = -1;
+
+	return frame;
+}
+
+/** 
+ * @internal Allocates a buffer of at least size bytes, reusing a
+ * buffer from the context pool if available. The buffer content is
+ * not initialized.
+ *
+ * @param pool_class Reference where the size class of the buffer is
+ * returned (-1 if it can't be returned to the pool).
+ */
+char * __vortex_frame_pool_new_buffer (VortexCtx * ctx, int size, int * pool_class)
+{
+	char * buffer = NULL;
+
+	(* pool_class) = __vortex_frame_pool_class (size);
+	if ((* pool_class) < 0 || ctx->frame_pool_limit <= 0) {
+		(* pool_class) = -1;
+		return malloc (size);
+	} /* end if */
+
+	vortex_mutex_lock (&ctx->frame_pool_mutex);
+	if (ctx->frame_pool_buffers[*pool_class] != NULL) {
+		/* buffers cached are linked through their first bytes */
+		buffer                                   = ctx->frame_pool_buffers[*pool_class];
+		ctx->frame_pool_buffers[*pool_class]     = *((axlPointer *) buffer);
+		ctx->frame_pool_buffers_num[*pool_class]--;
+		ctx->frame_pool_reused++;
+	} else
+		ctx->frame_pool_allocated++;
+	vortex_mutex_unlock (&ctx->frame_pool_mutex);
+
+	if (buffer == NULL)
+		buffer = malloc (64 << (* pool_class));
+
+	return buffer;
+}
+
+/** 
+ * @internal Returns the buffer provided to the context pool (or
+ * releases it if the pool is full or it has no size class).
+ */
+void __vortex_frame_pool_release_buffer (VortexCtx * ctx, axlPointer buffer, int pool_class)
+{
+	if (buffer == NULL)
+		return;
+
+	if (ctx != NULL && pool_class >= 0 && pool_class < VORTEX_FRAME_POOL_CLASSES) {
+		vortex_mutex_lock (&ctx->frame_pool_mutex);
+		if (ctx->frame_pool_buffers_num[pool_class] < ctx->frame_pool_limit) {
+			*((axlPointer *) buffer)                = ctx->frame_pool_buffers[pool_class];
+			ctx->frame_pool_buffers[pool_class]     = buffer;
+			ctx->frame_pool_buffers_num[pool_class]++;
+			buffer                                  = NULL;
+		} /* end if */
+		vortex_mutex_unlock (&ctx->frame_pool_mutex);
+	} /* end if */
+
+	axl_free (buffer);
+	return;
+}
+
+/** 
+ * @internal Returns the frame provided to the context pool (or
+ * releases it if the pool is full).
+ */
+void __vortex_frame_pool_release_frame (VortexCtx * ctx, VortexFrame * frame)
+{
+	if (ctx != NULL) {
+		vortex_mutex_lock (&ctx->frame_pool_mutex);
+		if (ctx->frame_pool_frames_num < ctx->frame_pool_limit) {
+			frame->payload         = ctx->frame_pool_frames;
+			ctx->frame_pool_frames = frame;
+			ctx->frame_pool_frames_num++;
+			frame                  = NULL;
+		} /* end if */
+		vortex_mutex_unlock (&ctx->frame_pool_mutex);
+	} /* end if */
+
+	axl_free (frame);
+	return;
+}
+
+/** 
+ * @internal Releases all frames and buffers cached by the context
+ * pool. Called once the context is finished.
+ */
+void          vortex_frame_pool_cleanup (VortexCtx * ctx)
+{
+	VortexFrame * frame;
+	axlPointer    buffer;
+	int           iterator;
+
+	if (ctx == NULL)
+		return;
+
+	while (ctx->frame_pool_frames != NULL) {
+		frame                  = ctx->frame_pool_frames;
+		ctx->frame_pool_frames = frame->payload;
+		axl_free (frame);
+	} /* end while */
+	ctx->frame_pool_frames_num = 0;
+
+	for (iterator = 0; iterator < VORTEX_FRAME_POOL_CLASSES; iterator++) {
+		while (ctx->frame_pool_buffers[iterator] != NULL) {
+			buffer                           = ctx->frame_pool_buffers[iterator];
+			ctx->frame_pool_buffers[iterator] = *((axlPointer *) buffer);
+			axl_free (buffer);
+		} /* end while */
+		ctx->frame_pool_buffers_num[iterator] = 0;
+	} /* end for */
+
+	return;
+}
+
 /**
  * \defgroup vortex_frame Vortex Frame Factory: Function to manipulate frames inside Vortex Library
  */
@@ -1029,7 +1184,7 @@ VortexFrame * vortex_frame_create_full          (VortexCtx       * ctx,
 		return NULL;
 
 	/* build base object */
-	result = axl_new (VortexFrame, 1);
+	result = __vortex_frame_pool_new_frame (ctx);
 	VORTEX_CHECK_REF (result, NULL);
 
 	/* acquire a reference to the context */
@@ -1047,9 +1202,10 @@ VortexFrame * vortex_frame_create_full          (VortexCtx       * ctx,
 
 	/* copy the payload */
 	if (size > 0 && payload != NULL) {
-		result->payload           = axl_new (char , size + 1);
+		result->payload           = __vortex_frame_pool_new_buffer (ctx, size + 1, &result->pool_class);
 		VORTEX_CHECK_REF2 (result->payload, NULL, result, axl_free);
 		memcpy (result->payload, payload, size);
+		((char *) result->payload)[size] = 0;
 	}
 
 	/* copy content type */
@@ -1128,7 +1284,7 @@ VortexFrame * vortex_frame_create_full_ref      (VortexCtx       * ctx,
 		return NULL;
 
 	/* create base object */
-	result = axl_new (VortexFrame, 1);
+	result = __vortex_frame_pool_new_frame (ctx);
 	VORTEX_CHECK_REF (result, NULL);
 
 	/* acquire a reference to the context */
@@ -1240,9 +1396,177 @@ VortexFrame * vortex_frame_copy                 (VortexFrame      * frame)
 	return result;
 }
 
+/** 
+ * @internal Moves into the provided buffer up to maxlen octets
+ * already read from the transport and stored on the connection
+ * input buffer.
+ *
+ * @return Number of octets moved (0 when nothing is pending).
+ */
+int         __vortex_frame_take_input (VortexConnection * connection, char * buffer, int maxlen)
+{
+	int size;
+
+	if (connection->input_buffer == NULL)
+		return 0;
+
+	size = connection->input_end - connection->input_start;
+	if (size <= 0)
+		return 0;
+	if (size > maxlen)
+		size = maxlen;
+
+	memcpy (buffer, connection->input_buffer + connection->input_start, size);
+	connection->input_start += size;
+
+	/* reset positions once everything was consumed */
+	if (connection->input_start == connection->input_end) {
+		connection->input_start = 0;
+		connection->input_end   = 0;
+	} /* end if */
+
+	return size;
+}
+
+/** 
+ * @brief Returns the amount of octets already read from the
+ * transport and held by the connection, which are returned first by
+ * \ref vortex_frame_receive_raw. Code reading from the connection
+ * socket directly must check it first.
+ *
+ * @param connection The connection to check.
+ *
+ * @return Octets pending to be read (0 if none or NULL is received).
+ */
+int         vortex_frame_input_pending (VortexConnection * connection)
+{
+	if (connection == NULL || connection->input_buffer == NULL)
+		return 0;
+	return connection->input_end - connection->input_start;
+}
+
+/** 
+ * @internal Reads as much content as possible from the transport
+ * (with a single receive operation) into the connection input
+ * buffer, compacting pending content first.
+ *
+ * @return Same values as \ref vortex_connection_invoke_receive,
+ * that is, octets read, 0 if the remote peer have closed, -1 on
+ * error, -2 if no data is available. -1 is also returned in the case
+ * the buffer is already full.
+ */
+int         __vortex_frame_fill_input (VortexConnection * connection)
+{
+	int size;
+	int rc;
+
+	/* allocate buffer on first use */
+	if (connection->input_buffer == NULL) {
+		connection->input_buffer = axl_new (char, VORTEX_FRAME_INPUT_BUFFER_SIZE + 1);
+		if (connection->input_buffer == NULL)
+			return -1;
+		connection->input_start  = 0;
+		connection->input_end    = 0;
+	} /* end if */
+
+	/* move pending content to the beginning */
+	if (connection->input_start > 0) {
+		size = connection->input_end - connection->input_start;
+		if (size > 0)
+			memmove (connection->input_buffer, connection->input_buffer + connection->input_start, size);
+		connection->input_start = 0;
+		connection->input_end   = size;
+	} /* end if */
+
+	if (connection->input_end >= VORTEX_FRAME_INPUT_BUFFER_SIZE)
+		return -1;
+
+ __vortex_frame_fill_input_again:
+	rc = vortex_connection_invoke_receive (connection, 
+					       connection->input_buffer + connection->input_end, 
+					       VORTEX_FRAME_INPUT_BUFFER_SIZE - connection->input_end);
+	if (rc == VORTEX_SOCKET_ERROR && errno == VORTEX_EINTR)
+		goto __vortex_frame_fill_input_again;
+
+	if (rc > 0) {
+		connection->input_end += rc;
+
+		/* notify here frame received (content received) */
+		vortex_connection_set_receive_stamp (connection, (long) rc, 0);
+	} /* end if */
+
+	return rc;
+}
+
+/** 
+ * @internal Allows to check if the connection input buffer holds a
+ * complete frame (header, payload and trailer) so it can be
+ * processed without waiting for the transport to be ready again.
+ *
+ * The function only looks for the frame size declared at the header
+ * and returns axl_true for a header that cannot be understood,
+ * letting \ref vortex_frame_get_next to report the error.
+ *
+ * @param connection The connection to check.
+ *
+ * @return axl_true if a complete frame is pending, otherwise axl_false.
+ */
+axl_bool    __vortex_frame_input_has_frame (VortexConnection * connection)
+{
+	char * line;
+	char * eol;
+	int    available;
+	int    line_size;
+	int    iterator;
+	int    field;
+	int    size;
+
+	if (connection->input_buffer == NULL || connection->buffer != NULL)
+		return axl_false;
+
+	available = connection->input_end - connection->input_start;
+	if (available <= 0)
+		return axl_false;
+
+	/* check for a complete header line */
+	line = connection->input_buffer + connection->input_start;
+	eol  = memchr (line, '\x0A', available);
+	if (eol == NULL)
+		return axl_false;
+	line_size = (eol - line) + 1;
+
+	/* SEQ frames have no payload */
+	if (line_size > 3 && axl_memcmp (line, "SEQ", 3))
+		return axl_true;
+
+	/* skip type, channel, msgno, more and seqno to get size */
+	iterator = 0;
+	for (field = 0; field < 5; field++) {
+		while (iterator < line_size && line[iterator] != ' ')
+			iterator++;
+		iterator++;
+	} /* end for */
+
+	size = 0;
+	while (iterator < line_size && line[iterator] >= '0' && line[iterator] <= '9') {
+		size = (size * 10) + (line[iterator] - '0');
+		if (size > VORTEX_MAX_BUFFER_SIZE)
+			return axl_true;
+		iterator++;
+	} /* end while */
+
+	return (available - line_size) >= (size + 5);
+}
+
 /** 
  * @internal
  * @brief reads n bytes from the connection.
+ *
+ * Content already read from the transport and stored on the
+ * connection input buffer is returned first. Small requests are
+ * served reading a whole chunk into the input buffer so following
+ * frames come with the same receive operation, while big ones are
+ * read directly into the provided buffer.
  * 
  * @param connection the connection to read data.
  * @param buffer buffer to hold data.
@@ -1253,6 +1577,7 @@ VortexFrame * vortex_frame_copy                 (VortexFrame      * frame)
 int         vortex_frame_receive_raw  (VortexConnection * connection, char  * buffer, int  maxlen)
 {
 	int         nread;
+	int         rc;
 #if defined(ENABLE_VORTEX_LOG)
 	char      * error_msg;
 #endif
@@ -1264,16 +1589,26 @@ int         vortex_frame_receive_raw  (VortexConnection * connection, char  * bu
 	if (connection->session == -1)
 		return -1;
 
+	/* first serve content already read */
+	nread = __vortex_frame_take_input (connection, buffer, maxlen);
+	if (nread == maxlen)
+		goto __vortex_frame_readn_end;
+
+	/* small request, read into the input buffer */
+	if ((maxlen - nread) < (VORTEX_FRAME_INPUT_BUFFER_SIZE / 2)) {
+		if (__vortex_frame_fill_input (connection) > 0) 
+			nread += __vortex_frame_take_input (connection, buffer + nread, maxlen - nread);
+		goto __vortex_frame_readn_end;
+	} /* end if */
+
  __vortex_frame_readn_keep_reading:
 	/* clear buffer */
 	/* memset (buffer, 0, maxlen * sizeof (char )); */
-	if ((nread = vortex_connection_invoke_receive (connection, buffer, maxlen)) == VORTEX_SOCKET_ERROR) {
-		if (errno == VORTEX_EAGAIN) {
-			return 0;
-		}
-		if (errno == VORTEX_EWOULDBLOCK) {
-			return 0;
-		}
+	if ((rc = vortex_connection_invoke_receive (connection, buffer + nread, maxlen - nread)) == VORTEX_SOCKET_ERROR) {
+		if (errno == VORTEX_EAGAIN) 
+			goto __vortex_frame_readn_end;
+		if (errno == VORTEX_EWOULDBLOCK) 
+			goto __vortex_frame_readn_end;
 		if (errno == VORTEX_EINTR)
 			goto __vortex_frame_readn_keep_reading;
 		
@@ -1286,11 +1621,13 @@ int         vortex_frame_receive_raw  (VortexConnection * connection, char  * bu
 #endif
 	}
 
-	if (nread > 0) {
+	if (rc > 0) {
 		/* notify here frame received (content received) */
-		vortex_connection_set_receive_stamp (connection, (long) nread, 0);
+		vortex_connection_set_receive_stamp (connection, (long) rc, 0);
+		nread += rc;
 	}
 
+ __vortex_frame_readn_end:
 	/* ensure we don't access outside the array */
 	if (nread < 0) 
 		nread = 0;
@@ -1300,9 +1637,15 @@ int         vortex_frame_receive_raw  (VortexConnection * connection, char  * bu
 }
 
 /**
- * @brief Read the next line, byte by byte until it gets a \n or
- * maxlen is reached. Some code errors are used to manage exceptions
- * (see return values)
+ * @brief Read the next line until it gets a \n or maxlen is
+ * reached. Some code errors are used to manage exceptions (see
+ * return values)
+ *
+ * Content is read from the transport in chunks into the connection
+ * input buffer and the line is then taken from it. Content read
+ * beyond the line is kept on the connection and returned by
+ * following calls to this function, \ref vortex_frame_receive_raw or
+ * \ref vortex_frame_get_next.
  * 
  * @param connection The connection where the read operation will be done.
  *
@@ -1319,9 +1662,9 @@ int         vortex_frame_receive_raw  (VortexConnection * connection, char  * bu
  **/
 int          vortex_frame_readline (VortexConnection * connection, char  * buffer, int  maxlen)
 {
-	int         n, rc;
-	int         desp;
-	char        c, *ptr;
+	int         rc;
+	int         size = 0;
+	char      * eol;
 #if defined(ENABLE_VORTEX_LOG)
 	char      * error_msg;
 #endif
@@ -1333,79 +1676,61 @@ int          vortex_frame_readline (VortexConnection * connection, char  * buffe
 	if (connection->session == -1)
 		return -1;
 
-	/* clear the buffer received */
-	/* memset (buffer, 0, maxlen * sizeof (char ));  */
+	while (axl_true) {
+		/* check for a line already read */
+		if (connection->input_buffer) {
+			size = connection->input_end - connection->input_start;
+			if (size > 0) {
+				eol = memchr (connection->input_buffer + connection->input_start, '\x0A', size);
+				if (eol != NULL) {
+					size = (eol - (connection->input_buffer + connection->input_start)) + 1;
+					break;
+				} /* end if */
 
-	/* check for pending line read */
-	desp         = 0;
-	if (connection->pending_line) {
-		/* get size and check exceeded values */
-		desp = strlen (connection->pending_line);
-		if (desp >= maxlen) {
-			__vortex_connection_shutdown_and_record_error (
-				connection, VortexProtocolError,
-				"found fragmented frame line header but allowed size was exceeded (desp:%d >= maxlen:%d)",
-				desp, maxlen);
-			return -1;
+				/* line bigger than allowed, return
+				 * what fits (caller will find no line
+				 * terminator) */
+				if (size >= (maxlen - 1) || size >= VORTEX_FRAME_INPUT_BUFFER_SIZE)
+					break;
+			} /* end if */
 		} /* end if */
 
-		/* now store content into the buffer */
-		memcpy (buffer, connection->pending_line, desp);
-
-		/* clear from the connection the line */
-		axl_free (connection->pending_line);
-		connection->pending_line = NULL;
-	}
-
-
-	/* read current next line */
-	ptr = (buffer + desp);
-	for (n = 1; n < (maxlen - desp); n++) {
-	__vortex_frame_readline_again:
-		if (( rc = vortex_connection_invoke_receive (connection, &c, 1)) == 1) {
-			*ptr++ = c;
-			if (c == '\x0A')
-				break;
-		}else if (rc == 0) {
-			if (n == 1)
+		/* read next chunk */
+		rc = __vortex_frame_fill_input (connection);
+		if (rc > 0)
+			continue;
+		if (rc == 0) {
+			/* remote peer closed */
+			if (size == 0)
 				return 0;
-			else
-				break;
-		} else {
-			if (errno == VORTEX_EINTR) 
-				goto __vortex_frame_readline_again;
-			if ((errno == VORTEX_EWOULDBLOCK) || (errno == VORTEX_EAGAIN) || (rc == -2)) {
-				if (n > 0) {
-					/* store content read until now */
-					if ((n + desp - 1) > 0) {
-						buffer[n+desp - 1] = 0;
-						/* vortex_log (VORTEX_LEVEL_WARNING, "storing partially line read: '%s' n:%d, desp:%d", buffer, n, desp);*/
-						connection->pending_line = axl_strdup (buffer);
-					} /* end if */
-				} /* end if */
-				return (-2);
-			}
+			break;
+		} /* end if */
+
+		/* content read until now is kept on the input buffer */
+		if ((errno == VORTEX_EWOULDBLOCK) || (errno == VORTEX_EAGAIN) || (rc == -2)) 
+			return (-2);
 			
 #if defined(ENABLE_VORTEX_LOG)
-			/* if the connection is closed, just return
-			 * without logging a message */
-			if (vortex_connection_is_ok (connection, axl_false)) {
-				error_msg = vortex_errno_get_last_error ();
-				vortex_log (VORTEX_LEVEL_CRITICAL, "unable to read a line from conn-id=%d (socket %d, rc %d), error was: %s, remote IP %s",
-					    vortex_connection_get_id (connection), vortex_connection_get_socket (connection), rc,
-					    error_msg ? error_msg : "", vortex_connection_get_host_ip (connection));
-			}
-#endif
-			return (-1);
+		/* if the connection is closed, just return
+		 * without logging a message */
+		if (vortex_connection_is_ok (connection, axl_false)) {
+			error_msg = vortex_errno_get_last_error ();
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to read a line from conn-id=%d (socket %d, rc %d), error was: %s, remote IP %s",
+				    vortex_connection_get_id (connection), vortex_connection_get_socket (connection), rc,
+				    error_msg ? error_msg : "", vortex_connection_get_host_ip (connection));
 		}
-	}
-
-	/* notify here frame received (content received) */
-	vortex_connection_set_receive_stamp (connection, (long) (n + desp), 0);
+#endif
+		return (-1);
+	} /* end while */
 
-	*ptr = 0;
-	return (n + desp);
+	/* never return more than maxlen - 1 */
+	if (size > (maxlen - 1))
+		size = maxlen - 1;
 
+	/* move the line */
+	size = __vortex_frame_take_input (connection, buffer, size);
+	buffer[size] = 0;
+	return size;
 }
 
 int  get_int_value (VortexCtx * ctx, VortexConnection * conn, char  * string, int  * position)
@@ -1727,7 +2052,7 @@ VortexFrame * vortex_frame_get_next     (VortexConnection * connection)
 	}
 
 	/* create a frame */
-	frame       = axl_new (VortexFrame, 1);
+	frame       = __vortex_frame_pool_new_frame (ctx);
 	if (frame == NULL) {
 		__vortex_connection_shutdown_and_record_error (
 			connection, VortexMemoryFail, "Failed to allocate memory for frame");
@@ -1835,8 +2160,8 @@ VortexFrame * vortex_frame_get_next     (VortexConnection * connection)
 		return NULL;
 	}
 
-	/* allocate exactly frame->size + 5 bytes */
-	buffer = malloc (sizeof (char) * (frame->size + 6));
+	/* allocate (at least) frame->size + 5 bytes */
+	buffer = __vortex_frame_pool_new_buffer (ctx, sizeof (char) * (frame->size + 6), &frame->pool_class);
 	VORTEX_CHECK_REF2 (buffer, NULL, frame, axl_free);
 	
 	/* read the next frame content */
@@ -1923,6 +2248,447 @@ process_buffer:
 }
 
 
+/** 
+ * @internal Writes the provided pieces without blocking, starting at
+ * the piece and offset provided, which are updated to point to the
+ * first byte not written. Several pieces are written at once (writev)
+ * when the connection is using the default send handler.
+ *
+ * @return 0 if the content was written or the socket is not ready to
+ * write more content, -1 if an error was found.
+ */
+int __vortex_frame_write_nonblocking (VortexConnection  * connection,
+				      const char       ** pieces,
+				      int               * pieces_size,
+				      int                 pieces_num,
+				      int               * iterator,
+				      int               * offset)
+{
+	int            bytes;
+#if defined(AXL_OS_UNIX)
+	struct iovec   iov[VORTEX_WRITER_MAX_PIECES];
+	int            count;
+#endif
+
+	while ((*iterator) < pieces_num) {
+		/* skip empty pieces */
+		if (pieces_size[*iterator] <= (*offset)) {
+			(*iterator)++;
+			(*offset) = 0;
+			continue;
+		} /* end if */
+
+#if defined(AXL_OS_UNIX)
+		if ((pieces_num - (*iterator)) > 1 && pieces_num <= VORTEX_WRITER_MAX_PIECES && vortex_connection_is_default_send (connection)) {
+			/* several pieces pending: write them at once */
+			count = 0;
+			while (((*iterator) + count) < pieces_num) {
+				iov[count].iov_base = (void *) (pieces[(*iterator) + count] + (count == 0 ? (*offset) : 0));
+				iov[count].iov_len  = pieces_size[(*iterator) + count] - (count == 0 ? (*offset) : 0);
+				count++;
+			} /* end while */
+			bytes = writev (connection->session, iov, count);
+		} else
+#endif
+			bytes = vortex_connection_invoke_send (connection, pieces[*iterator] + (*offset), pieces_size[*iterator] - (*offset));
+
+		if (bytes < 0) {
+			if (errno == VORTEX_EINTR)
+				continue;
+			/* socket not ready: remaining content must wait */
+			if ((errno == VORTEX_EWOULDBLOCK) || (errno == VORTEX_EAGAIN) || (bytes == -2))
+				return 0;
+			return -1;
+		} /* end if */
+
+		/* remote peer closed */
+		if (bytes == 0)
+			return -1;
+
+		/* notify content written */
+		vortex_connection_set_receive_stamp (connection, 0, bytes);
+
+		/* skip content written */
+		bytes += (*offset);
+		while ((*iterator) < pieces_num && bytes >= pieces_size[*iterator]) {
+			bytes -= pieces_size[*iterator];
+			(*iterator)++;
+		} /* end while */
+		(*offset) = bytes;
+	} /* end while */
+
+	return 0;
+}
+
+/** 
+ * @internal Queues the provided content at the end of the connection
+ * output (asynchronous writes). Must be called holding output_mutex.
+ */
+axl_bool __vortex_frame_output_append (VortexConnection * connection, const char * content, int size)
+{
+	char * buffer;
+	int    buffer_size;
+
+	if (size <= 0)
+		return axl_true;
+
+	/* move pending content to the beginning */
+	if (connection->output_offset > 0) {
+		memmove (connection->output_buffer, connection->output_buffer + connection->output_offset, connection->output_size);
+		connection->output_offset = 0;
+	} /* end if */
+
+	/* check and increase buffer */
+	if ((connection->output_size + size) > connection->output_buffer_size) {
+		buffer_size = connection->output_buffer_size > 0 ? connection->output_buffer_size : 4096;
+		while (buffer_size < (connection->output_size + size))
+			buffer_size = buffer_size * 2;
+		buffer = axl_realloc (connection->output_buffer, buffer_size);
+		if (buffer == NULL)
+			return axl_false;
+		connection->output_buffer      = buffer;
+		connection->output_buffer_size = buffer_size;
+	} /* end if */
+
+	memcpy (connection->output_buffer + connection->output_size, content, size);
+	connection->output_size += size;
+
+	return axl_true;
+}
+
+/** 
+ * @internal Sends the provided pieces without blocking (asynchronous
+ * writes). Content that can't be written is queued on the connection
+ * to be written by the output thread once the socket is writable. If
+ * the connection already has content queued, the pieces are queued
+ * after it to keep order.
+ */
+axl_bool __vortex_frame_send_async (VortexConnection  * connection,
+				    const char       ** pieces,
+				    int               * pieces_size,
+				    int                 pieces_num)
+{
+	int          iterator = 0;
+	int          offset   = 0;
+	int          error    = 0;
+	axl_bool     watch    = axl_false;
+	axl_bool     result   = axl_true;
+
+	vortex_mutex_lock (&connection->output_mutex);
+
+	/* write directly only if nothing is queued */
+	if (connection->output_size == 0) {
+		if (__vortex_frame_write_nonblocking (connection, pieces, pieces_size, pieces_num, &iterator, &offset) < 0) {
+			error  = errno;
+			result = axl_false;
+		} /* end if */
+	} /* end if */
+
+	/* queue content not written */
+	while (result && iterator < pieces_num) {
+		if (! __vortex_frame_output_append (connection, pieces[iterator] + offset, pieces_size[iterator] - offset)) {
+			error  = ENOMEM;
+			result = axl_false;
+			break;
+		} /* end if */
+		offset = 0;
+		iterator++;
+	} /* end while */
+
+	/* check if the output thread must watch this connection */
+	if (result && connection->output_size > 0 && ! connection->output_watched) {
+		connection->output_watched = axl_true;
+		watch                      = axl_true;
+	} /* end if */
+
+	vortex_mutex_unlock (&connection->output_mutex);
+
+	if (! result) {
+		__vortex_connection_shutdown_and_record_error (
+			connection, VortexError, "unable to write data to socket: errno=%d (%s), socket=%d conn-id=%d, conn=%p",
+			error, vortex_errno_get_error (error), connection->session, connection->id, connection);
+		return axl_false;
+	} /* end if */
+
+	/* notify output thread */
+	if (watch)
+		vortex_sequencer_watch_output (vortex_connection_get_ctx (connection), connection);
+
+	return axl_true;
+}
+
+/** 
+ * @internal Writes (without blocking) content queued on the provided
+ * connection (asynchronous writes). Used by the output thread once
+ * the socket is writable.
+ *
+ * @param connection The connection to write.
+ *
+ * @param resume Reference where it is notified if the connection
+ * went below the high water mark after being blocked (so the
+ * sequencer must resume sending on its channels).
+ *
+ * @return axl_true if all content queued was written (or discarded
+ * because the connection is broken) and no write readiness handler
+ * is installed (see \ref vortex_sequencer_watch_writable), otherwise
+ * axl_false is returned and the connection must be watched again.
+ */
+axl_bool vortex_frame_drain_output (VortexConnection * connection, axl_bool * resume)
+{
+	VortexCtx   * ctx      = vortex_connection_get_ctx (connection);
+	const char  * pieces[1];
+	int           pieces_size[1];
+	int           iterator = 0;
+	int           offset   = 0;
+	int           error    = 0;
+	axl_bool      failed   = axl_false;
+	axl_bool      empty;
+
+	(* resume) = axl_false;
+
+	vortex_mutex_lock (&connection->output_mutex);
+
+	if (! vortex_connection_is_ok (connection, axl_false)) {
+		/* connection broken: discard content queued */
+		connection->output_size   = 0;
+		connection->output_offset = 0;
+	} else if (connection->output_size > 0) {
+		pieces[0]      = connection->output_buffer + connection->output_offset;
+		pieces_size[0] = connection->output_size;
+		if (__vortex_frame_write_nonblocking (connection, pieces, pieces_size, 1, &iterator, &offset) < 0) {
+			error  = errno;
+			failed = axl_true;
+
+			/* discard content queued */
+			connection->output_size   = 0;
+			connection->output_offset = 0;
+		} else if (iterator > 0) {
+			/* all content written */
+			connection->output_size   = 0;
+			connection->output_offset = 0;
+		} else {
+			connection->output_size   -= offset;
+			connection->output_offset += offset;
+		} /* end if */
+	} /* end if */
+
+	/* check if the sequencer must resume sending */
+	if (connection->output_blocked && connection->output_size < ctx->output_high_water_mark) {
+		connection->output_blocked = axl_false;
+		(* resume)                 = axl_true;
+	} /* end if */
+
+	empty = (connection->output_size == 0 && connection->output_writable == NULL);
+	if (empty)
+		connection->output_watched = axl_false;
+
+	vortex_mutex_unlock (&connection->output_mutex);
+
+	if (failed) {
+		__vortex_connection_shutdown_and_record_error (
+			connection, VortexError, "unable to write queued data to socket: errno=%d (%s), socket=%d conn-id=%d, conn=%p",
+			error, vortex_errno_get_error (error), connection->session, connection->id, connection);
+	} /* end if */
+
+	return empty;
+}
+
+/** 
+ * @internal Installs the write readiness handler notified by the
+ * output thread (see \ref vortex_sequencer_watch_writable).
+ *
+ * @param connection The connection where the handler is installed.
+ *
+ * @param on_writable The handler to install.
+ *
+ * @param user_data User defined data passed to the handler.
+ *
+ * @param watch Reference where it is notified if the connection must
+ * be handed to the output thread (it wasn't watched yet).
+ *
+ * @return axl_true if the handler was installed, axl_false if the
+ * connection already has one.
+ */
+axl_bool vortex_frame_set_writable (VortexConnection           * connection,
+				    VortexConnectionOnWritable   on_writable,
+				    axlPointer                   user_data,
+				    axl_bool                   * watch)
+{
+	(* watch) = axl_false;
+
+	vortex_mutex_lock (&connection->output_mutex);
+	if (connection->output_writable != NULL) {
+		vortex_mutex_unlock (&connection->output_mutex);
+		return axl_false;
+	} /* end if */
+	connection->output_writable      = on_writable;
+	connection->output_writable_data = user_data;
+
+	/* check if the output thread must watch this connection */
+	if (! connection->output_watched) {
+		connection->output_watched = axl_true;
+		(* watch)                  = axl_true;
+	} /* end if */
+	vortex_mutex_unlock (&connection->output_mutex);
+
+	return axl_true;
+}
+
+/** 
+ * @internal Notifies the write readiness handler installed on the
+ * provided connection (if any) once all content queued was written.
+ * The handler is removed before being notified (so it can install
+ * itself again).
+ *
+ * @return axl_true if a handler was notified.
+ */
+axl_bool vortex_frame_notify_writable (VortexConnection * connection)
+{
+	VortexConnectionOnWritable   on_writable = NULL;
+	axlPointer                   user_data   = NULL;
+
+	vortex_mutex_lock (&connection->output_mutex);
+	if (connection->output_size == 0) {
+		on_writable                      = connection->output_writable;
+		user_data                        = connection->output_writable_data;
+		connection->output_writable      = NULL;
+		connection->output_writable_data = NULL;
+	} /* end if */
+	vortex_mutex_unlock (&connection->output_mutex);
+
+	if (on_writable == NULL)
+		return axl_false;
+
+	on_writable (connection, user_data);
+	return axl_true;
+}
+
+/** 
+ * @internal Writes all content queued on the provided connection
+ * (asynchronous writes), waiting for the socket to be writable. It
+ * is used before closing the connection (and when the output thread
+ * is stopped) because content queued was already reported as sent by
+ * \ref vortex_frame_send_raw.
+ *
+ * The wait is bounded by the write timeout used by blocking writes
+ * (see \ref vortex_ctx_write_timeout): once reached without progress,
+ * content still queued is discarded.
+ *
+ * @param connection The connection to flush.
+ *
+ * @return axl_true if all content queued was written, otherwise
+ * axl_false is returned (content queued was discarded).
+ */
+axl_bool vortex_frame_flush_output (VortexConnection * connection)
+{
+	VortexCtx   * ctx;
+	const char  * pieces[1];
+	int           pieces_size[1];
+	int           iterator;
+	int           offset;
+	int           fds;
+	int           tries;
+	int           wait_result;
+	axlPointer    on_write = NULL;
+	axl_bool      result   = axl_false;
+
+	if (connection == NULL)
+		return axl_false;
+
+	ctx   = vortex_connection_get_ctx (connection);
+	tries = (ctx->conn_close_on_write_timeout > 0) ? ctx->conn_close_on_write_timeout : 3;
+
+	while (axl_true) {
+		vortex_mutex_lock (&connection->output_mutex);
+
+		/* nothing (more) to write */
+		if (connection->output_size == 0) {
+			vortex_mutex_unlock (&connection->output_mutex);
+			result = axl_true;
+			break;
+		} /* end if */
+
+		iterator = 0;
+		offset   = 0;
+		fds      = connection->session;
+		if (fds >= 0 && tries > 0) {
+			pieces[0]      = connection->output_buffer + connection->output_offset;
+			pieces_size[0] = connection->output_size;
+			if (__vortex_frame_write_nonblocking (connection, pieces, pieces_size, 1, &iterator, &offset) < 0)
+				tries = 0;
+		} else
+			tries = 0;
+
+		if (tries == 0 || iterator > 0) {
+			/* all content written or unable to write it:
+			 * discard what is still queued */
+			if (iterator == 0)
+				vortex_log (VORTEX_LEVEL_WARNING, "discarding %d bytes queued on conn-id=%d, unable to write them before closing",
+					    connection->output_size, connection->id);
+			result                    = (iterator > 0);
+			connection->output_size   = 0;
+			connection->output_offset = 0;
+			vortex_mutex_unlock (&connection->output_mutex);
+			break;
+		} /* end if */
+
+		connection->output_size   -= offset;
+		connection->output_offset += offset;
+		vortex_mutex_unlock (&connection->output_mutex);
+
+		/* wait for the socket to be writable */
+		if (on_write == NULL)
+			on_write = vortex_io_waiting_invoke_create_fd_group (ctx, WRITE_OPERATIONS);
+		if (on_write == NULL) {
+			tries = 0;
+			continue;
+		} /* end if */
+		vortex_io_waiting_invoke_clear_fd_group (ctx, on_write);
+		if (! vortex_io_waiting_invoke_add_to_fd_group (ctx, fds, connection, on_write)) {
+			tries = 0;
+			continue;
+		} /* end if */
+
+		wait_result = vortex_io_waiting_invoke_wait (ctx, on_write, fds + 1, WRITE_OPERATIONS);
+		if (wait_result == -3)
+			tries = 0;
+		else if (wait_result <= 0 && offset == 0)
+			tries--;
+	} /* end while */
+
+	if (on_write != NULL)
+		vortex_io_waiting_invoke_destroy_fd_group (ctx, on_write);
+
+	return result;
+}
+
+/** 
+ * @internal Allows to check if the connection has more content
+ * queued (asynchronous writes) than the configured high water mark,
+ * in which case it is flagged so the output thread notifies once it
+ * goes below it.
+ *
+ * @return axl_true if the sequencer must stop sending on the
+ * connection, otherwise axl_false is returned.
+ */
+axl_bool vortex_frame_output_blocked (VortexConnection * connection)
+{
+	VortexCtx * ctx    = vortex_connection_get_ctx (connection);
+	axl_bool    result = axl_false;
+
+	if (ctx == NULL || ! ctx->output_running || ctx->output_high_water_mark <= 0)
+		return axl_false;
+
+	vortex_mutex_lock (&connection->output_mutex);
+	if (connection->output_size >= ctx->output_high_water_mark) {
+		connection->output_blocked = axl_true;
+		result                     = axl_true;
+	} /* end if */
+	vortex_mutex_unlock (&connection->output_mutex);
+
+	return result;
+}
+
 /** 
  * @internal
  * 
@@ -1932,7 +2698,10 @@ process_buffer:
  * @param a_frame 
  * @param frame_size 
  * 
- * @return 
+ * @return axl_true if the content was written or, with asynchronous
+ * writes (\ref VORTEX_ASYNC_WRITES), queued to be written by the
+ * output thread. Content queued is written before the connection is
+ * closed (see \ref vortex_frame_flush_output).
  */
 axl_bool             vortex_frame_send_raw     (VortexConnection * connection, const char  * a_frame, int  frame_size)
 {
@@ -1953,6 +2722,10 @@ axl_bool             vortex_frame_send_raw     (VortexConnection * connection, c
 	v_return_val_if_fail (vortex_connection_is_ok (connection, axl_false), axl_false);
 	v_return_val_if_fail (a_frame, axl_false);
 
+	/* asynchronous writes: never wait for the socket */
+	if (ctx->output_running && vortex_connection_is_default_send (connection))
+		return __vortex_frame_send_async (connection, &a_frame, &frame_size, 1);
+
  again:
 	if ((bytes = vortex_connection_invoke_send (connection, a_frame + total, frame_size - total)) < 0) {
 		if (errno == VORTEX_EINTR)
@@ -2063,6 +2836,186 @@ axl_bool             vortex_frame_send_raw     (VortexConnection * connection, c
  	return (total == frame_size);
 }
 
+/** 
+ * @internal
+ * 
+ * Sends a frame made of several pieces (header, payload and trailer)
+ * without joining them into a single buffer. If the connection is
+ * using the default send handler, all pieces are written with a
+ * single writev call (scatter-gather). Content not written by that
+ * call (partial write, socket not ready or a send handler other than
+ * the default) is sent using \ref vortex_frame_send_raw.
+ * 
+ * @param connection The connection where the frame will be sent.
+ * @param pieces The list of pieces that build up the frame.
+ * @param pieces_size The size of each piece.
+ * @param pieces_num The number of pieces.
+ * 
+ * @return axl_true if the frame was completely sent, otherwise
+ * axl_false is returned.
+ */
+axl_bool             vortex_frame_send_raw_pieces (VortexConnection  * connection, 
+						   const char       ** pieces, 
+						   int               * pieces_size,
+						   int                 pieces_num)
+{
+	int            iterator = 0;
+	int            offset   = 0;
+#if defined(AXL_OS_UNIX)
+	struct iovec   iov[VORTEX_WRITER_MAX_PIECES];
+	int            bytes;
+#endif
+
+	v_return_val_if_fail (connection, axl_false);
+	v_return_val_if_fail (vortex_connection_is_ok (connection, axl_false), axl_false);
+	v_return_val_if_fail (pieces && pieces_size, axl_false);
+
+	/* asynchronous writes: never wait for the socket */
+	if (connection->ctx->output_running && vortex_connection_is_default_send (connection))
+		return __vortex_frame_send_async (connection, pieces, pieces_size, pieces_num);
+
+#if defined(AXL_OS_UNIX)
+	if (pieces_num <= VORTEX_WRITER_MAX_PIECES && vortex_connection_is_default_send (connection)) {
+		/* prepare io vector */
+		while (iterator < pieces_num) {
+			iov[iterator].iov_base = (void *) pieces[iterator];
+			iov[iterator].iov_len  = pieces_size[iterator];
+			iterator++;
+		} /* end while */
+		iterator = 0;
+
+	again:
+		bytes = writev (connection->session, iov, pieces_num);
+		if (bytes < 0 && errno == VORTEX_EINTR)
+			goto again;
+
+		if (bytes > 0) {
+			/* notify content written */
+			vortex_connection_set_receive_stamp (connection, 0, bytes);
+
+			/* skip pieces completely written */
+			while (iterator < pieces_num && bytes >= pieces_size[iterator]) {
+				bytes -= pieces_size[iterator];
+				iterator++;
+			} /* end while */
+			offset = bytes;
+		} /* end if */
+	} /* end if */
+#endif
+
+	/* send pending content */
+	while (iterator < pieces_num) {
+		if (pieces_size[iterator] > offset) {
+			if (! vortex_frame_send_raw (connection, pieces[iterator] + offset, pieces_size[iterator] - offset))
+				return axl_false;
+		} /* end if */
+		offset = 0;
+		iterator++;
+	} /* end while */
+
+	return axl_true;
+}
+
+/** 
+ * @internal Min size of a payload to be sent with sendfile: smaller
+ * payloads are written with the rest of the frame (writev) from the
+ * memory where they are mapped.
+ */
+#define VORTEX_FRAME_SENDFILE_MIN_SIZE 8192
+
+/** 
+ * @internal
+ *
+ * Sends a frame made of several pieces (see \ref
+ * vortex_frame_send_raw_pieces) where the piece file_piece is also
+ * found at the file descriptor provided (starting at file_offset).
+ *
+ * If the connection writes directly to the socket (default send
+ * handler, plain TCP or kernel TLS) and the platform supports it, the
+ * pieces before file_piece are written, then the file range is sent
+ * with sendfile() and then the pieces after it. Otherwise (or if
+ * sendfile can't send all the range) the memory referenced by the
+ * piece is used.
+ * 
+ * @param connection The connection where the frame will be sent.
+ * @param pieces The list of pieces that build up the frame.
+ * @param pieces_size The size of each piece.
+ * @param pieces_num The number of pieces.
+ * @param file_piece The piece that is also found at file_fd.
+ * @param file_fd The file descriptor where the piece content is found.
+ * @param file_offset The offset where the piece content starts.
+ * 
+ * @return axl_true if the frame was completely sent, otherwise
+ * axl_false is returned.
+ */
+axl_bool             vortex_frame_send_raw_file   (VortexConnection  * connection, 
+						   const char       ** pieces, 
+						   int               * pieces_size,
+						   int                 pieces_num,
+						   int                 file_piece,
+						   int                 file_fd,
+						   long                file_offset)
+{
+#if defined(AXL_OS_UNIX) && defined(__linux__)
+	off_t          offset  = file_offset;
+	int            written = 0;
+	int            bytes;
+	axl_bool       result;
+#if defined(TCP_CORK)
+	int            cork;
+#endif
+
+	v_return_val_if_fail (connection, axl_false);
+	v_return_val_if_fail (pieces && pieces_size, axl_false);
+
+	/* sendfile not suitable: use memory referenced */
+	if (file_piece <= 0 || file_piece >= pieces_num || pieces_size[file_piece] < VORTEX_FRAME_SENDFILE_MIN_SIZE ||
+	    connection->ctx->output_running || ! vortex_connection_is_default_send (connection))
+		return vortex_frame_send_raw_pieces (connection, pieces, pieces_size, pieces_num);
+
+#if defined(TCP_CORK)
+	/* join header, file content and trailer into full segments */
+	cork = 1;
+	setsockopt (connection->session, IPPROTO_TCP, TCP_CORK, &cork, sizeof (cork));
+#endif
+
+	/* pieces before file content */
+	result = vortex_frame_send_raw_pieces (connection, pieces, pieces_size, file_piece);
+
+	/* file content */
+	while (result && written < pieces_size[file_piece]) {
+		bytes = sendfile (connection->session, file_fd, &offset, pieces_size[file_piece] - written);
+		if (bytes < 0 && errno == VORTEX_EINTR)
+			continue;
+		/* socket not ready or sendfile not supported: send
+		 * the rest from memory */
+		if (bytes <= 0)
+			break;
+
+		/* notify content written */
+		vortex_connection_set_receive_stamp (connection, 0, bytes);
+		written += bytes;
+	} /* end while */
+	if (result && written < pieces_size[file_piece])
+		result = vortex_frame_send_raw (connection, pieces[file_piece] + written, pieces_size[file_piece] - written);
+
+	/* pieces after file content */
+	if (result && (file_piece + 1) < pieces_num)
+		result = vortex_frame_send_raw_pieces (connection, pieces + file_piece + 1, pieces_size + file_piece + 1, pieces_num - file_piece - 1);
+
+#if defined(TCP_CORK)
+	/* flush */
+	cork = 0;
+	setsockopt (connection->session, IPPROTO_TCP, TCP_CORK, &cork, sizeof (cork));
+#endif
+
+	return result;
+#else
+	/* no sendfile support: use memory referenced */
+	return vortex_frame_send_raw_pieces (connection, pieces, pieces_size, pieces_num);
+#endif
+}
+
 
 /** 
  * @brief Increases the frame reference counting.
@@ -2094,7 +3047,7 @@ axl_bool           vortex_frame_ref                   (VortexFrame * frame)
 	v_return_val_if_fail (frame, axl_false);
 
 	/* increase the frame counting */
-	frame->ref_count++;
+	vortex_atomic_add (&frame->ref_count, 1);
 
 	return axl_true;
 }
@@ -2112,11 +3065,8 @@ void          vortex_frame_unref                 (VortexFrame * frame)
 	if (frame == NULL)
 		return;
 	
-	/* decrease reference counting */
-	frame->ref_count--;
-
-	/* check and dealloc */
-	if (frame->ref_count == 0) {
+	/* decrease reference counting, check and dealloc */
+	if (vortex_atomic_add (&frame->ref_count, -1) == 0) {
 		vortex_frame_free (frame);
 	}
 	
@@ -2135,7 +3085,7 @@ void          vortex_frame_unref                 (VortexFrame * frame)
 int           vortex_frame_ref_count             (VortexFrame * frame)
 {
 	v_return_val_if_fail (frame, -1);
-	return frame->ref_count;
+	return vortex_atomic_get (&frame->ref_count);
 }
 
 
@@ -2155,35 +3105,81 @@ int           vortex_frame_ref_count             (VortexFrame * frame)
  **/
 void          vortex_frame_free (VortexFrame * frame)
 {
-#if defined(ENABLE_VORTEX_LOG)
 	VortexCtx * ctx;
-#endif
+
 	if (frame == NULL)
 		return;
 
 	/* log a frame deallocated message */
-#if defined(ENABLE_VORTEX_LOG)
 	ctx = frame->ctx;
 	vortex_log (VORTEX_LEVEL_DEBUG, "deallocating frame id=%d", frame->id);
-#endif
 
 	/* free MIME headers */
 	vortex_frame_mime_status_free (frame->mime_headers);
 
 	/* free frame payload (first checking for content, and, if not
-	 * defined, then payload) */
+	 * defined, then payload), returning it to the pool */
 	if (frame->buffer != NULL)
-		axl_free (frame->buffer);
+		__vortex_frame_pool_release_buffer (ctx, frame->buffer, frame->pool_class);
 	else if (frame->content != NULL)
-		axl_free (frame->content);
+		__vortex_frame_pool_release_buffer (ctx, frame->content, frame->pool_class);
 	else if (frame->payload != NULL)
-		axl_free (frame->payload);
+		__vortex_frame_pool_release_buffer (ctx, frame->payload, frame->pool_class);
+
+	/* free the frame node itself (before releasing the context
+	 * holding the pool) */
+	__vortex_frame_pool_release_frame (ctx, frame);
 
 	/* release reference to the context */
-	vortex_ctx_unref2 (&frame->ctx, "end frame");
+	vortex_ctx_unref2 (&ctx, "end frame");
+
+	return;
+}
+
+/** 
+ * @brief Allows to get statistics about the frame pool used by the
+ * provided context to reuse frames and payload buffers released (see
+ * \ref VORTEX_FRAME_POOL_LIMIT).
+ *
+ * @param ctx The context where the operation will be performed.
+ *
+ * @param cached_frames Optional reference where the number of frames
+ * currently cached is returned.
+ *
+ * @param cached_buffers Optional reference where the number of
+ * payload buffers currently cached (all size classes) is returned.
+ *
+ * @param reused Optional reference where the number of allocations
+ * served from the pool is returned.
+ *
+ * @param allocated Optional reference where the number of
+ * allocations that required new memory is returned.
+ */
+void          vortex_frame_pool_stats (VortexCtx * ctx,
+				       int       * cached_frames,
+				       int       * cached_buffers,
+				       long      * reused,
+				       long      * allocated)
+{
+	int iterator;
+
+	if (ctx == NULL)
+		return;
+
+	vortex_mutex_lock (&ctx->frame_pool_mutex);
+	if (cached_frames)
+		(* cached_frames) = ctx->frame_pool_frames_num;
+	if (cached_buffers) {
+		(* cached_buffers) = 0;
+		for (iterator = 0; iterator < VORTEX_FRAME_POOL_CLASSES; iterator++)
+			(* cached_buffers) += ctx->frame_pool_buffers_num[iterator];
+	} /* end if */
+	if (reused)
+		(* reused) = ctx->frame_pool_reused;
+	if (allocated)
+		(* allocated) = ctx->frame_pool_allocated;
+	vortex_mutex_unlock (&ctx->frame_pool_mutex);
 
-	/* free the frame node itself */
-	axl_free (frame);
 	return;
 }
 
@@ -2196,7 +3192,7 @@ VortexFrame * __vortex_frame_join_common (VortexFrame * a, VortexFrame * b, axl_
 		return NULL;
 
 	/* copy current frame values */
-	result                    = axl_new (VortexFrame, 1);
+	result                    = __vortex_frame_pool_new_frame (a->ctx);
 	VORTEX_CHECK_REF (result, NULL);
 
 	/* acquire a reference to the context */
@@ -2224,9 +3220,11 @@ VortexFrame * __vortex_frame_join_common (VortexFrame * a, VortexFrame * b, axl_
 		result->payload  = axl_realloc (a->payload, a->size + b->size + 1);
 		VORTEX_CHECK_REF2 (result->payload, NULL, result, axl_free);
 		a->payload       = NULL;
+		/* memory reallocated is no longer suitable for the pool */
+		a->pool_class    = -1;
 	} else {
 		/* allocates memory to hold both elements a and b */
-		result->payload  = axl_new (char , a->size + b->size + 1);
+		result->payload  = __vortex_frame_pool_new_buffer (a->ctx, a->size + b->size + 1, &result->pool_class);
 		VORTEX_CHECK_REF2 (result->payload, NULL, result, axl_free);
 
 		/* mem copy a over result */
@@ -2235,6 +3233,7 @@ VortexFrame * __vortex_frame_join_common (VortexFrame * a, VortexFrame * b, axl_
 	/* now copy b over result starting from a's ending */
 	memcpy ((unsigned char *) result->payload + a->size, 
 		    b->payload, b->size);
+	((char *) result->payload)[a->size + b->size] = 0;
 
 	/* because mime headers are found at the begining of the
 	 * frame, joing operations will move headers */
@@ -80,6 +80,19 @@ char  * vortex_frame_build_up_from_params_s_buffer (VortexFrameType   type,
  						    char         *    buffer,
  						    int               buffer_size);
 
+int            vortex_frame_build_header          (char        * buffer,
+						   int           buffer_size,
+						   int         * real_size,
+						   char        * message_type,
+						   int           channel, 
+						   int           msgno,
+						   axl_bool      more,
+						   unsigned int  seqno,
+						   int           size,
+						   int           ansno,
+						   const char  * content_type,
+						   const char  * transfer_encoding);
+
 char  *        vortex_frame_seq_build_up_from_params (int           channel_num,
 						      unsigned int  ackno,
 						      int           window_size);
@@ -136,13 +149,46 @@ axl_bool      vortex_frame_send_raw              (VortexConnection * connection,
 						  const char       * a_frame, 
 						  int                frame_size);
 
+axl_bool      vortex_frame_send_raw_pieces       (VortexConnection  * connection, 
+						  const char       ** pieces, 
+						  int               * pieces_size,
+						  int                 pieces_num);
+
+axl_bool      vortex_frame_send_raw_file         (VortexConnection  * connection, 
+						  const char       ** pieces, 
+						  int               * pieces_size,
+						  int                 pieces_num,
+						  int                 file_piece,
+						  int                 file_fd,
+						  long                file_offset);
+
+axl_bool      vortex_frame_drain_output          (VortexConnection  * connection,
+						  axl_bool          * resume);
+
+axl_bool      vortex_frame_output_blocked        (VortexConnection  * connection);
+
+axl_bool      vortex_frame_flush_output          (VortexConnection  * connection);
+
+axl_bool      vortex_frame_set_writable          (VortexConnection           * connection,
+						  VortexConnectionOnWritable   on_writable,
+						  axlPointer                   user_data,
+						  axl_bool                   * watch);
+
+axl_bool      vortex_frame_notify_writable       (VortexConnection  * connection);
+
 int           vortex_frame_receive_raw           (VortexConnection * connection, 
 						  char  * buffer, int  maxlen);
 
+int           vortex_frame_input_pending         (VortexConnection * connection);
+
 int           vortex_frame_readline              (VortexConnection * connection, 
 						  char             * buffer, 
 						  int                maxlen);
 
+axl_bool      __vortex_frame_input_has_frame     (VortexConnection * connection);
+
+int           __vortex_frame_fill_input          (VortexConnection * connection);
+
 axl_bool      vortex_frame_ref                   (VortexFrame * frame);
 
 void          vortex_frame_unref                 (VortexFrame * frame);
@@ -151,6 +197,14 @@ int           vortex_frame_ref_count             (VortexFrame * frame);
 
 void          vortex_frame_free                  (VortexFrame * frame);
 
+void          vortex_frame_pool_stats            (VortexCtx   * ctx,
+						  int         * cached_frames,
+						  int         * cached_buffers,
+						  long        * reused,
+						  long        * allocated);
+
+void          vortex_frame_pool_cleanup          (VortexCtx   * ctx);
+
 VortexFrame * vortex_frame_join                  (VortexFrame * a, 
 						  VortexFrame * b);
 
@@ -620,6 +620,28 @@ typedef axl_bool      (*VortexOnAcceptedConnection)   (VortexConnection * connec
  */
 typedef void   (* VortexConnectionOnPreRead)       (VortexConnection * connection);
 
+/** 
+ * @brief Write readiness handler definition.
+ *
+ * Handler notified (once) by the output thread when the connection
+ * socket can be written without blocking. It is used to resume
+ * writers that bypass the connection output queue (for example,
+ * TUNNEL relays) without polling the socket.
+ *
+ * Functions using this handler are:
+ *  - \ref vortex_sequencer_watch_writable
+ *
+ * The handler is also notified when the output thread is stopped
+ * while it is installed, so resources held can be released (the
+ * socket may not be writable in such case).
+ *
+ * @param connection The connection whose socket can be written.
+ *
+ * @param user_data User defined data configured with the handler.
+ */
+typedef void   (* VortexConnectionOnWritable)      (VortexConnection * connection,
+						    axlPointer         user_data);
+
 /** 
  * @brief IO handler definition to allow defining the method to be
  * invoked while createing a new fd set.
@@ -695,6 +717,29 @@ typedef axl_bool      (* VortexIoAddToFdGroup)        (int                    fd
 						       VortexConnection     * connection,
 						       axlPointer             fd_group);
 
+/** 
+ * @brief IO handler definition to perform the "remove from" the fd
+ * set operation.
+ *
+ * This handler is optional. I/O mechanisms implementing it (see \ref
+ * vortex_io_waiting_set_remove_from_fd_group) are used in incremental
+ * mode by the vortex reader: sockets are added once when they are
+ * watched and removed when they are no longer watched, instead of
+ * clearing and populating the fd group again before each wait
+ * operation. This is only sensible for mechanisms keeping their
+ * registrations between waits, like epoll(2).
+ * 
+ * @param fds The socket descriptor to be removed.
+ *
+ * @param connection The connection that was added with the socket.
+ *
+ * @param fd_group The socket descriptor group where the socket was
+ * added.
+ */
+typedef void          (* VortexIoRemoveFromFdGroup)   (int                    fds,
+						       VortexConnection     * connection,
+						       axlPointer             fd_group);
+
 /** 
  * @brief IO handler definition to perform the "is set" the fd set
  * operation.
@@ -114,6 +114,10 @@ typedef struct _VortexSelect {
 	fd_set               set;
 	int                  length;
 	VortexIoWaitingFor   wait_to;
+	/* descriptor watched for read operations no matter the
+	 * purpose of the set (see
+	 * vortex_io_waiting_invoke_add_wake_to_fd_group) */
+	int                  wake;
 }VortexSelect;
 
 /** 
@@ -131,6 +135,7 @@ axlPointer __vortex_io_waiting_default_create (VortexCtx * ctx, VortexIoWaitingF
 	/* set default behaviour expected for the set */
 	select->wait_to       = wait_to;
 	select->ctx           = ctx;
+	select->wake          = -1;
 	
 	/* clear the set */
 	FD_ZERO (&(select->set));
@@ -171,6 +176,7 @@ void    __vortex_io_waiting_default_clear (axlPointer __fd_group)
 
 	/* clear the fd set */
 	select->length = 0;
+	select->wake   = -1;
 	FD_ZERO (&(select->set));
 
 	/* nothing more to do */
@@ -194,18 +200,27 @@ int __vortex_io_waiting_default_wait_on (axlPointer __fd_group, int max_fds, Vor
 	int                result = -1;
 	struct timeval     tv;
 	VortexSelect     * _select = __fd_group;
+	fd_set             wake_set;
 
 	/* perform the select operation according to the
 	 * <b>wait_to</b> value. */
 	if (VORTEX_IO_IS (wait_to, READ_OPERATIONS)) {
 		/* init wait */
 		tv.tv_sec    = 0;
-		tv.tv_usec   = 500000;
+		tv.tv_usec   = VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 500000;
 		result       = select (max_fds + 1, &(_select->set), NULL,   NULL, &tv);
 	} else if (VORTEX_IO_IS (wait_to, WRITE_OPERATIONS)) {
-		tv.tv_sec    = 1;
+		tv.tv_sec    = VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 1;
 		tv.tv_usec   = 0;
-		result       = select (max_fds + 1, NULL, &(_select->set), NULL, &tv);
+		if (_select->wake >= 0) {
+			/* also watch the wake descriptor for reading */
+			FD_ZERO (&wake_set);
+			FD_SET  (_select->wake, &wake_set);
+			if (_select->wake > max_fds)
+				max_fds = _select->wake;
+			result       = select (max_fds + 1, &wake_set, &(_select->set), NULL, &tv);
+		} else
+			result       = select (max_fds + 1, NULL, &(_select->set), NULL, &tv);
 	}
 	
 	/* check result */
@@ -482,10 +497,10 @@ int __vortex_io_waiting_poll_wait_on (axlPointer __fd_group, int max_fds, Vortex
 	 * <b>wait_to</b> value. */
 	if (VORTEX_IO_IS (wait_to, READ_OPERATIONS)) {
 		/* wait for read operations */
-		result       = poll (_poll->set, _poll->length, 500);
+		result       = poll (_poll->set, _poll->length, VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 500);
 	} else 	if (VORTEX_IO_IS (wait_to, WRITE_OPERATIONS)) {
 		/* wait for write operations */
-		result       = poll (_poll->set, _poll->length, 1000);
+		result       = poll (_poll->set, _poll->length, VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 1000);
 	}
 	
 	/* check result */
@@ -772,6 +787,42 @@ axl_bool  __vortex_io_waiting_epoll_add_to (int                fds,
 	return axl_true;
 }
 
+/** 
+ * @internal
+ *
+ * Remove from file set implementation for epoll(2) interface, used by
+ * the vortex reader to keep sockets registered between waits.
+ * 
+ * @param fds The socket descriptor to be removed.
+ *
+ * @param fd_set The fd set where the socket descriptor was added.
+ */
+void      __vortex_io_waiting_epoll_remove_from (int                fds, 
+						 VortexConnection * connection,
+						 axlPointer         __fd_set)
+{
+	VortexEPoll *        epoll  = (VortexEPoll *) __fd_set;
+	struct epoll_event   ev;
+	int                  _errno = errno;
+
+	/* kernels before 2.6.9 require a non NULL event */
+	memset (&ev, 0, sizeof (struct epoll_event));
+
+	/* the socket may already be closed (and so removed by the
+	 * kernel): nothing to report in such case, and errno is
+	 * restored so the reader doesn't take it as a failure */
+	if (fds >= 0) {
+		epoll_ctl (epoll->set, EPOLL_CTL_DEL, fds, &ev);
+		errno = _errno;
+	} /* end if */
+
+	/* update length */
+	if (epoll->length > 0)
+		epoll->length--;
+
+	return;
+}
+
 /** 
  * @internal
  *
@@ -789,9 +840,11 @@ int __vortex_io_waiting_epoll_wait_on (axlPointer __fd_group, int max_fds, Vorte
 	/* perform the select operation according to the
 	 * <b>wait_to</b> value. */
 	if (VORTEX_IO_IS (wait_to, READ_OPERATIONS)) {
-		result = epoll_wait (epoll->set, epoll->events, epoll->length, 500);
+		result = epoll_wait (epoll->set, epoll->events, epoll->length > 0 ? epoll->length : 1, 
+				     VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 500);
 	} else 	if (VORTEX_IO_IS (wait_to, WRITE_OPERATIONS)) {
-		result = epoll_wait (epoll->set, epoll->events, epoll->length, 1000);
+		result = epoll_wait (epoll->set, epoll->events, epoll->length > 0 ? epoll->length : 1, 
+				     VORTEX_IO_IS (wait_to, NO_WAIT_OPERATIONS) ? 0 : 1000);
 	} /* end if */
 
 	/* check result */
@@ -954,6 +1007,7 @@ axl_bool                  vortex_io_waiting_use (VortexCtx * ctx, VortexIoWaitin
 		ctx->waiting_clear         = __vortex_io_waiting_default_clear;
 		ctx->waiting_wait_on       = __vortex_io_waiting_default_wait_on;
 		ctx->waiting_add_to        = __vortex_io_waiting_default_add_to;
+		ctx->waiting_remove_from   = NULL;
 		ctx->waiting_is_set        = __vortex_io_waiting_default_is_set;
 		ctx->waiting_have_dispatch = NULL;
 		ctx->waiting_dispatch      = NULL;
@@ -974,6 +1028,7 @@ axl_bool                  vortex_io_waiting_use (VortexCtx * ctx, VortexIoWaitin
 		ctx->waiting_clear         = __vortex_io_waiting_poll_clear;
 		ctx->waiting_wait_on       = __vortex_io_waiting_poll_wait_on;
 		ctx->waiting_add_to        = __vortex_io_waiting_poll_add_to;
+		ctx->waiting_remove_from   = NULL;
 		/* no is_set support but automatic dispatch */
 		ctx->waiting_is_set        = NULL;
 		ctx->waiting_have_dispatch = __vortex_io_waiting_poll_have_dispatch;
@@ -1000,6 +1055,8 @@ axl_bool                  vortex_io_waiting_use (VortexCtx * ctx, VortexIoWaitin
 		ctx->waiting_clear         = __vortex_io_waiting_epoll_clear;
 		ctx->waiting_wait_on       = __vortex_io_waiting_epoll_wait_on;
 		ctx->waiting_add_to        = __vortex_io_waiting_epoll_add_to;
+		/* sockets are kept registered between waits */
+		ctx->waiting_remove_from   = __vortex_io_waiting_epoll_remove_from;
 		/* no is_set support but automatic dispatch */
 		ctx->waiting_is_set        = NULL;
 		ctx->waiting_have_dispatch = __vortex_io_waiting_epoll_have_dispatch;
@@ -1100,6 +1157,11 @@ VortexIoWaitingType  vortex_io_waiting_get_current  (VortexCtx * ctx)
  * create a new IO fd set. The function will fail to set the default
  * create handler is a NULL handler is provided. No handler will be
  * modified is the create handler is not provided.
+ *
+ * Because a new fd group implementation is being installed, the
+ * "remove from" handler is cleared: call \ref
+ * vortex_io_waiting_set_remove_from_fd_group after this function if
+ * the new mechanism supports incremental mode.
  */
 void                 vortex_io_waiting_set_create_fd_group (VortexCtx * ctx, 
 							    VortexIoCreateFdGroup create)
@@ -1109,7 +1171,11 @@ void                 vortex_io_waiting_set_create_fd_group (VortexCtx * ctx,
 		return;
 
 	/* set default create handler */
-	ctx->waiting_create = create;
+	ctx->waiting_create      = create;
+
+	/* the remove from handler installed belongs to the
+	 * previous mechanism */
+	ctx->waiting_remove_from = NULL;
 	
 	return;
 }
@@ -1301,6 +1367,166 @@ axl_bool               vortex_io_waiting_invoke_add_to_fd_group  (VortexCtx
 	return axl_false;
 }
 
+/** 
+ * @internal
+ *
+ * @brief Adds the provided descriptor to the given fd set to be
+ * watched for read operations, no matter the purpose the set was
+ * created for. It is used to wake up a thread blocked waiting (like
+ * the output thread or the vortex reader) by writing into a pipe.
+ *
+ * Mechanisms with automatic dispatch report the descriptor with a
+ * NULL connection: dispatch functions must check it.
+ *
+ * Only built-in mechanisms (select(2), poll(2) and epoll(2)) support
+ * it: the descriptor is not added if user defined handlers are
+ * installed.
+ *
+ * @param ctx The context where the operation will be performed.
+ *
+ * @param fds The descriptor to watch for read operations.
+ *
+ * @param fd_group The fd set where the descriptor will be added.
+ *
+ * @return axl_true if the descriptor was added, otherwise axl_false
+ * is returned (the caller must not rely on being waked up).
+ */
+axl_bool               vortex_io_waiting_invoke_add_wake_to_fd_group (VortexCtx        * ctx,
+								      VORTEX_SOCKET      fds, 
+								      axlPointer         fd_group)
+{
+	VortexSelect       * select;
+#if defined(VORTEX_HAVE_POLL)
+	VortexPoll         * poll;
+#endif
+#if defined(VORTEX_HAVE_EPOLL)
+	VortexEPoll        * epoll;
+	struct epoll_event   ev;
+#endif
+
+	if (ctx == NULL || fd_group == NULL || fds < 0)
+		return axl_false;
+
+	if (ctx->waiting_add_to == __vortex_io_waiting_default_add_to &&
+	    ctx->waiting_wait_on == __vortex_io_waiting_default_wait_on) {
+		if (fds >= VORTEX_FD_SETSIZE)
+			return axl_false;
+		select       = (VortexSelect *) fd_group;
+		select->wake = fds;
+		/* sets created for reading watch it as any other
+		 * descriptor */
+		if (VORTEX_IO_IS (select->wait_to, READ_OPERATIONS))
+			FD_SET (fds, &(select->set));
+		return axl_true;
+	} /* end if */
+
+#if defined(VORTEX_HAVE_POLL)
+	if (ctx->waiting_add_to == __vortex_io_waiting_poll_add_to &&
+	    ctx->waiting_wait_on == __vortex_io_waiting_poll_wait_on) {
+		/* add it as usual and then configure read events */
+		if (! __vortex_io_waiting_poll_add_to (fds, NULL, fd_group))
+			return axl_false;
+		poll = (VortexPoll *) fd_group;
+		poll->set[poll->length - 1].events = POLLIN;
+		return axl_true;
+	} /* end if */
+#endif
+
+#if defined(VORTEX_HAVE_EPOLL)
+	if (ctx->waiting_add_to == __vortex_io_waiting_epoll_add_to &&
+	    ctx->waiting_wait_on == __vortex_io_waiting_epoll_wait_on) {
+		epoll = (VortexEPoll *) fd_group;
+		memset (&ev, 0, sizeof (struct epoll_event));
+		ev.events   = EPOLLIN;
+		ev.data.ptr = NULL;
+		if (epoll_ctl (epoll->set, EPOLL_CTL_ADD, fds, &ev) != 0 && errno != EEXIST)
+			return axl_false;
+		epoll->length++;
+		return axl_true;
+	} /* end if */
+#endif
+
+	/* user defined mechanism */
+	return axl_false;
+}
+
+/** 
+ * @brief Allows to configure the remove from operation for the socket
+ * on the fd set.
+ *
+ * Configuring this handler makes the vortex reader to use the I/O
+ * mechanism in incremental mode: each socket is added once (when the
+ * connection starts to be watched) and removed once (when it is
+ * closed, blocked or unwatched) instead of clearing and adding all
+ * sockets again before each wait operation. Only mechanisms keeping
+ * their registrations between waits (like epoll(2), which is
+ * configured this way by default) should provide this handler.
+ *
+ * Passing a NULL handler disables incremental mode. The change is
+ * applied the next time the vortex reader creates its fd group (see
+ * \ref vortex_io_waiting_use).
+ *
+ * @param ctx The context where the operation will be performed.
+ *
+ * @param remove_from The handler to be invoked when it is required to
+ * remove a socket descriptor from the fd set.
+ */
+void                 vortex_io_waiting_set_remove_from_fd_group (VortexCtx                * ctx, 
+								 VortexIoRemoveFromFdGroup  remove_from)
+{
+	if (ctx == NULL)
+		return;
+
+	/* set the new handler */
+	ctx->waiting_remove_from = remove_from;
+
+	return;
+}
+
+/** 
+ * @internal
+ *
+ * @brief Invokes current remove from operation for the given socket
+ * descriptor on the given fd set.
+ *
+ * @param ctx The context where the operation will be performed.
+ * 
+ * @param fds The socket descriptor to be removed.
+ *
+ * @param connection The connection that was added with the socket.
+ *
+ * @param fd_group The fd set where the socket descriptor was added.
+ */
+void                 vortex_io_waiting_invoke_remove_from_fd_group (VortexCtx        * ctx,
+								    VORTEX_SOCKET      fds, 
+								    VortexConnection * connection, 
+								    axlPointer         fd_group)
+{
+	if (ctx == NULL || fd_group == NULL || ctx->waiting_remove_from == NULL)
+		return;
+
+	/* invoke remove from operation */
+	ctx->waiting_remove_from (fds, connection, fd_group);
+	return;
+}
+
+/** 
+ * @brief Allows to check if the I/O mechanism currently installed is
+ * used in incremental mode (sockets are kept registered between wait
+ * operations, see \ref vortex_io_waiting_set_remove_from_fd_group).
+ *
+ * @param ctx The context where the operation will be performed.
+ *
+ * @return axl_true if the mechanism supports incremental mode,
+ * otherwise axl_false is returned.
+ */
+axl_bool             vortex_io_waiting_is_incremental          (VortexCtx * ctx)
+{
+	if (ctx == NULL)
+		return axl_false;
+	return ctx->waiting_remove_from != NULL;
+}
+
 /** 
  * @brief Allows to configure the is set operation for the socket on the fd set.
  *
@@ -1595,6 +1821,7 @@ void                 vortex_io_init (VortexCtx * ctx)
 	ctx->waiting_clear         = __vortex_io_waiting_epoll_clear;
 	ctx->waiting_wait_on       = __vortex_io_waiting_epoll_wait_on;
 	ctx->waiting_add_to        = __vortex_io_waiting_epoll_add_to;
+	ctx->waiting_remove_from   = __vortex_io_waiting_epoll_remove_from;
 	ctx->waiting_is_set        = NULL;
 	ctx->waiting_have_dispatch = __vortex_io_waiting_epoll_have_dispatch;
 	ctx->waiting_dispatch      = __vortex_io_waiting_epoll_dispatch;
@@ -1609,6 +1836,7 @@ void                 vortex_io_init (VortexCtx * ctx)
 	ctx->waiting_clear         = __vortex_io_waiting_poll_clear;
 	ctx->waiting_wait_on       = __vortex_io_waiting_poll_wait_on;
 	ctx->waiting_add_to        = __vortex_io_waiting_poll_add_to;
+	ctx->waiting_remove_from   = NULL;
 	ctx->waiting_is_set        = NULL;
 	ctx->waiting_have_dispatch = __vortex_io_waiting_poll_have_dispatch;
 	ctx->waiting_dispatch      = __vortex_io_waiting_poll_dispatch;
@@ -1623,6 +1851,7 @@ void                 vortex_io_init (VortexCtx * ctx)
 	ctx->waiting_clear         = __vortex_io_waiting_default_clear;
 	ctx->waiting_wait_on       = __vortex_io_waiting_default_wait_on;
 	ctx->waiting_add_to        = __vortex_io_waiting_default_add_to;
+	ctx->waiting_remove_from   = NULL;
 	ctx->waiting_is_set        = __vortex_io_waiting_default_is_set;
 	ctx->waiting_have_dispatch = NULL;
 	ctx->waiting_dispatch      = NULL;
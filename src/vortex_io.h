@@ -60,6 +60,9 @@ void                 vortex_io_waiting_set_clear_fd_group      (VortexCtx
 void                 vortex_io_waiting_set_add_to_fd_group     (VortexCtx           * ctx,
 								VortexIoAddToFdGroup add_to);
 
+void                 vortex_io_waiting_set_remove_from_fd_group (VortexCtx                * ctx,
+								 VortexIoRemoveFromFdGroup  remove_from);
+
 void                 vortex_io_waiting_set_is_set_fd_group     (VortexCtx           * ctx,
 								VortexIoIsSetFdGroup is_set);
 
@@ -87,6 +90,17 @@ axl_bool             vortex_io_waiting_invoke_add_to_fd_group  (VortexCtx
 								VortexConnection    * connection, 
 								axlPointer            fd_group);
 
+axl_bool             vortex_io_waiting_invoke_add_wake_to_fd_group (VortexCtx           * ctx,
+								    VORTEX_SOCKET         fds, 
+								    axlPointer            fd_group);
+
+void                 vortex_io_waiting_invoke_remove_from_fd_group (VortexCtx           * ctx,
+								    VORTEX_SOCKET         fds, 
+								    VortexConnection    * connection, 
+								    axlPointer            fd_group);
+
+axl_bool             vortex_io_waiting_is_incremental          (VortexCtx           * ctx);
+
 axl_bool             vortex_io_waiting_invoke_is_set_fd_group  (VortexCtx           * ctx,
 								VORTEX_SOCKET         fds, 
 								axlPointer fd_group,
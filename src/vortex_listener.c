@@ -49,6 +49,13 @@
 
 #define LOG_DOMAIN "vortex-listener"
 
+/** 
+ * @internal Max connections accepted from a listener socket each
+ * time it is found ready, so a connection storm doesn't keep the
+ * reader away from connections already accepted.
+ */
+#define VORTEX_LISTENER_ACCEPT_BATCH 256
+
 typedef struct _VortexListenerOnAcceptData {
 	VortexOnAcceptedConnection on_accept;
 	axlPointer                 on_accept_data;
@@ -493,33 +500,105 @@ VORTEX_SOCKET vortex_listener_accept (VORTEX_SOCKET server_socket)
 	return accept (server_socket, (struct sockaddr *)&inet_addr, &addrlen);
 }
 
-void vortex_listener_accept_connections (VortexCtx        * ctx,
-					 int                server_socket, 
-					 VortexConnection * listener)
+/** 
+ * @internal Accepts a connection from a non-blocking listener
+ * socket. The socket returned is already non-blocking and
+ * close-on-exec (using accept4 where available, which saves the
+ * fcntl calls).
+ */
+VORTEX_SOCKET __vortex_listener_accept_nonblocking (VORTEX_SOCKET server_socket)
 {
-	int   soft_limit, hard_limit, client_socket;
+	struct sockaddr_storage inet_addr;
+#if defined(AXL_OS_WIN32)
+	int               addrlen = sizeof (inet_addr);
+#else
+	socklen_t         addrlen = sizeof (inet_addr);
+#endif
+	VORTEX_SOCKET     client_socket;
 
-	/* accept the connection new connection */
-	client_socket = vortex_listener_accept (server_socket);
-	if (client_socket == VORTEX_SOCKET_ERROR) {
-		/* get values */
-		vortex_conf_get (ctx, VORTEX_SOFT_SOCK_LIMIT, &soft_limit);
-		vortex_conf_get (ctx, VORTEX_HARD_SOCK_LIMIT, &hard_limit);
-
-		vortex_log (VORTEX_LEVEL_CRITICAL, "accept () failed, server_socket=%d, soft-limit=%d, hard-limit=%d: (errno=%d) %s\n",
-			    server_socket, soft_limit, hard_limit, errno, vortex_errno_get_last_error ());
-		return;
+#if defined(__linux__) && defined(SOCK_NONBLOCK) && defined(SOCK_CLOEXEC)
+	client_socket = accept4 (server_socket, (struct sockaddr *)&inet_addr, &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+	client_socket = accept (server_socket, (struct sockaddr *)&inet_addr, &addrlen);
+	if (client_socket != VORTEX_SOCKET_ERROR) {
+		vortex_connection_set_sock_block (client_socket, axl_false);
+#if defined(AXL_OS_UNIX)
+		fcntl (client_socket, F_SETFD, fcntl (client_socket, F_GETFD) | FD_CLOEXEC);
+#endif
 	} /* end if */
+#endif
+	return client_socket;
+}
 
-	/* check we can support more sockets, if not close current
-	 * connection: function already closes client socket in the
-	 * case of failure */
-	if (! vortex_connection_check_socket_limit (ctx, client_socket))
-		return;
+/** 
+ * @internal Returns axl_true if the last accept failed because there
+ * are no more connections pending.
+ */
+axl_bool __vortex_listener_accept_drained (void)
+{
+#if defined(AXL_OS_WIN32)
+	return WSAGetLastError () == WSAEWOULDBLOCK;
+#else
+	return errno == VORTEX_EAGAIN || errno == VORTEX_EWOULDBLOCK;
+#endif
+}
 
-	/* instead of negotiate the connection at this point simply
-	 * accept it to negotiate it inside vortex_reader loop.  */
-	__vortex_listener_initial_accept (vortex_connection_get_ctx (listener), client_socket, listener, axl_true);
+void vortex_listener_accept_connections (VortexCtx        * ctx,
+					 int                server_socket, 
+					 VortexConnection * listener)
+{
+	int                soft_limit, hard_limit, client_socket;
+	int                accepted = 0;
+	axl_bool           multi_accept;
+	VortexConnection * master;
+
+	/* listeners created by this module have non-blocking sockets
+	 * so the backlog is drained on each notification; others
+	 * are accepted once */
+	multi_accept = PTR_TO_INT (vortex_connection_get_data (listener, "_vo:li:multi"));
+
+	/* connections accepted on a SO_REUSEPORT socket are reported
+	 * to the listener returned to the user */
+	master = vortex_connection_get_data (listener, "_vo:li:primary");
+	if (master == NULL)
+		master = listener;
+
+	while (accepted < VORTEX_LISTENER_ACCEPT_BATCH) {
+		/* accept the connection new connection */
+		if (multi_accept)
+			client_socket = __vortex_listener_accept_nonblocking (server_socket);
+		else
+			client_socket = vortex_listener_accept (server_socket);
+		if (client_socket == VORTEX_SOCKET_ERROR) {
+			/* nothing else pending */
+			if (multi_accept && __vortex_listener_accept_drained ())
+				return;
+			if (errno == VORTEX_EINTR)
+				continue;
+
+			/* get values */
+			vortex_conf_get (ctx, VORTEX_SOFT_SOCK_LIMIT, &soft_limit);
+			vortex_conf_get (ctx, VORTEX_HARD_SOCK_LIMIT, &hard_limit);
+
+			vortex_log (VORTEX_LEVEL_CRITICAL, "accept () failed, server_socket=%d, soft-limit=%d, hard-limit=%d: (errno=%d) %s\n",
+				    server_socket, soft_limit, hard_limit, errno, vortex_errno_get_last_error ());
+			return;
+		} /* end if */
+		accepted++;
+
+		/* check we can support more sockets, if not close
+		 * current connection: function already closes client
+		 * socket in the case of failure */
+		if (vortex_connection_check_socket_limit (ctx, client_socket)) {
+			/* instead of negotiate the connection at this
+			 * point simply accept it to negotiate it inside
+			 * vortex_reader loop.  */
+			__vortex_listener_initial_accept (vortex_connection_get_ctx (master), client_socket, master, axl_true);
+		} /* end if */
+
+		if (! multi_accept)
+			break;
+	} /* end while */
 
 	return;
 }
@@ -544,6 +623,21 @@ VORTEX_SOCKET     vortex_listener_sock_listen_common      (VortexCtx
 							   const char           * port,
 							   axlError            ** error,
 							   VortexNetTransport     transport)
+{
+	return __vortex_listener_sock_listen_full (ctx, host, port, error, transport, axl_false);
+}
+
+/** 
+ * @internal Implementation of vortex_listener_sock_listen_common
+ * that optionally enables SO_REUSEPORT before binding, so several
+ * sockets can listen on the same host:port.
+ */
+VORTEX_SOCKET     __vortex_listener_sock_listen_full      (VortexCtx            * ctx,
+							   const char           * host,
+							   const char           * port,
+							   axlError            ** error,
+							   VortexNetTransport     transport,
+							   axl_bool               reuse_port)
 {
 	struct hostent     * he    = NULL;
 	struct in_addr     * haddr = NULL;
@@ -637,6 +731,10 @@ VORTEX_SOCKET     vortex_listener_sock_listen_common      (VortexCtx
 	/* setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (char  *)&unit, sizeof(BOOL)); */
 #else
 	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &unit, sizeof (unit));
+#if defined(SO_REUSEPORT)
+	if (reuse_port && setsockopt (fd, SOL_SOCKET, SO_REUSEPORT, &unit, sizeof (unit)) != 0) 
+		vortex_log (VORTEX_LEVEL_WARNING, "failed to enable SO_REUSEPORT on socket %d (errno=%d)", fd, errno);
+#endif
 #endif 
 
 	/* get integer port */
@@ -777,6 +875,119 @@ VORTEX_SOCKET     vortex_listener_sock_listen6      (VortexCtx   * ctx,
 	return vortex_listener_sock_listen_common (ctx, host, port, error, VORTEX_IPv6);
 }
 
+#if defined(SO_REUSEPORT) && defined(AXL_OS_UNIX)
+/** 
+ * @internal Returns the port the provided listening socket is bound
+ * to (or 0 if it fails).
+ */
+int __vortex_listener_socket_port (VORTEX_SOCKET fd)
+{
+	struct sockaddr_storage addr;
+	socklen_t               addrlen = sizeof (addr);
+
+	if (getsockname (fd, (struct sockaddr *) &addr, &addrlen) != 0)
+		return 0;
+	if (addr.ss_family == AF_INET6)
+		return ntohs (((struct sockaddr_in6 *) &addr)->sin6_port);
+	return ntohs (((struct sockaddr_in *) &addr)->sin_port);
+}
+
+/** 
+ * @internal Releases the reference held on a SO_REUSEPORT socket.
+ */
+void __vortex_listener_release_shard (axlPointer ptr)
+{
+	vortex_connection_unref ((VortexConnection *) ptr, "reuseport shard");
+	return;
+}
+
+/** 
+ * @internal On close handler installed on listeners with SO_REUSEPORT
+ * sockets: closes all of them.
+ */
+void __vortex_listener_close_shards (VortexConnection * listener, axlPointer user_data)
+{
+	axlList          * shards = vortex_connection_get_data (listener, "_vo:li:shards");
+	int                iterator;
+
+	if (shards == NULL)
+		return;
+	for (iterator = 0; iterator < axl_list_length (shards); iterator++) 
+		vortex_connection_shutdown (axl_list_get_nth (shards, iterator));
+
+	/* release the list (and the references it holds) */
+	vortex_connection_set_data (listener, "_vo:li:shards", NULL);
+	return;
+}
+#endif
+
+/** 
+ * @internal Opens the additional SO_REUSEPORT sockets configured
+ * (VORTEX_LISTENER_REUSEPORT) for the listener provided, each one
+ * watched by a different reader thread. They are closed along with
+ * the listener, and connections accepted on them report the
+ * listener as their master.
+ */
+void __vortex_listener_open_shards (VortexCtx          * ctx,
+				    VortexConnection   * listener,
+				    const char         * host,
+				    VortexNetTransport   transport)
+{
+#if defined(SO_REUSEPORT) && defined(AXL_OS_UNIX)
+	axlList          * shards;
+	VortexConnection * shard;
+	VORTEX_SOCKET      fd;
+	axlError         * error = NULL;
+	char             * str_port;
+	int                iterator;
+
+	/* bind the port finally used (the listener may have been
+	 * created with port 0) */
+	str_port = axl_strdup_printf ("%d", __vortex_listener_socket_port (vortex_connection_get_socket (listener)));
+	shards   = axl_list_new (axl_list_always_return_1, __vortex_listener_release_shard);
+
+	for (iterator = 1; iterator < ctx->listener_reuseport; iterator++) {
+		fd = __vortex_listener_sock_listen_full (ctx, host, str_port, &error, transport, axl_true);
+		if (fd < 0) {
+			vortex_log (VORTEX_LEVEL_WARNING, "unable to open SO_REUSEPORT socket %d for %s:%s: %s", 
+				    iterator, host, str_port, axl_error_get (error));
+			axl_error_free (error);
+			break;
+		} /* end if */
+
+		shard = vortex_connection_new_empty (ctx, fd, VortexRoleMasterListener);
+		if (shard == NULL) {
+			vortex_close_socket (fd);
+			break;
+		} /* end if */
+
+		/* drain the accept backlog on each notification */
+		if (vortex_connection_set_sock_block (fd, axl_false))
+			vortex_connection_set_data (shard, "_vo:li:multi", INT_TO_PTR (axl_true));
+
+		/* report connections accepted to the listener */
+		if (vortex_connection_ref (listener, "master ref"))
+			vortex_connection_set_data_full (shard, "_vo:li:primary", listener, NULL, __vortex_listener_release_master_ref);
+
+		/* keep a reference while the listener is running,
+		 * the initial one is owned by the reader */
+		if (vortex_connection_ref (shard, "reuseport shard"))
+			axl_list_append (shards, shard);
+		__vortex_reader_watch_listener_at (ctx, shard, iterator);
+	} /* end for */
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "listener id=%d running with %d additional SO_REUSEPORT sockets", 
+		    vortex_connection_get_id (listener), axl_list_length (shards));
+
+	vortex_connection_set_data_full (listener, "_vo:li:shards", shards, NULL, (axlDestroyFunc) axl_list_free);
+	vortex_connection_set_on_close_full (listener, __vortex_listener_close_shards, NULL);
+	axl_free (str_port);
+#else
+	vortex_log (VORTEX_LEVEL_WARNING, "SO_REUSEPORT is not supported on this platform, VORTEX_LISTENER_REUSEPORT ignored");
+#endif
+	return;
+}
+
 axlPointer __vortex_listener_new (VortexListenerData * data)
 {
 	char               * host          = data->host;
@@ -793,6 +1004,7 @@ axlPointer __vortex_listener_new (VortexListenerData * data)
 	VORTEX_SOCKET        fd;
 	struct sockaddr_in   sin;
 	VortexNetTransport   transport     = data->transport;
+	axl_bool             reuse_port;
 
 	/* handlers received (may be both null) */
 	VortexListenerReady      on_ready       = data->on_ready;
@@ -801,12 +1013,17 @@ axlPointer __vortex_listener_new (VortexListenerData * data)
 	/* free data */
 	axl_free (data);
 
+	/* open several sockets on the same port when configured
+	 * (only for listeners watched by the reader) */
+	reuse_port = register_conn && ctx->listener_reuseport > 1;
+
 	/* allocate listener, try to guess IPv6 support */
 	if (strstr (host, ":") || transport == VORTEX_IPv6) {
 		vortex_log (VORTEX_LEVEL_DEBUG, "Detected IPv6 listener: %s:%s..", host, str_port);
-		fd = vortex_listener_sock_listen6 (ctx, host, str_port, &error);
+		transport = VORTEX_IPv6;
 	} else
-		fd = vortex_listener_sock_listen (ctx, host, str_port, &error);
+		transport = VORTEX_IPv4;
+	fd = __vortex_listener_sock_listen_full (ctx, host, str_port, &error, transport, reuse_port);
 
 	if (fd == VORTEX_SOCKET_ERROR || fd == -1) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "Failed to create listener socket, fd reported is an error %d. Unable to find on %s:%s. Error found: %s", fd,
@@ -825,6 +1042,14 @@ axlPointer __vortex_listener_new (VortexListenerData * data)
 	if (listener) {
 		vortex_log (VORTEX_LEVEL_DEBUG, "listener reference created (%p, id: %d, socket: %d)", listener, 
 			    vortex_connection_get_id (listener), fd);
+
+		/* drain the accept backlog on each notification */
+		if (vortex_connection_set_sock_block (fd, axl_false))
+			vortex_connection_set_data (listener, "_vo:li:multi", INT_TO_PTR (axl_true));
+
+		/* open the rest of sockets sharing the port */
+		if (reuse_port)
+			__vortex_listener_open_shards (ctx, listener, host, transport);
 	} else {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "vortex_connection_new_empty() failed to create listener at %s:%s, closing socket: %d", 
 			    host, str_port, fd);
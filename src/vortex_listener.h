@@ -152,6 +152,13 @@ VortexConnection * __vortex_listener_initial_accept_full (VortexCtx            *
 
 axl_bool __vortex_listener_check_port_sharing (VortexCtx * ctx, VortexConnection * connection);
 
+VORTEX_SOCKET     __vortex_listener_sock_listen_full      (VortexCtx            * ctx,
+							   const char           * host,
+							   const char           * port,
+							   axlError            ** error,
+							   VortexNetTransport     transport,
+							   axl_bool               reuse_port);
+
 
 /* @} */
 
@@ -38,6 +38,11 @@
 #include <vortex_payload_feeder.h>
 #include <vortex_payload_feeder_private.h>
 
+#if defined(AXL_OS_UNIX)
+#include <sys/mman.h>
+#include <limits.h>
+#endif
+
 /** 
  * @brief Allows to create a new payload feeder object that will be
  * defined by feeder handler provided.
@@ -231,6 +236,194 @@ VortexPayloadFeeder * vortex_payload_feeder_file (const char * path,
 	return vortex_payload_feeder_new (__vortex_payload_feeder_file, state);
 }
 
+typedef struct _VortexPayloadMappedFeeder {
+	int             size;
+	int             offset;
+	int             fd;
+	char          * mapped;
+	axl_bool        mime_pending;
+} VortexPayloadMappedFeeder;
+
+axl_bool __vortex_payload_feeder_file_mapped (VortexCtx               * ctx,
+					      VortexPayloadFeederOp     op_type,
+					      VortexPayloadFeeder     * feeder,
+					      axlPointer                param1,
+					      axlPointer                param2,
+					      axlPointer                user_data)
+{
+	VortexPayloadMappedFeeder * state  = user_data;
+	int                       * size   = param1;
+	char                      * buffer = param2;
+	int                         chunk;
+
+	switch (op_type) {
+	case PAYLOAD_FEEDER_GET_SIZE:
+		/* return pending size (never 0, so an empty file
+		 * still produces its last empty frame) */
+		(* size) = (state->size - state->offset) + (state->mime_pending ? 2 : 0);
+		if ((* size) <= 0)
+			(* size) = 1;
+		return axl_true;
+	case PAYLOAD_FEEDER_GET_CONTENT:
+		/* content requested without using the mapping directly
+		 * (see vortex_payload_feeder_get_mapped) */
+		chunk = 0;
+		if (state->mime_pending && (* size) >= 2) {
+			state->mime_pending = axl_false;
+
+			buffer [0] = '\r';
+			buffer [1] = '\n';
+			chunk      = 2;
+		} /* end if */
+		if (((* size) - chunk) > (state->size - state->offset))
+			(* size) = (state->size - state->offset) + chunk;
+		memcpy (buffer + chunk, state->mapped + state->offset, (* size) - chunk);
+		state->offset += (* size) - chunk;
+		return axl_true;
+	case PAYLOAD_FEEDER_IS_FINISHED:
+		(* size) = ! state->mime_pending && state->offset >= state->size;
+		return axl_true;
+	case PAYLOAD_FEEDER_RELEASE:
+#if defined(AXL_OS_UNIX)
+		if (state->mapped)
+			munmap (state->mapped, state->size);
+		close (state->fd);
+#endif
+		axl_free (state);
+		return axl_true;
+	} /* end switch */
+
+	/* this code is never reached */
+	return axl_true;
+}
+
+/** 
+ * @brief Creates a feeder object connected to the file found at the
+ * path provided, sending its content without copying it into
+ * intermediate buffers.
+ *
+ * The file is mapped into memory, so the vortex sequencer frames it
+ * by referencing the mapped content. On connections writing directly
+ * to the socket (plain TCP or kernel TLS, see \ref
+ * vortex_tls_set_ktls), the content is sent with sendfile() between
+ * the frame header and its trailer. On other connections (for
+ * example TLS handled by the library) the content is copied only
+ * once, while the frame is built.
+ *
+ * The function works like \ref vortex_payload_feeder_file and
+ * accepts the same parameters. On platforms where the file can't be
+ * mapped, or if mapping the file fails, the function returns a feeder
+ * created by \ref vortex_payload_feeder_file.
+ *
+ * The file must not be truncated while it is being sent.
+ *
+ * @param path The path to the file that will be feeded into the send operation.
+ *
+ * @param add_mime_head Adds an empty mime header before sending the
+ * content found on the file (see \ref vortex_payload_feeder_file).
+ *
+ * @return A reference to a \ref VortexPayloadFeeder object or NULL if
+ * it fails.
+ */
+VortexPayloadFeeder * vortex_payload_feeder_file_mapped (const char * path,
+							 axl_bool     add_mime_head)
+{
+#if defined(AXL_OS_UNIX)
+	VortexPayloadMappedFeeder * state;
+	struct stat                 stats;
+	char                      * mapped = NULL;
+	int                         fd;
+
+	v_return_val_if_fail (path, NULL);
+
+	/* open file */
+	fd = open (path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	/* get size: files that can't be represented with an int are
+	 * sent with the default file feeder */
+	if (fstat (fd, &stats) != 0 || ! S_ISREG (stats.st_mode) || stats.st_size > (INT_MAX - 2)) {
+		close (fd);
+		return vortex_payload_feeder_file (path, add_mime_head);
+	} /* end if */
+
+	/* map file (empty files can't be mapped) */
+	if (stats.st_size > 0) {
+		mapped = mmap (NULL, stats.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		if (mapped == MAP_FAILED) {
+			close (fd);
+			return vortex_payload_feeder_file (path, add_mime_head);
+		} /* end if */
+
+		/* content is read once, from the beginning */
+		madvise (mapped, stats.st_size, MADV_SEQUENTIAL);
+	} /* end if */
+
+	/* create state */
+	state               = axl_new (VortexPayloadMappedFeeder, 1);
+	state->mime_pending = add_mime_head;
+	state->fd           = fd;
+	state->mapped       = mapped;
+	state->size         = stats.st_size;
+
+	/* ok, now create the feeder */
+	return vortex_payload_feeder_new (__vortex_payload_feeder_file_mapped, state);
+#else
+	/* no mapping support: use default file feeder */
+	return vortex_payload_feeder_file (path, add_mime_head);
+#endif
+}
+
+/** 
+ * @internal Returns next payload to be sent from a feeder created by
+ * \ref vortex_payload_feeder_file_mapped without copying it: the
+ * chunk references the optional empty mime header, the content
+ * mapped and the place where that content is found at the file.
+ *
+ * @return axl_false if the feeder does not map its content (the
+ * caller must use \ref vortex_payload_feeder_get_content), otherwise
+ * axl_true is returned and the chunk is updated.
+ */
+axl_bool              vortex_payload_feeder_get_mapped (VortexPayloadFeeder      * feeder,
+							int                        size_to_copy,
+							VortexPayloadFeederChunk * chunk)
+{
+	VortexPayloadMappedFeeder * state;
+
+	if (feeder == NULL || chunk == NULL || feeder->handler != __vortex_payload_feeder_file_mapped)
+		return axl_false;
+	state = feeder->user_data;
+
+	/* clear chunk */
+	memset (chunk, 0, sizeof (VortexPayloadFeederChunk));
+	chunk->fd = state->fd;
+
+	/* initial mime header */
+	if (state->mime_pending && size_to_copy >= 2) {
+		state->mime_pending = axl_false;
+
+		chunk->prefix       = "\x0D\x0A";
+		chunk->prefix_size  = 2;
+		size_to_copy       -= 2;
+	} /* end if */
+
+	/* content available */
+	if (size_to_copy > (state->size - state->offset))
+		size_to_copy = state->size - state->offset;
+	if (size_to_copy > 0) {
+		chunk->content      = state->mapped + state->offset;
+		chunk->content_size = size_to_copy;
+		chunk->offset       = state->offset;
+		state->offset      += size_to_copy;
+	} /* end if */
+
+	/* accumulate bytes transferred */
+	feeder->bytes_transferred += chunk->prefix_size + chunk->content_size;
+
+	return axl_true;
+}
+
 /** 
  * @internal Makes the feeder to return pending content size to be
  * feeded.
@@ -52,6 +52,9 @@ VortexPayloadFeeder * vortex_payload_feeder_new (VortexPayloadFeederHandler   ha
 VortexPayloadFeeder * vortex_payload_feeder_file (const char * path, 
 						  axl_bool     add_mime_head);
 
+VortexPayloadFeeder * vortex_payload_feeder_file_mapped (const char * path, 
+							 axl_bool     add_mime_head);
+
 int                   vortex_payload_feeder_get_pending_size (VortexPayloadFeeder * feeder);
 
 int                   vortex_payload_feeder_get_content (VortexPayloadFeeder * feeder,
@@ -95,4 +95,33 @@ struct _VortexPayloadFeeder {
 	 */
 	VortexChannel              * channel;
 };
+
+/** 
+ * @internal Payload returned by a feeder that maps its content (see
+ * vortex_payload_feeder_get_mapped), referenced while the frame is
+ * built and sent.
+ */
+typedef struct _VortexPayloadFeederChunk {
+	/** 
+	 * @internal Optional content placed before the mapped content
+	 * (empty mime header) and its size.
+	 */
+	const char                 * prefix;
+	int                          prefix_size;
+	/** 
+	 * @internal Mapped content and its size.
+	 */
+	const char                 * content;
+	int                          content_size;
+	/** 
+	 * @internal File descriptor and offset where the mapped
+	 * content is found (used to send it with sendfile).
+	 */
+	int                          fd;
+	long                         offset;
+} VortexPayloadFeederChunk;
+
+axl_bool              vortex_payload_feeder_get_mapped (VortexPayloadFeeder      * feeder,
+							int                        size_to_copy,
+							VortexPayloadFeederChunk * chunk);
 #endif
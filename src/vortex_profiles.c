@@ -886,6 +886,38 @@ axl_bool      vortex_profiles_is_defined_close (VortexCtx * ctx,
 	return (profile->close != NULL);
 }
 
+/** 
+ * @internal Invokes the first level frame received handler (profile)
+ * for the frame received on the provided channel, from the caller
+ * thread. Used by the channel delivery queue. The frame is not
+ * released.
+ *
+ * @return axl_true if the frame was delivered, otherwise axl_false
+ * (no profile received handler defined).
+ */
+axl_bool      vortex_profiles_deliver_frame (VortexChannel    * channel,
+					     VortexConnection * connection,
+					     VortexFrame      * frame)
+{
+	VortexCtx     * ctx = vortex_connection_get_ctx (connection);
+	VortexProfile * profile;
+
+	/* get profile reference */
+	profile = __vortex_profiles_get_and_ref (ctx->registered_profiles, vortex_channel_get_profile (channel), "frame_received");
+	if ((profile == NULL) || (profile->received == NULL)) {
+		/* release profile */
+		__vortex_profiles_unref (profile, "frame_received");
+		return axl_false;
+	} /* end if */
+
+	/* invoke frame received on this channel */
+	profile->received (channel, connection, frame, profile->received_user_data);
+
+	/* release profile */
+	__vortex_profiles_unref (profile, "frame_received");
+	return axl_true;
+}
+
 typedef struct _VortexProfileReceivedData {
 	VortexProfile    * profile;
 	int                channel_num;
@@ -949,29 +981,9 @@ axlPointer __vortex_profiles_invoke_frame_received (axlPointer __data)
 		goto free_resources;
 	} /* end if */
 
-	/* check to enforce serialize */
-	if (vortex_channel_check_serialize (CONN_CTX(connection), connection, channel, frame)) {
-		/* release profile */
-		__vortex_profiles_unref (profile, "frame_received");
-
-		/* if the function returns axl_true, we must return
-		 * because the message was stored for later
-		 * delivery */
-		return NULL;
-	} /* end if */
-
- deliver_frame:
-
 	/* invoke frame received on this channel */
 	received (channel, connection, frame, user_data);
 
-	/* check serialize to broadcast other waiting threads */
-	if (vortex_channel_check_serialize_pending (CONN_CTX(connection), connection, channel, &frame)) {
-		/* if previous function returns axl_true, a new frame
-		 * reference we have to deliver */
-		goto deliver_frame;
-	}
-
 	/* before frame receive handler we have to check if client
 	 * have closed its connection */
 	is_connected = vortex_connection_is_ok (connection, axl_false);
@@ -1056,6 +1068,15 @@ axl_bool      vortex_profiles_invoke_frame_received (const char       * uri,
 		return axl_false;
 	}
 
+	/* serialized channels deliver through the channel delivery
+	 * queue (profile is looked up again at delivery time) */
+	channel = vortex_connection_get_channel (connection, channel_num);
+	if (channel != NULL && __vortex_channel_delivery_enabled (channel)) {
+		/* release profile */
+		__vortex_profiles_unref (profile, "frame_received");
+		return __vortex_channel_delivery_push (connection, channel, frame);
+	} /* end if */
+
 	/*
 	 * invoke frame received handler. Because frame must be run
 	 * inside a separated thread (as defined in user doc) we have
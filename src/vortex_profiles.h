@@ -97,6 +97,10 @@ axl_bool  vortex_profiles_invoke_frame_received   (const char       * uri,
 						   VortexConnection * connection,
 						   VortexFrame      * frame);
 
+axl_bool  vortex_profiles_deliver_frame           (VortexChannel    * channel,
+						   VortexConnection * connection,
+						   VortexFrame      * frame);
+
 axl_bool  vortex_profiles_is_defined_received     (VortexCtx        * ctx,
 						   const char       * uri);
 
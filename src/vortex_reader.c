@@ -60,6 +60,11 @@ typedef enum {CONNECTION,
 	      FOREACH
 } WatchType;
 
+typedef struct _VortexReaderCountdown {
+	VortexMutex          mutex;
+	int                  pending;
+}VortexReaderCountdown;
+
 typedef struct _VortexReaderData {
 	WatchType            type;
 	VortexConnection   * connection;
@@ -68,6 +73,9 @@ typedef struct _VortexReaderData {
 	/* queue used to notify that the foreach operation was
 	 * finished: currently only used for type == FOREACH */
 	VortexAsyncQueue   * notify;
+	/* shared by all reader threads running the same foreach
+	 * operation, the last one to finish notifies */
+	VortexReaderCountdown * countdown;
 }VortexReaderData;
 
 /** 
@@ -137,6 +145,10 @@ axl_bool      __vortex_reader_update_incoming_buffer_and_notify (VortexCtx
 	unsigned int        ackno;
 	int                 window;
 	VortexWriterData    writer;
+	/* buffer used to produce the SEQ frame: it is sent before
+	 * returning (vortex_sequencer_direct_send) and it is local so
+	 * several reader threads can run this code at the same time */
+	char                seq_frame[50];
 
 	/* now, we have to update current incoming max seq no allowed
 	 * for future checkings on this channel and to generate a SEQ
@@ -156,14 +168,13 @@ axl_bool      __vortex_reader_update_incoming_buffer_and_notify (VortexCtx
 			 * Now create a SEQ frame with higher priority to
 			 * report remote side that the current max seq no
 			 * value have been updated. */
+			memset (&writer, 0, sizeof (VortexWriterData));
 			writer.type        = VORTEX_FRAME_TYPE_SEQ;
 			writer.msg_no      = 0;
 			writer.the_frame   = vortex_frame_seq_build_up_from_params_buffer (vortex_channel_get_number (channel),
 											   ackno,
 											   window,
-											   ctx->reader_seq_frame,
-											   /* the following size value is found at the 
-											      reader_seq_frame declaration found at vortex_ctx_private.h */
+											   seq_frame,
 											   50,
 											   &(writer.the_size));
 			/* writer.the_size    = strlen (writer.the_frame); */
@@ -626,41 +637,119 @@ void __vortex_reader_process_socket (VortexCtx        * ctx,
 }
 
 /** 
- * @internal Reads from a connection until its transport holds nothing back.
+ * @internal Reads and dispatches frames from a connection until its
+ * transport has nothing more to be read, or until the frame budget
+ * configured (VORTEX_READER_FRAME_BUDGET) is used.
+ *
+ * \ref __vortex_reader_process_socket handles a single frame per call,
+ * so calling it only once per readiness event makes a connection that
+ * delivered a burst of pipelined frames go through the whole
+ * wait/dispatch loop for each one. Instead, this function keeps on
+ * processing while:
  *
- * \ref __vortex_reader_process_socket handles a single frame per call, which
- * is right for a byte stream transport: whatever it did not consume is still
- * in the socket, so the I/O waiting mechanism reports the connection again.
+ * - The connection input buffer holds a complete frame (the frame
+ *   factory reads from the transport in chunks, see
+ *   vortex_frame_readline, so a single read may bring several frames).
  *
- * That assumption breaks for a transport that delivers messages rather than
- * octets. A WebSocket frame may carry more than one BEEP frame, and the
- * transport hands vortex the whole thing at once; the octets beyond the frame
- * being assembled are then buffered inside the transport, where select(),
- * poll() and epoll() cannot see them, because the socket itself is empty. The
- * connection would stall there for ever, with no error reported at either end.
+ * - The transport reports content it is buffering where select(),
+ *   poll() and epoll() cannot see it, because the socket itself is
+ *   empty (see \ref vortex_connection_set_pending_input). A TLS record
+ *   or a WebSocket frame may carry more than one BEEP frame.
  *
- * Transports able to buffer report how much they are holding through the
- * "try_read_pending" connection key, so keep reading while that says there is
- * something left. Nothing happens for transports that never set it.
+ * - Only when drain is axl_true: the socket has more content to be
+ *   read (checked by reading it into the input buffer, until it
+ *   would block).
+ *
+ * @return axl_true if the budget was used while the connection still
+ * holds complete frames already read, which must be processed without
+ * waiting for the transport (otherwise the connection would stall
+ * with no error reported at either end). Otherwise axl_false.
  */
-void __vortex_reader_process_socket_pending (VortexCtx        * ctx, 
-					     VortexConnection * connection)
+axl_bool __vortex_reader_process_socket_pending (VortexCtx        * ctx, 
+						 VortexConnection * connection,
+						 axl_bool           drain)
 {
-	do {
+	int processed = 0;
+
+	while (axl_true) {
 		__vortex_reader_process_socket (ctx, connection);
+		processed++;
 
-		/* transports that cannot buffer never set this, so they pay
-		 * one hash lookup per readable event and nothing else */
-		if (PTR_TO_INT (vortex_connection_get_data (connection, "try_read_pending")) <= 0)
-			break;
+		/* a preread handler taking over or an unwatch request
+		 * must stop processing buffered content */
+		if (connection->reader_unwatch || vortex_connection_is_defined_preread_handler (connection))
+			return axl_false;
+		if (! vortex_connection_is_ok (connection, axl_false))
+			return axl_false;
 
-		/* clear it before going round again: the flag must be set
-		 * afresh by a read that actually happens, so that a connection
-		 * which stops reading (unwatched, or with a preread handler
-		 * taking over) cannot spin here */
-		vortex_connection_set_data (connection, "try_read_pending", NULL);
+		/* check for content pending: complete frames already
+		 * read or content buffered by the transport. The
+		 * transport value is cleared before going round
+		 * again: it must be set afresh by a read that
+		 * actually happens, so that a connection which stops
+		 * reading cannot spin here */
+		if (! __vortex_frame_input_has_frame (connection)) {
+			if (connection->pending_input > 0) 
+				connection->pending_input = 0;
+			else if (! drain || __vortex_frame_fill_input (connection) <= 0) {
+				/* nothing more to read without blocking
+				 * (errors and remote close are reported
+				 * at the next read) */
+				return axl_false;
+			} /* end if */
+		} /* end if */
 
-	} while (vortex_connection_is_ok (connection, axl_false));
+		/* check budget */
+		if (ctx->reader_frame_budget > 0 && processed >= ctx->reader_frame_budget) {
+			vortex_log (VORTEX_LEVEL_DEBUG, "frame budget (%d) reached on conn-id=%d, content pending",
+				    ctx->reader_frame_budget, vortex_connection_get_id (connection));
+			return axl_true;
+		} /* end if */
+	} /* end while */
+
+	return axl_false;
+}
+
+/** 
+ * @internal Processes incoming content on the provided connection,
+ * flagging it into the shard backlog in the case it still holds
+ * complete frames once the frame budget was used.
+ */
+void __vortex_reader_process_input (VortexReaderShard * shard,
+				    VortexConnection  * connection,
+				    axl_bool            drain)
+{
+	if (__vortex_reader_process_socket_pending (shard->ctx, connection, drain)) {
+		connection->reader_backlog = axl_true;
+		shard->backlog             = axl_true;
+	} /* end if */
+	return;
+}
+
+/** 
+ * @internal Processes connections flagged with pending frames
+ * (reader_backlog), giving each one a new frame budget. Content is
+ * not read from the socket (only what was already read), so the
+ * backlog is always drained after some rounds.
+ */
+void __vortex_reader_process_backlog (VortexReaderShard * shard)
+{
+	VortexConnection * connection;
+
+	shard->backlog = axl_false;
+	axl_list_cursor_first (shard->conn_cursor);
+	while (axl_list_cursor_has_item (shard->conn_cursor)) {
+		connection = axl_list_cursor_get (shard->conn_cursor);
+		if (connection->reader_backlog) {
+			connection->reader_backlog = axl_false;
+			if (vortex_connection_is_ok (connection, axl_false) && 
+			    ! vortex_connection_is_blocked (connection) && ! connection->reader_unwatch)
+				__vortex_reader_process_input (shard, connection, axl_false);
+		} /* end if */
+
+		/* get the next */
+		axl_list_cursor_next (shard->conn_cursor);
+	} /* end while */
 
 	return;
 }
@@ -671,12 +760,15 @@ void __vortex_reader_process_socket_pending (VortexCtx        * ctx,
  * @brief Classify vortex reader items to be managed, that is,
  * connections or listeners.
  * 
+ * @param shard The reader thread state (connections registered
+ * holding frames already read are flagged into its backlog).
+ *
  * @param data The internal vortex reader data to be managed.
  * 
  * @return axl_true if the item to be managed was clearly read or axl_false if
  * an error on registering the item was produced.
  */
-axl_bool   vortex_reader_register_watch (VortexReaderData * data, axlList * con_list, axlList * srv_list)
+axl_bool   vortex_reader_register_watch (VortexReaderShard * shard, VortexReaderData * data, axlList * con_list, axlList * srv_list)
 {
 	VortexConnection * connection;
 #if defined(ENABLE_VORTEX_LOG)
@@ -707,6 +799,15 @@ axl_bool   vortex_reader_register_watch (VortexReaderData * data, axlList * con_
 		vortex_log (VORTEX_LEVEL_DEBUG, "new connection (conn-id=%d) to be watched (%d)", 
 			    vortex_connection_get_id (connection), vortex_connection_get_socket (connection));
 		axl_list_append (con_list, connection);
+		vortex_atomic_add (&shard->watched, 1);
+
+		/* frames already read while the connection was not
+		 * watched (for example during greetings exchange) must
+		 * not wait for the transport to be ready again */
+		if (__vortex_frame_input_has_frame (connection)) {
+			connection->reader_backlog = axl_true;
+			shard->backlog             = axl_true;
+		} /* end if */
 
 		break;
 	case LISTENER:
@@ -716,6 +817,7 @@ axl_bool   vortex_reader_register_watch (VortexReaderData * data, axlList * con_
 			    vortex_connection_get_port (connection),
 			    vortex_connection_get_id (connection));
 		axl_list_append (srv_list, connection);
+		vortex_atomic_add (&shard->watched, 1);
 		break;
 	case TERMINATE:
 	case IO_WAIT_CHANGED:
@@ -729,42 +831,55 @@ axl_bool   vortex_reader_register_watch (VortexReaderData * data, axlList * con_
 	return axl_true;
 }
 
+/** 
+ * @internal Function used to flag the connection as not registered in
+ * the fd group (which is about to be destroyed).
+ */
+axl_bool __vortex_reader_reset_registered (axlPointer ptr, axlPointer data)
+{
+	((VortexConnection *) ptr)->reader_registered = axl_false;
+	return axl_false; /* not found so all items are iterated */
+}
+
 /** 
  * @internal Vortex function to implement vortex reader I/O change.
  */
-VortexReaderData * __vortex_reader_change_io_mech (VortexCtx        * ctx,
-						   axlPointer       * on_reading, 
-						   axlList          * con_list, 
-						   axlList          * srv_list, 
-						   VortexReaderData * data)
+VortexReaderData * __vortex_reader_change_io_mech (VortexReaderShard * shard,
+						   VortexReaderData  * data)
 {
 	/* get current context */
+	VortexCtx        * ctx = shard->ctx;
 	VortexReaderData * result;
 
-	vortex_log (VORTEX_LEVEL_DEBUG, "found I/O notification change");
+	vortex_log (VORTEX_LEVEL_DEBUG, "found I/O notification change (reader shard %d)", shard->id);
 	
 	/* unref IO waiting object */
-	vortex_io_waiting_invoke_destroy_fd_group (ctx, *on_reading); 
-	*on_reading = NULL;
+	axl_list_lookup (shard->conn_list, __vortex_reader_reset_registered, NULL);
+	axl_list_lookup (shard->srv_list, __vortex_reader_reset_registered, NULL);
+	vortex_io_waiting_invoke_destroy_fd_group (ctx, shard->on_reading); 
+	shard->on_reading = NULL;
 	
 	/* notify preparation done and lock until new
 	 * I/O is installed */
 	vortex_log (VORTEX_LEVEL_DEBUG, "notify vortex reader preparation done");
-	vortex_async_queue_push (ctx->reader_stopped, INT_TO_PTR(1));
+	vortex_async_queue_push (shard->stopped, INT_TO_PTR(1));
 	
 	/* free data use the function that includes that knoledge */
-	vortex_reader_register_watch (data, con_list, srv_list);
+	vortex_reader_register_watch (shard, data, shard->conn_list, shard->srv_list);
 	
 	/* lock */
 	vortex_log (VORTEX_LEVEL_DEBUG, "lock until new API is installed");
-	result = vortex_async_queue_pop (ctx->reader_queue);
+	result = vortex_async_queue_pop (shard->queue);
 
 	/* initialize the read set */
 	vortex_log (VORTEX_LEVEL_DEBUG, "unlocked, creating new I/O mechanism used current API");
-	*on_reading = vortex_io_waiting_invoke_create_fd_group (ctx, READ_OPERATIONS);
-	if (*on_reading == NULL)
+	shard->on_reading  = vortex_io_waiting_invoke_create_fd_group (ctx, READ_OPERATIONS);
+	if (shard->on_reading == NULL)
 		vortex_log (VORTEX_LEVEL_CRITICAL,
 			    "failed to create I/O waiting set after changing I/O mechanism, vortex reader will not be able to watch connections");
+	shard->incremental = vortex_io_waiting_is_incremental (ctx);
+	shard->review      = axl_true;
+	shard->wake_added  = axl_false;
 
 	return result;
 }
@@ -817,6 +932,21 @@ void vortex_reader_foreach_impl (VortexCtx        * ctx,
 
 	/* notify that the foreach operation was completed */
  foreach_impl_notify:
+	if (data->countdown) {
+		/* other reader threads are running the same
+		 * operation, only the last one notifies */
+		vortex_mutex_lock (&data->countdown->mutex);
+		data->countdown->pending--;
+		if (data->countdown->pending > 0) {
+			vortex_mutex_unlock (&data->countdown->mutex);
+			return;
+		} /* end if */
+		vortex_mutex_unlock (&data->countdown->mutex);
+
+		vortex_mutex_destroy (&data->countdown->mutex);
+		axl_free (data->countdown);
+		data->countdown = NULL;
+	} /* end if */
 	vortex_async_queue_push (data->notify, INT_TO_PTR (1));
 
 	return;
@@ -872,17 +1002,14 @@ axl_bool  vortex_reader_invoke_frame_received       (VortexCtx        * ctx,
  * @return axl_true to keep vortex reader working, axl_false if vortex reader
  * should stop.
  */
-axl_bool      vortex_reader_read_queue (VortexCtx  * ctx,
-					axlList    * con_list, 
-					axlList    * srv_list, 
-					axlPointer * on_reading)
+axl_bool      vortex_reader_read_queue (VortexReaderShard * shard)
 {
 	/* get current context */
 	VortexReaderData * data;
 	int                should_continue;
 
 	do {
-		data            = vortex_async_queue_pop (ctx->reader_queue);
+		data            = vortex_async_queue_pop (shard->queue);
 
 		/* check if we have to continue working */
 		should_continue = (data->type != TERMINATE);
@@ -890,18 +1017,17 @@ axl_bool      vortex_reader_read_queue (VortexCtx  * ctx,
 		/* check if the io/wait mech have changed */
 		if (data->type == IO_WAIT_CHANGED) {
 			/* change io mechanism */
-			data = __vortex_reader_change_io_mech (ctx,
-							       on_reading, 
-							       con_list, 
-							       srv_list, 
-							       data);
+			data = __vortex_reader_change_io_mech (shard, data);
 		} else if (data->type == FOREACH) {
 			/* do a foreach operation */
-			vortex_reader_foreach_impl (ctx, con_list, srv_list, data);
+			vortex_reader_foreach_impl (shard->ctx, shard->conn_list, shard->srv_list, data);
 
 		} /* end if */
 
-	}while (!vortex_reader_register_watch (data, con_list, srv_list));
+	}while (!vortex_reader_register_watch (shard, data, shard->conn_list, shard->srv_list));
+
+	/* new connections (or a restart request) */
+	shard->review = axl_true;
 
 	return should_continue;
 }
@@ -911,29 +1037,26 @@ axl_bool      vortex_reader_read_queue (VortexCtx  * ctx,
  * more connections to watch, to check if it has to terminate or to
  * check at run time the I/O waiting mechanism used.
  * 
- * @param con_list The set of connections already watched.
- *
- * @param srv_list The set of listener connections already watched.
- *
- * @param on_reading A reference to the I/O waiting object, in the
- * case the I/O waiting mechanism is changed.
+ * @param shard The reader thread state, holding the set of
+ * connections and listeners already watched and the I/O waiting
+ * object (updated in the case the I/O waiting mechanism is changed).
  * 
  * @return axl_true to flag the process to continue working to to stop.
  */
-axl_bool      vortex_reader_read_pending (VortexCtx  * ctx,
-					  axlList    * con_list, 
-					  axlList    * srv_list, 
-					  axlPointer * on_reading)
+axl_bool      vortex_reader_read_pending (VortexReaderShard * shard)
 {
 	/* get current context */
+#if defined(ENABLE_VORTEX_LOG)
+	VortexCtx        * ctx = shard->ctx;
+#endif
 	VortexReaderData * data;
 	int                length;
 	axl_bool           should_continue = axl_true;
 
-	length = vortex_async_queue_length (ctx->reader_queue);
+	length = vortex_async_queue_length (shard->queue);
 	while (length > 0) {
 		length--;
-		data            = vortex_async_queue_pop (ctx->reader_queue);
+		data            = vortex_async_queue_pop (shard->queue);
 
 		vortex_log (VORTEX_LEVEL_DEBUG, "read pending type=%d",
 			    data->type);
@@ -944,32 +1067,103 @@ axl_bool      vortex_reader_read_pending (VortexCtx  * ctx,
 		/* check if the io/wait mech have changed */
 		if (data->type == IO_WAIT_CHANGED) {
 			/* change io mechanism */
-			data = __vortex_reader_change_io_mech (ctx, on_reading, con_list, srv_list, data);
+			data = __vortex_reader_change_io_mech (shard, data);
 
 		} else if (data->type == FOREACH) {
 			/* do a foreach operation */
-			vortex_reader_foreach_impl (ctx, con_list, srv_list, data);
+			vortex_reader_foreach_impl (shard->ctx, shard->conn_list, shard->srv_list, data);
 
 		} /* end if */
 
 		/* watch the request received, maybe a connection or a
 		 * vortex reader command to process  */
-		vortex_reader_register_watch (data, con_list, srv_list);
+		vortex_reader_register_watch (shard, data, shard->conn_list, shard->srv_list);
+
+		/* new connections (or a restart request) */
+		shard->review = axl_true;
 		
 	} /* end while */
 
 	return should_continue;
 }
 
+/** 
+ * @internal Removes the current item of the cursor (a connection or
+ * listener watched by the shard), updating the count of items
+ * watched.
+ */
+void __vortex_reader_unlink (VortexReaderShard * shard, 
+			     axlListCursor     * cursor)
+{
+	axl_list_cursor_unlink (cursor);
+	vortex_atomic_add (&shard->watched, -1);
+	return;
+}
+
+/** 
+ * @internal Removes the connection from the reader fd group when the
+ * I/O mechanism is used in incremental mode. Must be called before
+ * the reader releases its reference.
+ */
+void __vortex_reader_forget (VortexCtx        * ctx,
+			     axlPointer         on_reading,
+			     VortexConnection * connection)
+{
+	VORTEX_SOCKET fds;
+
+	if (! connection->reader_registered)
+		return;
+	connection->reader_registered = axl_false;
+
+	/* sockets closed by vortex were already removed by the
+	 * kernel and their descriptor may be in use by another
+	 * connection */
+	fds = connection->reader_fd;
+	if (vortex_connection_get_socket (connection) < 0)
+		fds = -1;
+	vortex_io_waiting_invoke_remove_from_fd_group (ctx, fds, connection, on_reading);
+
+	return;
+}
+
+/** 
+ * @internal In incremental mode, returns if the set of sockets watched
+ * must be reviewed (new connections, connections closed, blocked or
+ * unwatched, idle checks). Otherwise the set is built on every
+ * iteration.
+ */
+axl_bool __vortex_reader_must_review (VortexReaderShard * shard)
+{
+	long now;
+
+	if (! shard->incremental)
+		return axl_true;
+
+	/* once per second at least */
+	now = __vortex_ctx_get_coarse_time (shard->ctx);
+	if (shard->review || now != shard->last_review) {
+		shard->review      = axl_false;
+		shard->last_review = now;
+		return axl_true;
+	} /* end if */
+
+	return axl_false;
+}
+
 /** 
  * @internal Auxiliar function that populates the reading set of file
  * descriptors (on_reading), returning the max fds.
+ *
+ * In incremental mode, sockets already registered are skipped, so
+ * only new, unblocked, closed or unwatched connections cause changes
+ * into the fd group.
  */
-VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
-						      axlPointer      on_reading, 
-						      axlListCursor * cursor, 
-						      VORTEX_SOCKET   current_max)
+VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexReaderShard * shard,
+						      axlListCursor     * cursor, 
+						      VORTEX_SOCKET       current_max)
 {
+	VortexCtx        * ctx         = shard->ctx;
+	axlPointer         on_reading  = shard->on_reading;
 	VORTEX_SOCKET      max_fds     = current_max;
 	VORTEX_SOCKET      fds         = 0;
 	VortexConnection * connection;
@@ -977,7 +1171,7 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 
 	/* get current time stamp if idle handler is defined */
 	if (ctx->global_idle_handler)
-		time_stamp = (long) time (NULL);
+		time_stamp = __vortex_ctx_get_coarse_time (ctx);
 	
 	axl_list_cursor_first (cursor);
 	while (axl_list_cursor_has_item (cursor)) {
@@ -995,7 +1189,8 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 			/* FIRST: remove current cursor to ensure the
 			 * connection is out of our handling before
 			 * finishing the reference the reader owns */
-			axl_list_cursor_unlink (cursor);
+			__vortex_reader_forget (ctx, on_reading, connection);
+			__vortex_reader_unlink (shard, cursor);
 
 			/* connection isn't ok, unref it */
 			vortex_connection_unref (connection, "vortex reader (build set)");
@@ -1011,7 +1206,8 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 			/* FIRST: remove current cursor to ensure the
 			 * connection is out of our handling before
 			 * finishing the reference the reader owns */
-			axl_list_cursor_unlink (cursor);
+			__vortex_reader_forget (ctx, on_reading, connection);
+			__vortex_reader_unlink (shard, cursor);
 
 			/* connection isn't ok, unref it */
 			vortex_connection_unref (connection, "vortex reader (process: unwatch)");
@@ -1024,6 +1220,8 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 		if (vortex_connection_is_blocked (connection)) {
 			/* vortex_log (VORTEX_LEVEL_DEBUG, "connection id=%d has I/O read blocked (vortex_connection_block)", 
 			   vortex_connection_get_id (connection)); */
+			__vortex_reader_forget (ctx, on_reading, connection);
+
 			/* get the next */
 			axl_list_cursor_next (cursor);
 			continue;
@@ -1034,6 +1232,18 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 		fds        = vortex_connection_get_socket (connection);
 		max_fds    = fds > max_fds ? fds: max_fds;
 
+		/* already registered (incremental mode) */
+		if (connection->reader_registered) {
+			if (connection->reader_fd == fds) {
+				/* get the next */
+				axl_list_cursor_next (cursor);
+				continue;
+			} /* end if */
+
+			/* socket changed */
+			__vortex_reader_forget (ctx, on_reading, connection);
+		} /* end if */
+
 		/* add the socket descriptor into the given on reading
 		 * group */
 		if (! vortex_io_waiting_invoke_add_to_fd_group (ctx, fds, connection, on_reading)) {
@@ -1044,7 +1254,7 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 			/* FIRST: remove current cursor to ensure the
 			 * connection is out of our handling before
 			 * finishing the reference the reader owns */
-			axl_list_cursor_unlink (cursor);
+			__vortex_reader_unlink (shard, cursor);
 
 			/* set it as not connected */
 			if (vortex_connection_is_ok (connection, axl_false))
@@ -1054,6 +1264,13 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 			continue;
 		} /* end if */
 
+		/* keep track of the socket registered to skip it next
+		 * time */
+		if (shard->incremental) {
+			connection->reader_registered = axl_true;
+			connection->reader_fd         = fds;
+		} /* end if */
+
 		/* get the next */
 		axl_list_cursor_next (cursor);
 
@@ -1064,30 +1281,53 @@ VORTEX_SOCKET __vortex_reader_build_set_to_watch_aux (VortexCtx     * ctx,
 	
 } /* end __vortex_reader_build_set_to_watch_aux */
 
-VORTEX_SOCKET   __vortex_reader_build_set_to_watch (VortexCtx     * ctx,
-						    axlPointer      on_reading, 
-						    axlListCursor * conn_cursor, 
-						    axlListCursor * srv_cursor)
+VORTEX_SOCKET   __vortex_reader_build_set_to_watch (VortexReaderShard * shard)
 {
 
 	VORTEX_SOCKET       max_fds     = 0;
 
 	/* read server connections */
-	max_fds = __vortex_reader_build_set_to_watch_aux (ctx, on_reading, srv_cursor, max_fds);
+	max_fds = __vortex_reader_build_set_to_watch_aux (shard, shard->srv_cursor, max_fds);
 
 	/* read client connection list */
-	max_fds = __vortex_reader_build_set_to_watch_aux (ctx, on_reading, conn_cursor, max_fds);
+	max_fds = __vortex_reader_build_set_to_watch_aux (shard, shard->conn_cursor, max_fds);
 
 	/* return maximum number for file descriptors */
 	return max_fds;
 	
 }
 
-void __vortex_reader_check_connection_list (VortexCtx     * ctx,
-					    axlPointer      on_reading, 
-					    axlListCursor * conn_cursor, 
-					    int             changed)
+/** 
+ * @internal Processes a connection reported by the I/O mechanism. In
+ * incremental mode, connections blocked or unwatched are still into
+ * the fd group until the next review, so they are skipped here and a
+ * review is requested (same for connections closed while
+ * processing).
+ */
+void __vortex_reader_process_connection (VortexReaderShard * shard,
+					 VortexConnection  * connection)
+{
+	if (vortex_connection_is_blocked (connection) || connection->reader_unwatch) {
+		shard->review = axl_true;
+		return;
+	} /* end if */
+
+	/* call to process incoming data, activating all invocation
+	 * code (first and second level handler) */
+	__vortex_reader_process_input (shard, connection, axl_true);
+
+	if (! vortex_connection_is_ok (connection, axl_false) || connection->reader_unwatch)
+		shard->review = axl_true;
+
+	return;
+}
+
+void __vortex_reader_check_connection_list (VortexReaderShard * shard,
+					    int                 changed)
 {
+	VortexCtx         * ctx         = shard->ctx;
+	axlPointer          on_reading  = shard->on_reading;
+	axlListCursor     * conn_cursor = shard->conn_cursor;
 
 	VORTEX_SOCKET       fds        = 0;
 	VortexConnection  * connection = NULL;
@@ -1108,7 +1348,8 @@ void __vortex_reader_check_connection_list (VortexCtx     * ctx,
 			/* FIRST: remove current cursor to ensure the
 			 * connection is out of our handling before
 			 * finishing the reference the reader owns */
-			axl_list_cursor_unlink (conn_cursor);
+			__vortex_reader_forget (ctx, on_reading, connection);
+			__vortex_reader_unlink (shard, conn_cursor);
 
 			/* connection isn't ok, unref it */
 			vortex_connection_unref (connection, "vortex reader (check list)");
@@ -1124,7 +1365,7 @@ void __vortex_reader_check_connection_list (VortexCtx     * ctx,
 			/* call to process incoming data, activating
 			 * all invocation code (first and second level
 			 * handler) */
-			__vortex_reader_process_socket_pending (ctx, connection);
+			__vortex_reader_process_connection (shard, connection);
 
 			/* update number of sockets checked */
 			checked++;
@@ -1138,11 +1379,12 @@ void __vortex_reader_check_connection_list (VortexCtx     * ctx,
 	return;
 }
 
-int  __vortex_reader_check_listener_list (VortexCtx     * ctx, 
-					  axlPointer      on_reading, 
-					  axlListCursor * srv_cursor, 
-					  int             changed)
+int  __vortex_reader_check_listener_list (VortexReaderShard * shard,
+					  int                 changed)
 {
+	VortexCtx         * ctx         = shard->ctx;
+	axlPointer          on_reading  = shard->on_reading;
+	axlListCursor     * srv_cursor  = shard->srv_cursor;
 
 	int                fds      = 0;
 	int                checked  = 0;
@@ -1162,7 +1404,8 @@ int  __vortex_reader_check_listener_list (VortexCtx     * ctx,
 			/* FIRST: remove current cursor to ensure the
 			 * connection is out of our handling before
 			 * finishing the reference the reader owns */
-			axl_list_cursor_unlink (srv_cursor);
+			__vortex_reader_forget (ctx, on_reading, connection);
+			__vortex_reader_unlink (shard, srv_cursor);
 
 			/* connection isn't ok, unref it */
 			vortex_connection_unref (connection, "vortex reader (process), listener closed");
@@ -1205,34 +1448,43 @@ int  __vortex_reader_check_listener_list (VortexCtx     * ctx,
  * memory used.
  * 
  */
-void __vortex_reader_stop_process (VortexCtx     * ctx,
-				   axlPointer      on_reading, 
-				   axlListCursor * conn_cursor, 
-				   axlListCursor * srv_cursor)
+void __vortex_reader_stop_process (VortexReaderShard * shard)
 
 {
+	VortexCtx     * ctx         = shard->ctx;
+	axlListCursor * conn_cursor = shard->conn_cursor;
+	axlListCursor * srv_cursor  = shard->srv_cursor;
+
 	/* stop vortex reader process unreferring already managed
 	 * connections */
 
-	vortex_async_queue_unref (ctx->reader_queue);
+	vortex_async_queue_unref (shard->queue);
+	shard->queue = NULL;
 
 	/* unref listener connections */
-	vortex_log (VORTEX_LEVEL_DEBUG, "cleaning pending %d listener connections..", axl_list_length (ctx->srv_list));
-	ctx->srv_list = NULL;
+	vortex_log (VORTEX_LEVEL_DEBUG, "cleaning pending %d listener connections (reader shard %d)..", 
+		    axl_list_length (shard->srv_list), shard->id);
+	shard->srv_list   = NULL;
+	shard->srv_cursor = NULL;
 	axl_list_free (axl_list_cursor_list (srv_cursor));
 	axl_list_cursor_free (srv_cursor);
 
 	/* unref initiators connections */
-	vortex_log (VORTEX_LEVEL_DEBUG, "cleaning pending %d peer connections..", axl_list_length (ctx->conn_list));
-	ctx->conn_list = NULL;
+	vortex_log (VORTEX_LEVEL_DEBUG, "cleaning pending %d peer connections (reader shard %d)..", 
+		    axl_list_length (shard->conn_list), shard->id);
+	shard->conn_list   = NULL;
+	shard->conn_cursor = NULL;
 	axl_list_free (axl_list_cursor_list (conn_cursor));
 	axl_list_cursor_free (conn_cursor);
+	/* nothing watched (only this thread updates the count) */
+	vortex_atomic_add (&shard->watched, - vortex_atomic_get (&shard->watched));
 
 	/* unref IO waiting object */
-	vortex_io_waiting_invoke_destroy_fd_group (ctx, on_reading); 
+	vortex_io_waiting_invoke_destroy_fd_group (ctx, shard->on_reading); 
+	shard->on_reading = NULL;
 
 	/* signal that the vortex reader process is stopped */
-	QUEUE_PUSH (ctx->reader_stopped, INT_TO_PTR (1));
+	QUEUE_PUSH (shard->stopped, INT_TO_PTR (1));
 
 	return;
 }
@@ -1248,6 +1500,55 @@ void __vortex_reader_close_connection (axlPointer pointer)
 	return;
 }
 
+/** 
+ * @internal Registers the read end of the shard wake pipe into its fd
+ * group (only once for incremental mechanisms), returning the max
+ * fds updated.
+ */
+VORTEX_SOCKET __vortex_reader_add_wake (VortexReaderShard * shard, 
+					VORTEX_SOCKET       max_fds)
+{
+	if (shard->wake[0] < 0 || shard->on_reading == NULL)
+		return max_fds;
+	if (shard->incremental && shard->wake_added)
+		return max_fds;
+
+	shard->wake_added = vortex_io_waiting_invoke_add_wake_to_fd_group (shard->ctx, shard->wake[0], shard->on_reading);
+	if (shard->wake_added && shard->wake[0] > max_fds)
+		return shard->wake[0];
+	return max_fds;
+}
+
+/** 
+ * @internal Reads all wake notifications pending on the shard wake
+ * pipe.
+ */
+void __vortex_reader_woken (VortexReaderShard * shard)
+{
+	char buffer[64];
+
+	/* drain first: a notification requested meanwhile finds the
+	 * flag still set, which is fine because the thread is already
+	 * awake and will attend it on this iteration */
+	while (recv (shard->wake[0], buffer, sizeof (buffer), 0) > 0);
+	vortex_atomic_compare_and_swap (&shard->wake_pending, 1, 0);
+	return;
+}
+
+/** 
+ * @internal Closes the shard wake pipe.
+ */
+void __vortex_reader_close_wake (VortexReaderShard * shard)
+{
+	if (shard->wake[0] >= 0)
+		vortex_close_socket (shard->wake[0]);
+	if (shard->wake[1] >= 0)
+		vortex_close_socket (shard->wake[1]);
+	shard->wake[0] = -1;
+	shard->wake[1] = -1;
+	return;
+}
+
 /** 
  * @internal Dispatch function used to process all sockets that have
  * changed.
@@ -1262,7 +1563,14 @@ void __vortex_reader_dispatch_connection (int                  fds,
 					  axlPointer           user_data)
 {
 	/* cast the reference */
-	VortexCtx * ctx = user_data;
+	VortexReaderShard * shard = user_data;
+	VortexCtx         * ctx   = shard->ctx;
+
+	/* wake pipe (see __vortex_reader_add_wake) */
+	if (connection == NULL) {
+		__vortex_reader_woken (shard);
+		return;
+	} /* end if */
 
 	switch (vortex_connection_get_role (connection)) {
 	case VortexRoleMasterListener:
@@ -1280,13 +1588,14 @@ void __vortex_reader_dispatch_connection (int                  fds,
 	default:
 		/* call to process incoming data, activating all
 		 * invocation code (first and second level handler) */
-		__vortex_reader_process_socket_pending (ctx, connection);
+		__vortex_reader_process_connection (shard, connection);
 		break;
 	} /* end if */
 	return;
 }
 
-axl_bool __vortex_reader_detect_and_cleanup_connection (axlListCursor * cursor) 
+axl_bool __vortex_reader_detect_and_cleanup_connection (VortexReaderShard * shard, 
+							 axlListCursor     * cursor) 
 {
 	VortexConnection * conn;
 	char               bytes[4];
@@ -1316,11 +1625,12 @@ axl_bool __vortex_reader_detect_and_cleanup_connection (axlListCursor * cursor)
 				    vortex_connection_get_id (conn), fds, errno);
 			/* close connection, but remove the socket reference to avoid closing some's socket */
 			conn->session = -1;
+			__vortex_reader_forget (shard->ctx, shard->on_reading, conn);
 			vortex_connection_shutdown (conn);
 			
 			/* connection isn't ok, unref it */
 			vortex_connection_unref (conn, "vortex reader (process), wrong socket");
-			axl_list_cursor_unlink (cursor);
+			__vortex_reader_unlink (shard, cursor);
 			return axl_false;
 		} /* end if */
 	} /* end if */
@@ -1328,30 +1638,30 @@ axl_bool __vortex_reader_detect_and_cleanup_connection (axlListCursor * cursor)
 	return axl_true;
 }
 
-void __vortex_reader_detect_and_cleanup_connections (VortexCtx * ctx)
+void __vortex_reader_detect_and_cleanup_connections (VortexReaderShard * shard)
 {
 	/* check all listeners */
-	axl_list_cursor_first (ctx->conn_cursor);
-	while (axl_list_cursor_has_item (ctx->conn_cursor)) {
+	axl_list_cursor_first (shard->conn_cursor);
+	while (axl_list_cursor_has_item (shard->conn_cursor)) {
 
 		/* get the connection */
-		if (! __vortex_reader_detect_and_cleanup_connection (ctx->conn_cursor))
+		if (! __vortex_reader_detect_and_cleanup_connection (shard, shard->conn_cursor))
 			continue;
 
 		/* get the next */
-		axl_list_cursor_next (ctx->conn_cursor);
+		axl_list_cursor_next (shard->conn_cursor);
 	} /* end while */
 
 	/* check all listeners */
-	axl_list_cursor_first (ctx->srv_cursor);
-	while (axl_list_cursor_has_item (ctx->srv_cursor)) {
+	axl_list_cursor_first (shard->srv_cursor);
+	while (axl_list_cursor_has_item (shard->srv_cursor)) {
 
 	  /* get the connection */
-	  if (! __vortex_reader_detect_and_cleanup_connection (ctx->srv_cursor))
+	  if (! __vortex_reader_detect_and_cleanup_connection (shard, shard->srv_cursor))
 		   continue; 
 
 	    /* get the next */
-	    axl_list_cursor_next (ctx->srv_cursor); 
+	    axl_list_cursor_next (shard->srv_cursor); 
 	} /* end while */
 
 	/* clear errno after cleaning descriptors */
@@ -1362,69 +1672,100 @@ void __vortex_reader_detect_and_cleanup_connections (VortexCtx * ctx)
 	return; 
 }
 
-axlPointer __vortex_reader_run (VortexCtx * ctx)
+axlPointer __vortex_reader_run (VortexReaderShard * shard)
 {
+	VortexCtx        * ctx         = shard->ctx;
 	VORTEX_SOCKET      max_fds     = 0;
 	VORTEX_SOCKET      result;
+	VortexIoWaitingFor wait_to;
 	int                error_tries = 0;
 
 	/* initialize the read set */
-	if (ctx->on_reading != NULL)
-		vortex_io_waiting_invoke_destroy_fd_group (ctx, ctx->on_reading);
-	ctx->on_reading  = vortex_io_waiting_invoke_create_fd_group (ctx, READ_OPERATIONS);
-	if (ctx->on_reading == NULL) {
+	if (shard->on_reading != NULL)
+		vortex_io_waiting_invoke_destroy_fd_group (ctx, shard->on_reading);
+	shard->on_reading  = vortex_io_waiting_invoke_create_fd_group (ctx, READ_OPERATIONS);
+	if (shard->on_reading == NULL) {
 		vortex_log (VORTEX_LEVEL_CRITICAL,
 			    "failed to create I/O waiting set, unable to start vortex reader");
 		return NULL;
 	} /* end if */
+	shard->incremental = vortex_io_waiting_is_incremental (ctx);
+	shard->wake_added  = axl_false;
 
 	/* create lists */
-	ctx->conn_list = axl_list_new (axl_list_always_return_1, __vortex_reader_close_connection);
-	ctx->srv_list = axl_list_new (axl_list_always_return_1, __vortex_reader_close_connection);
+	shard->conn_list = axl_list_new (axl_list_always_return_1, __vortex_reader_close_connection);
+	shard->srv_list = axl_list_new (axl_list_always_return_1, __vortex_reader_close_connection);
 
 	/* create cursors */
-	ctx->conn_cursor = axl_list_cursor_new (ctx->conn_list);
-	ctx->srv_cursor = axl_list_cursor_new (ctx->srv_list);
+	shard->conn_cursor = axl_list_cursor_new (shard->conn_list);
+	shard->srv_cursor = axl_list_cursor_new (shard->srv_list);
 
 	/* first step. Waiting blocked for our first connection to
 	 * listen */
  __vortex_reader_run_first_connection:
-	if (!vortex_reader_read_queue (ctx, ctx->conn_list, ctx->srv_list, &(ctx->on_reading))) {
+	if (!vortex_reader_read_queue (shard)) {
 		/* seems that the vortex reader main loop should
 		 * stop */
-		__vortex_reader_stop_process (ctx, ctx->on_reading, ctx->conn_cursor, ctx->srv_cursor);
+		__vortex_reader_stop_process (shard);
 		return NULL;
 	}
 
 	while (axl_true) {
-		/* reset descriptor set */
-		vortex_io_waiting_invoke_clear_fd_group (ctx, ctx->on_reading);
+		/* reset descriptor set (incremental mechanisms keep
+		 * sockets registered between waits) */
+		if (! shard->incremental)
+			vortex_io_waiting_invoke_clear_fd_group (ctx, shard->on_reading);
+
+		/* refresh the coarse clock used to stamp connection
+		 * activity (see vortex_connection_set_receive_stamp) */
+		__vortex_ctx_update_coarse_time (ctx);
 
-		if ((axl_list_length (ctx->conn_list) == 0) && (axl_list_length (ctx->srv_list) == 0)) {
+		if ((axl_list_length (shard->conn_list) == 0) && (axl_list_length (shard->srv_list) == 0)) {
 			/* check if we have to terminate the process
 			 * in the case no more connections are
 			 * available: useful when the current instance
 			 * is running in the context of turbulence */
-			vortex_ctx_check_on_finish (ctx);
+			if (vortex_reader_connections_watched (ctx) == 0)
+				vortex_ctx_check_on_finish (ctx);
 
 			vortex_log (VORTEX_LEVEL_DEBUG, "no more connection to watch for, putting thread to sleep");
 			goto __vortex_reader_run_first_connection;
 		}
 
 		/* build socket descriptor to be read */
-		max_fds = __vortex_reader_build_set_to_watch (ctx, ctx->on_reading, ctx->conn_cursor, ctx->srv_cursor);
-		if (errno == EBADF) {
-			vortex_log (VORTEX_LEVEL_CRITICAL, "Found wrong file descriptor error...(max_fds=%d, errno=%d), cleaning", max_fds, errno);
-			/* detect and cleanup wrong connections */
-			__vortex_reader_detect_and_cleanup_connections (ctx);
-			continue;
+		if (__vortex_reader_must_review (shard)) {
+			max_fds = __vortex_reader_build_set_to_watch (shard);
+			if (errno == EBADF) {
+				vortex_log (VORTEX_LEVEL_CRITICAL, "Found wrong file descriptor error...(max_fds=%d, errno=%d), cleaning", max_fds, errno);
+				/* detect and cleanup wrong connections */
+				__vortex_reader_detect_and_cleanup_connections (shard);
+				shard->review = axl_true;
+				continue;
+			} /* end if */
 		} /* end if */
+
+		/* watch the wake pipe so a review requested while
+		 * waiting is attended immediately */
+		max_fds = __vortex_reader_add_wake (shard, max_fds);
 		
+		/* connections holding complete frames can't wait for
+		 * the transport to be ready again: serve them and, while
+		 * some is still pending, check sockets without blocking
+		 * so connections ready meanwhile join the same pass */
+		wait_to = READ_OPERATIONS;
+		if (shard->backlog) {
+			__vortex_reader_process_backlog (shard);
+			if (shard->backlog)
+				wait_to = (VortexIoWaitingFor) (READ_OPERATIONS | NO_WAIT_OPERATIONS);
+		} /* end if */
+
 		/* perform IO blocking wait for read operation */
-		result = vortex_io_waiting_invoke_wait (ctx, ctx->on_reading, max_fds, READ_OPERATIONS);
+		result = vortex_io_waiting_invoke_wait (ctx, shard->on_reading, max_fds, wait_to);
 
-		/* do automatic thread pool resize here */
-		__vortex_thread_pool_automatic_resize (ctx);  
+		/* do automatic thread pool resize here (only from the
+		 * main reader) */
+		if (shard->id == 0)
+			__vortex_thread_pool_automatic_resize (ctx);  
 
 		/* check for timeout error */
 		if (result == -1 || result == -2)
@@ -1446,7 +1787,7 @@ axlPointer __vortex_reader_run (VortexCtx * ctx)
 		/* check for fatal error */
 		if (result == -3) {
 			vortex_log (VORTEX_LEVEL_CRITICAL, "fatal error received from io-wait function, exiting from vortex reader process..");
-			__vortex_reader_stop_process (ctx, ctx->on_reading, ctx->conn_cursor, ctx->srv_cursor);
+			__vortex_reader_stop_process (shard);
 			return NULL;
 		}
 
@@ -1455,18 +1796,25 @@ axlPointer __vortex_reader_run (VortexCtx * ctx)
 		if (result > 0) {
 			/* check if the mechanism have automatic
 			 * dispatch */
-			if (vortex_io_waiting_invoke_have_dispatch (ctx, ctx->on_reading)) {
+			if (vortex_io_waiting_invoke_have_dispatch (ctx, shard->on_reading)) {
 				/* perform automatic dispatch,
 				 * providing the dispatch function and
 				 * the number of sockets changed */
-				vortex_io_waiting_invoke_dispatch (ctx, ctx->on_reading, __vortex_reader_dispatch_connection, result, ctx);
+				vortex_io_waiting_invoke_dispatch (ctx, shard->on_reading, __vortex_reader_dispatch_connection, result, shard);
 
 			} else {
+				/* attend the wake pipe */
+				if (shard->wake_added &&
+				    vortex_io_waiting_invoke_is_set_fd_group (ctx, shard->wake[0], shard->on_reading, ctx)) {
+					__vortex_reader_woken (shard);
+					result--;
+				} /* end if */
+
 				/* call to check listener connections */
-				result = __vortex_reader_check_listener_list (ctx, ctx->on_reading, ctx->srv_cursor, result);
+				result = __vortex_reader_check_listener_list (shard, result);
 			
 				/* check for each connection to be watch is it have check */
-				__vortex_reader_check_connection_list (ctx, ctx->on_reading, ctx->conn_cursor, result);
+				__vortex_reader_check_connection_list (shard, result);
 			} /* end if */
 		}
 
@@ -1478,8 +1826,8 @@ axlPointer __vortex_reader_run (VortexCtx * ctx)
 		error_tries = 0;
 
 		/* read new connections to be managed */
-		if (!vortex_reader_read_pending (ctx, ctx->conn_list, ctx->srv_list, &(ctx->on_reading))) {
-			__vortex_reader_stop_process (ctx, ctx->on_reading, ctx->conn_cursor, ctx->srv_cursor);
+		if (!vortex_reader_read_pending (shard)) {
+			__vortex_reader_stop_process (shard);
 			return NULL;
 		}
 	}
@@ -1494,11 +1842,23 @@ axlPointer __vortex_reader_run (VortexCtx * ctx)
  */
 int  vortex_reader_connections_watched         (VortexCtx        * ctx)
 {
-	if (ctx == NULL || ctx->conn_list == NULL || ctx->srv_list == NULL)
+	VortexReaderShard * shard;
+	int                 iterator;
+	int                 count = 0;
+
+	if (ctx == NULL || ctx->reader_shards == NULL)
 		return 0;
+
+	/* sum connections watched by every reader thread */
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		shard = ctx->reader_shards[iterator];
+		if (shard == NULL)
+			continue;
+		count += vortex_atomic_get (&shard->watched);
+	} /* end for */
 	
 	/* return list */
-	return axl_list_length (ctx->conn_list) + axl_list_length (ctx->srv_list);
+	return count;
 }
 
 /** 
@@ -1514,9 +1874,67 @@ void vortex_reader_unwatch_connection          (VortexCtx        * ctx,
 	v_return_if_fail (ctx && connection);
 	/* flag connection vortex reader unwatch */
 	connection->reader_unwatch = axl_true;
+
+	/* request reader threads to review their fd group */
+	__vortex_reader_review (ctx);
+	return;
+}
+
+/** 
+ * @internal Wakes up the provided reader thread in the case it is
+ * blocked waiting, so queued requests and reviews are attended
+ * without waiting for the I/O wait to time out.
+ */
+void __vortex_reader_wake (VortexReaderShard * shard)
+{
+	/* one notification is enough until the thread drains the
+	 * pipe */
+	if (shard->wake[1] < 0)
+		return;
+	if (! vortex_atomic_compare_and_swap (&shard->wake_pending, 0, 1))
+		return;
+	send (shard->wake[1], "w", 1, 0);
 	return;
 }
 
+/** 
+ * @internal Requests all reader threads to review the set of
+ * connections watched (for example, because a connection was blocked
+ * or unblocked) on their next iteration, without waiting for them.
+ *
+ * Threads blocked waiting are woken up through their wake pipe so
+ * the review isn't delayed until the wait times out.
+ */
+void __vortex_reader_review (VortexCtx * ctx)
+{
+	VortexReaderShard * shard;
+	int                 iterator;
+
+	if (ctx == NULL)
+		return;
+	for (iterator = 0; ctx->reader_shards && iterator < ctx->reader_shards_num; iterator++) {
+		shard = ctx->reader_shards[iterator];
+		if (shard == NULL)
+			continue;
+		shard->review = axl_true;
+		__vortex_reader_wake (shard);
+	} /* end for */
+	return;
+}
+
+/** 
+ * @internal Returns the reader thread (shard) that will handle the
+ * provided connection. Connections are spread by their id so the
+ * same connection is always watched by the same thread.
+ */
+VortexReaderShard * __vortex_reader_get_shard (VortexCtx        * ctx,
+					       VortexConnection * connection)
+{
+	if (ctx->reader_shards_num <= 1 || connection == NULL)
+		return ctx->reader_shards[0];
+	return ctx->reader_shards[connection->id % ctx->reader_shards_num];
+}
+
 /** 
  * @internal
  * 
@@ -1527,10 +1945,11 @@ void vortex_reader_watch_connection (VortexCtx        * ctx,
 				     VortexConnection * connection)
 {
 	/* get current context */
-	VortexReaderData * data;
+	VortexReaderData  * data;
+	VortexReaderShard * shard;
 
 	v_return_if_fail (vortex_connection_is_ok (connection, axl_false));
-	v_return_if_fail (ctx->reader_queue);
+	v_return_if_fail (ctx->reader_shards);
 
 	if (!vortex_connection_set_nonblocking_socket (connection)) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to set non-blocking I/O operation, at connection registration, closing session");
@@ -1543,9 +1962,12 @@ void vortex_reader_watch_connection (VortexCtx        * ctx,
 		return;
 	}
 
-	vortex_log (VORTEX_LEVEL_DEBUG, "Accepting conn-id=%d into reader queue %p, library status: %d", 
+	/* get the reader thread that will watch this connection */
+	shard = __vortex_reader_get_shard (ctx, connection);
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "Accepting conn-id=%d into reader queue %p (shard %d), library status: %d", 
 		    vortex_connection_get_id (connection),
-		    ctx->reader_queue,
+		    shard->queue, shard->id,
 		    vortex_is_exiting (ctx));
 
 	/* prepare data to be queued */
@@ -1553,8 +1975,9 @@ void vortex_reader_watch_connection (VortexCtx        * ctx,
 	data->type       = CONNECTION;
 	data->connection = connection;
 
-	/* push data */
-	QUEUE_PUSH (ctx->reader_queue, data);
+	/* push data and wake up the thread so it is watched now */
+	QUEUE_PUSH (shard->queue, data);
+	__vortex_reader_wake (shard);
 
 	return;
 }
@@ -1566,10 +1989,26 @@ void vortex_reader_watch_connection (VortexCtx        * ctx,
  **/
 void vortex_reader_watch_listener   (VortexCtx        * ctx,
 				     VortexConnection * listener)
+{
+	/* listeners are watched by the main reader */
+	__vortex_reader_watch_listener_at (ctx, listener, 0);
+	return;
+}
+
+/** 
+ * @internal Install a listener to be watched by the provided reader
+ * thread (shard), taken modulo the number of reader threads
+ * running. Used to spread SO_REUSEPORT listening sockets (see
+ * VORTEX_LISTENER_REUSEPORT) so they are accepted in parallel.
+ */
+void __vortex_reader_watch_listener_at (VortexCtx        * ctx,
+					VortexConnection * listener,
+					int                shard)
 {
 	/* get current context */
 	VortexReaderData * data;
 	v_return_if_fail (listener > 0);
+	v_return_if_fail (ctx->reader_shards);
 	
 	/* prepare data to be queued */
 	data             = axl_new (VortexReaderData, 1);
@@ -1577,7 +2016,12 @@ void vortex_reader_watch_listener   (VortexCtx        * ctx,
 	data->connection = listener;
 
 	/* push data */
-	QUEUE_PUSH (ctx->reader_queue, data);
+	if (shard < 0 || ctx->reader_shards_num <= 1)
+		shard = 0;
+	else
+		shard = shard % ctx->reader_shards_num;
+	QUEUE_PUSH (ctx->reader_shards[shard]->queue, data);
+	__vortex_reader_wake (ctx->reader_shards[shard]);
 
 	return;
 }
@@ -1594,64 +2038,116 @@ axl_bool __vortex_reader_configure_conn (axlPointer ptr, axlPointer data)
 	return axl_false; /* not found so all items are iterated */
 }
 
+/** 
+ * @internal Releases a reader shard. In the case connection lists are
+ * still found (reinitialization scenario) they are released without
+ * closing sockets associated to each connection.
+ */
+void __vortex_reader_shard_free (VortexCtx * ctx, VortexReaderShard * shard)
+{
+	if (shard == NULL)
+		return;
+
+	if (shard->conn_list != NULL) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "releasing previous client connections, installed: %d",
+			    axl_list_length (shard->conn_list));
+		ctx->reader_cleanup = axl_true;
+		axl_list_lookup (shard->conn_list, __vortex_reader_configure_conn, NULL);
+		axl_list_cursor_free (shard->conn_cursor);
+		axl_list_free (shard->conn_list);
+		shard->conn_list   = NULL;
+		shard->conn_cursor = NULL;
+	} /* end if */
+	if (shard->srv_list != NULL) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "releasing previous listener connections, installed: %d",
+			    axl_list_length (shard->srv_list));
+		ctx->reader_cleanup = axl_true;
+		axl_list_lookup (shard->srv_list, __vortex_reader_configure_conn, NULL);
+		axl_list_cursor_free (shard->srv_cursor);
+		axl_list_free (shard->srv_list);
+		shard->srv_list   = NULL;
+		shard->srv_cursor = NULL;
+	} /* end if */
+
+	if (shard->queue != NULL)
+		vortex_async_queue_release (shard->queue);
+	if (shard->stopped != NULL) 
+		vortex_async_queue_release (shard->stopped);
+	__vortex_reader_close_wake (shard);
+	axl_free (shard);
+	return;
+}
+
 /** 
  * @internal
  * 
  * Creates the reader thread process. It will be waiting for any
  * connection that have changed to read its connect and send it
  * appropriate channel reader.
+ *
+ * According to \ref VORTEX_READER_THREADS, several reader threads
+ * can be started, each one watching its own set of connections. The
+ * first one (the main reader) also watches listeners.
  * 
  * @return The function returns axl_true if the vortex reader was started
  * properly, otherwise axl_false is returned.
  **/
 axl_bool  vortex_reader_run (VortexCtx * ctx) 
 {
+	VortexReaderShard * shard;
+	int                 iterator;
+
 	v_return_val_if_fail (ctx, axl_false);
 
-	/* check connection list to be previously created to terminate
-	   it without closing sockets associated to each connection */
-	if (ctx->conn_list != NULL) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "releasing previous client connections, installed: %d",
-			    axl_list_length (ctx->conn_list));
-		ctx->reader_cleanup = axl_true;
-		axl_list_lookup (ctx->conn_list, __vortex_reader_configure_conn, NULL);
-		axl_list_cursor_free (ctx->conn_cursor);
-		axl_list_free (ctx->conn_list);
-		ctx->conn_list   = NULL;
-		ctx->conn_cursor = NULL;
-	} /* end if */
-	if (ctx->srv_list != NULL) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "releasing previous listener connections, installed: %d",
-			    axl_list_length (ctx->srv_list));
-		ctx->reader_cleanup = axl_true;
-		axl_list_lookup (ctx->srv_list, __vortex_reader_configure_conn, NULL);
-		axl_list_cursor_free (ctx->srv_cursor);
-		axl_list_free (ctx->srv_list);
-		ctx->srv_list   = NULL;
-		ctx->srv_cursor = NULL;
+	/* check shards to be previously created to terminate them
+	   without closing sockets associated to each connection */
+	if (ctx->reader_shards != NULL) {
+		for (iterator = 0; iterator < ctx->reader_shards_num; iterator++)
+			__vortex_reader_shard_free (ctx, ctx->reader_shards[iterator]);
+		axl_free (ctx->reader_shards);
+		ctx->reader_shards     = NULL;
+		ctx->reader_shards_num = 0;
 	} /* end if */
 
 	/* clear reader cleanup flag */
 	ctx->reader_cleanup = axl_false;
 
-	/* reader_queue */
-	if (ctx->reader_queue != NULL)
-		vortex_async_queue_release (ctx->reader_queue);
-	ctx->reader_queue   = vortex_async_queue_new ();
-
-	/* reader stopped */
-	if (ctx->reader_stopped != NULL) 
-		vortex_async_queue_release (ctx->reader_stopped);
-	ctx->reader_stopped = vortex_async_queue_new ();
-
-	/* create the vortex reader main thread */
-	if (! vortex_thread_create (&ctx->reader_thread, 
-				    (VortexThreadFunc) __vortex_reader_run,
-				    ctx,
-				    VORTEX_THREAD_CONF_END)) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to start vortex reader loop");
-		return axl_false;
-	} /* end if */
+	/* create reader shards */
+	ctx->reader_shards_num = ctx->reader_threads > 1 ? ctx->reader_threads : 1;
+	ctx->reader_shards     = axl_new (VortexReaderShard *, ctx->reader_shards_num);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		shard          = axl_new (VortexReaderShard, 1);
+		shard->ctx     = ctx;
+		shard->id      = iterator;
+		shard->queue   = vortex_async_queue_new ();
+		shard->stopped = vortex_async_queue_new ();
+		ctx->reader_shards[iterator] = shard;
+
+		/* create the wake pipe (both ends non blocking) */
+		if (vortex_support_pipe (ctx, shard->wake) != 0) {
+			vortex_log (VORTEX_LEVEL_WARNING, 
+				    "unable to create wake pipe for reader shard %d, reviews will wait for the I/O wait to time out", iterator);
+			shard->wake[0] = -1;
+			shard->wake[1] = -1;
+		} else {
+			vortex_connection_set_sock_block (shard->wake[0], axl_false);
+			vortex_connection_set_sock_block (shard->wake[1], axl_false);
+		} /* end if */
+	} /* end for */
+
+	/* create the vortex reader threads */
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		shard = ctx->reader_shards[iterator];
+		if (! vortex_thread_create (&shard->thread, 
+					    (VortexThreadFunc) __vortex_reader_run,
+					    shard,
+					    VORTEX_THREAD_CONF_END)) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to start vortex reader loop (shard %d)", iterator);
+			/* only shards already started are used */
+			ctx->reader_shards_num = iterator;
+			return iterator > 0;
+		} /* end if */
+	} /* end for */
 	
 	return axl_true;
 }
@@ -1663,32 +2159,52 @@ axl_bool  vortex_reader_run (VortexCtx * ctx)
 void vortex_reader_stop (VortexCtx * ctx)
 {
 	/* get current context */
-	VortexReaderData * data;
+	VortexReaderData  * data;
+	VortexReaderShard * shard;
+	int                 iterator;
+	axl_bool            all_stopped = axl_true;
 
-	vortex_log (VORTEX_LEVEL_DEBUG, "stopping vortex reader ..");
+	if (ctx->reader_shards == NULL)
+		return;
 
-	/* create a bacon to signal vortex reader that it should stop
-	 * and unref resources */
-	data       = axl_new (VortexReaderData, 1);
-	data->type = TERMINATE;
+	vortex_log (VORTEX_LEVEL_DEBUG, "stopping vortex reader (%d threads) ..", ctx->reader_shards_num);
 
-	/* push data */
+	/* create a bacon to signal each vortex reader thread that it
+	 * should stop and unref resources */
 	vortex_log (VORTEX_LEVEL_DEBUG, "pushing data stop signal..");
-	QUEUE_PUSH (ctx->reader_queue, data);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		data       = axl_new (VortexReaderData, 1);
+		data->type = TERMINATE;
+		QUEUE_PUSH (ctx->reader_shards[iterator]->queue, data);
+	} /* end for */
 	vortex_log (VORTEX_LEVEL_DEBUG, "signal sent reader ..");
 
 	/* waiting until the reader is stoped */
 	vortex_log (VORTEX_LEVEL_DEBUG, "waiting vortex reader 60 seconds to stop");
-	if (PTR_TO_INT (vortex_async_queue_timedpop (ctx->reader_stopped, 60000000))) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "vortex reader properly stopped, cleaning thread..");
-		/* terminate thread */
-		vortex_thread_destroy (&ctx->reader_thread, axl_false);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		shard = ctx->reader_shards[iterator];
+		if (PTR_TO_INT (vortex_async_queue_timedpop (shard->stopped, 60000000))) {
+			vortex_log (VORTEX_LEVEL_DEBUG, "vortex reader (shard %d) properly stopped, cleaning thread..", shard->id);
+			/* terminate thread */
+			vortex_thread_destroy (&shard->thread, axl_false);
+
+			/* clear queue */
+			vortex_async_queue_unref (shard->stopped);
+			__vortex_reader_close_wake (shard);
+			axl_free (shard);
+			ctx->reader_shards[iterator] = NULL;
+		} else {
+			vortex_log (VORTEX_LEVEL_WARNING, "timeout while waiting vortex reader thread (shard %d) to stop..", shard->id);
+			all_stopped = axl_false;
+		}
+	} /* end for */
 
-		/* clear queue */
-		vortex_async_queue_unref (ctx->reader_stopped);
-	} else {
-		vortex_log (VORTEX_LEVEL_WARNING, "timeout while waiting vortex reader thread to stop..");
-	}
+	/* release shards array if all threads finished */
+	if (all_stopped) {
+		axl_free (ctx->reader_shards);
+		ctx->reader_shards     = NULL;
+		ctx->reader_shards_num = 0;
+	} /* end if */
 
 	return;
 }
@@ -1704,24 +2220,26 @@ void vortex_reader_stop (VortexCtx * ctx)
 axl_bool  vortex_reader_notify_change_io_api               (VortexCtx * ctx)
 {
 	VortexReaderData * data;
+	int                iterator;
 
 	/* check if the vortex reader is running */
-	if (ctx == NULL || ctx->reader_queue == NULL)
+	if (ctx == NULL || ctx->reader_shards == NULL)
 		return axl_false;
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "stopping vortex reader due to a request for a I/O notify change...");
 
 	/* create a bacon to signal vortex reader that it should stop
 	 * and unref resources */
-	data       = axl_new (VortexReaderData, 1);
-	data->type = IO_WAIT_CHANGED;
-
-	/* push data */
 	vortex_log (VORTEX_LEVEL_DEBUG, "pushing signal to notify I/O change..");
-	QUEUE_PUSH (ctx->reader_queue, data);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		data       = axl_new (VortexReaderData, 1);
+		data->type = IO_WAIT_CHANGED;
+		QUEUE_PUSH (ctx->reader_shards[iterator]->queue, data);
+	} /* end for */
 
-	/* waiting until the reader is stoped */
-	vortex_async_queue_pop (ctx->reader_stopped);
+	/* waiting until all reader threads are stoped */
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++)
+		vortex_async_queue_pop (ctx->reader_shards[iterator]->stopped);
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "done, now vortex reader will wait until the new API is installed..");
 
@@ -1735,15 +2253,16 @@ axl_bool  vortex_reader_notify_change_io_api               (VortexCtx * ctx)
 void vortex_reader_notify_change_done_io_api   (VortexCtx * ctx)
 {
 	VortexReaderData * data;
+	int                iterator;
 
 	/* create a bacon to signal vortex reader that it should stop
 	 * and unref resources */
-	data       = axl_new (VortexReaderData, 1);
-	data->type = IO_WAIT_READY;
-
-	/* push data */
 	vortex_log (VORTEX_LEVEL_DEBUG, "pushing signal to notify I/O is ready..");
-	QUEUE_PUSH (ctx->reader_queue, data);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		data       = axl_new (VortexReaderData, 1);
+		data->type = IO_WAIT_READY;
+		QUEUE_PUSH (ctx->reader_shards[iterator]->queue, data);
+	} /* end for */
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "notification done..");
 
@@ -1763,28 +2282,43 @@ void vortex_reader_notify_change_done_io_api   (VortexCtx * ctx)
  * @param user_data User data to be provided to the function.
  *
  * @return The function returns a reference to the queue that will be
- * used to notify the foreach operation finished.
+ * used to notify the foreach operation finished (notified once, after
+ * all reader threads have finished).
  */
 VortexAsyncQueue * vortex_reader_foreach                     (VortexCtx            * ctx,
 							      VortexForeachFunc      func,
 							      axlPointer             user_data)
 {
-	VortexReaderData * data;
-	VortexAsyncQueue * queue;
+	VortexReaderData      * data;
+	VortexAsyncQueue      * queue;
+	VortexReaderCountdown * countdown = NULL;
+	int                     iterator;
 
 	v_return_val_if_fail (ctx, NULL);
+	v_return_val_if_fail (ctx->reader_shards, NULL);
+
+	queue = vortex_async_queue_new ();
+	if (ctx->reader_shards_num > 1) {
+		/* several reader threads: last one notifies */
+		countdown          = axl_new (VortexReaderCountdown, 1);
+		countdown->pending = ctx->reader_shards_num;
+		vortex_mutex_create (&countdown->mutex);
+	} /* end if */
 
 	/* queue an operation */
-	data            = axl_new (VortexReaderData, 1);
-	data->type      = FOREACH;
-	data->func      = func;
-	data->user_data = user_data;
-	queue           = vortex_async_queue_new ();
-	data->notify    = queue;
-	
-	/* queue the operation */
 	vortex_log (VORTEX_LEVEL_DEBUG, "notify foreach reader operation..");
-	QUEUE_PUSH (ctx->reader_queue, data);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		data            = axl_new (VortexReaderData, 1);
+		data->type      = FOREACH;
+		data->func      = func;
+		data->user_data = user_data;
+		data->notify    = queue;
+		data->countdown = countdown;
+		
+		/* queue the operation */
+		QUEUE_PUSH (ctx->reader_shards[iterator]->queue, data);
+		__vortex_reader_wake (ctx->reader_shards[iterator]);
+	} /* end for */
 
 	/* notification done */
 	vortex_log (VORTEX_LEVEL_DEBUG, "finished foreach reader operation..");
@@ -1804,27 +2338,39 @@ void               vortex_reader_foreach_offline (VortexCtx           * ctx,
 						  axlPointer            user_data2,
 						  axlPointer            user_data3)
 {
-	/* first iterate over all client connextions */
-	axl_list_cursor_first (ctx->conn_cursor);
-	while (axl_list_cursor_has_item (ctx->conn_cursor)) {
+	VortexReaderShard * shard;
+	int                 iterator;
+
+	if (ctx->reader_shards == NULL)
+		return;
 
-		/* notify connection */
-		func (axl_list_cursor_get (ctx->conn_cursor), user_data, user_data2, user_data3);
+	for (iterator = 0; iterator < ctx->reader_shards_num; iterator++) {
+		shard = ctx->reader_shards[iterator];
+		if (shard == NULL)
+			continue;
 
-		/* next item */
-		axl_list_cursor_next (ctx->conn_cursor);
-	} /* end while */
+		/* first iterate over all client connextions */
+		axl_list_cursor_first (shard->conn_cursor);
+		while (axl_list_cursor_has_item (shard->conn_cursor)) {
 
-	/* now iterate over all server connections */
-	axl_list_cursor_first (ctx->srv_cursor);
-	while (axl_list_cursor_has_item (ctx->srv_cursor)) {
+			/* notify connection */
+			func (axl_list_cursor_get (shard->conn_cursor), user_data, user_data2, user_data3);
 
-		/* notify connection */
-		func (axl_list_cursor_get (ctx->srv_cursor), user_data, user_data2, user_data3);
+			/* next item */
+			axl_list_cursor_next (shard->conn_cursor);
+		} /* end while */
 
-		/* next item */
-		axl_list_cursor_next (ctx->srv_cursor);
-	} /* end while */
+		/* now iterate over all server connections */
+		axl_list_cursor_first (shard->srv_cursor);
+		while (axl_list_cursor_has_item (shard->srv_cursor)) {
+
+			/* notify connection */
+			func (axl_list_cursor_get (shard->srv_cursor), user_data, user_data2, user_data3);
+
+			/* next item */
+			axl_list_cursor_next (shard->srv_cursor);
+		} /* end while */
+	} /* end for */
 
 	return;
 }
@@ -83,4 +83,10 @@ void               vortex_reader_foreach_offline (VortexCtx           * ctx,
 
 void               vortex_reader_restart (VortexCtx * ctx);
 
+void               __vortex_reader_watch_listener_at (VortexCtx        * ctx,
+						      VortexConnection * listener,
+						      int                shard);
+
+void               __vortex_reader_review (VortexCtx * ctx);
+
 #endif
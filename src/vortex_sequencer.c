@@ -49,6 +49,29 @@ void __vortex_sequencer_channel_unref (axlPointer channel)
 	return;
 }
 
+/** 
+ * @internal Releases the content hold by the provided sequencer data
+ * (message and mime headers), calling to the release handler
+ * configured if the message was provided without copying it.
+ */
+void vortex_sequencer_release_message (VortexSequencerData * data)
+{
+	if (data == NULL)
+		return;
+
+	if (data->no_copy) {
+		/* caller buffer: notify it is no longer required */
+		if (data->release && data->message)
+			data->release (data->message);
+		axl_free (data->mime_headers);
+		data->mime_headers = NULL;
+	} else
+		axl_free (data->message);
+	data->message = NULL;
+
+	return;
+}
+
 /* note: look at vortex_ctx_private.h for VortexSequencerState
  * definition */
 void vortex_sequencer_release_state (VortexSequencerState * state)
@@ -58,6 +81,11 @@ void vortex_sequencer_release_state (VortexSequencerState * state)
 
 	axl_hash_cursor_free (state->ready_cursor);
 	axl_hash_free (state->ready);
+	axl_hash_free (state->batches);
+
+	/* free sequencer buffers */
+	axl_free (state->send_buffer);
+	axl_free (state->feeder_buffer);
 
 	axl_free (state);
 
@@ -73,6 +101,7 @@ VortexSequencerState * vortex_sequencer_create_state (void)
 
 	/* create hashes */
 	result->ready   = axl_hash_new (axl_hash_int, axl_hash_equal_int);
+	result->batches = axl_hash_new (axl_hash_int, axl_hash_equal_int);
 
 	/* create cursors */
 	result->ready_cursor   = axl_hash_cursor_new (result->ready);
@@ -84,12 +113,32 @@ VortexSequencerState * vortex_sequencer_create_state (void)
 	return result;
 }
 
+/** 
+ * @internal Returns the sequencer state (thread) handling the
+ * provided channel, which is selected by its connection id so all
+ * channels of a connection are handled by the same thread.
+ */
+VortexSequencerState * __vortex_sequencer_get_state (VortexCtx * ctx, VortexChannel * channel)
+{
+	VortexConnection * conn;
+
+	if (ctx == NULL || ctx->sequencer_states == NULL)
+		return NULL;
+	if (ctx->sequencer_states_num <= 1)
+		return ctx->sequencer_states[0];
+
+	conn = vortex_channel_get_connection (channel);
+	if (conn == NULL)
+		return ctx->sequencer_states[0];
+	return ctx->sequencer_states[vortex_connection_get_id (conn) % ctx->sequencer_states_num];
+}
+
 axl_bool vortex_sequencer_add_channel (VortexCtx * ctx, VortexSequencerData * data)
 {
 	VortexSequencerState * state;
 
 	/* get state reference */
-	state = ctx->sequencer_state;
+	state = __vortex_sequencer_get_state (ctx, data->channel);
 
 	/* lock */
 	vortex_mutex_lock (&state->mutex);
@@ -111,7 +160,9 @@ axl_bool vortex_sequencer_add_channel (VortexCtx * ctx, VortexSequencerData * da
 		if (! vortex_channel_ref2 (data->channel, "sequencer")) {
 			/* release data */
 			vortex_payload_feeder_unref (data->feeder);
-			axl_free (data->message);
+			/* caller keeps ownership of its buffer on failure */
+			data->release = NULL;
+			vortex_sequencer_release_message (data);
 			axl_free (data);
 
 			vortex_log (VORTEX_LEVEL_CRITICAL, "Failed to acquire reference to queue channel into sequencer");
@@ -134,24 +185,34 @@ axl_bool vortex_sequencer_add_channel (VortexCtx * ctx, VortexSequencerData * da
 
 void vortex_sequencer_signal (VortexCtx * ctx)
 {
-	if (ctx == NULL || ctx->sequencer_state == NULL)
+	int iterator;
+
+	if (ctx == NULL || ctx->sequencer_states == NULL)
 		return;
 
-	vortex_cond_signal (&ctx->sequencer_state->cond);
+	/* signal all sequencer threads */
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++)
+		vortex_cond_signal (&ctx->sequencer_states[iterator]->cond);
 
 	return;
 }
 
 axl_bool vortex_sequencer_queue_data (VortexCtx * ctx, VortexSequencerData * data)
 {
-	axl_bool is_stalled;
+	axl_bool               is_stalled;
+	VortexSequencerState * state;
 
 	v_return_val_if_fail (data, axl_false);
 
+	/* get the sequencer thread handling this channel */
+	state = __vortex_sequencer_get_state (ctx, data->channel);
+
 	/* check state before handling this message with the sequencer */
-	if (ctx->vortex_exit || ctx->sequencer_state == NULL || ctx->sequencer_state->exit) {
+	if (ctx->vortex_exit || state == NULL || state->exit) {
 		vortex_payload_feeder_unref (data->feeder);
-		axl_free (data->message);
+		/* caller keeps ownership of its buffer on failure */
+		data->release = NULL;
+		vortex_sequencer_release_message (data);
 		axl_free (data);
 		return axl_false;
 	}
@@ -172,7 +233,7 @@ axl_bool vortex_sequencer_queue_data (VortexCtx * ctx, VortexSequencerData * dat
 		     vortex_connection_get_id (vortex_channel_get_connection (data->channel)),
 		     vortex_channel_is_stalled (data->channel),
 		     data->message_size,
-		     data->message ? data->message : "**** empty message ****");
+		     data->no_copy ? "**** message not copied ****" : (data->message ? data->message : "**** empty message ****"));
 
 	/* get current is stalled status */
 	is_stalled = vortex_channel_is_stalled (data->channel);
@@ -183,7 +244,7 @@ axl_bool vortex_sequencer_queue_data (VortexCtx * ctx, VortexSequencerData * dat
 
 	/* signal sequencer (but only if the channel is not stalled) */
 	if (! is_stalled)
-		vortex_sequencer_signal (ctx);
+		vortex_cond_signal (&state->cond);
 
 	return axl_true;
 }
@@ -202,21 +263,25 @@ int      vortex_sequencer_channels_pending_ops     (VortexCtx           * ctx)
 {
 
 	VortexSequencerState * state;
-	int                    result;
+	int                    result = 0;
+	int                    iterator;
 
 	if (ctx == NULL)
 		return -1;
 
-	/* get state reference */
-	state = ctx->sequencer_state;
+	/* add channels pending on every sequencer thread */
+	for (iterator = 0; ctx->sequencer_states && iterator < ctx->sequencer_states_num; iterator++) {
+		/* get state reference */
+		state = ctx->sequencer_states[iterator];
 
-	/* lock */
-	vortex_mutex_lock (&state->mutex);
+		/* lock */
+		vortex_mutex_lock (&state->mutex);
 
-	result = axl_hash_items (state->ready);
+		result += axl_hash_items (state->ready);
 
-	/* unlock */
-	vortex_mutex_unlock (&state->mutex);
+		/* unlock */
+		vortex_mutex_unlock (&state->mutex);
+	} /* end for */
 
 	/* report number of items */
 	return result;
@@ -271,21 +336,217 @@ axl_bool vortex_sequencer_remove_message_sent (VortexCtx * ctx, VortexChannel *
 	vortex_payload_feeder_unref (data->feeder);
 
 	/* release data */
-	axl_free (data->message);
+	vortex_sequencer_release_message (data);
 	axl_free (data);
 
 	return is_empty;
 }
 
-int vortex_sequencer_build_packet_to_send (VortexCtx           * ctx, 
-					   VortexChannel       * channel, 
-					   VortexConnection    * conn, 
-					   VortexSequencerData * data, 
-					   VortexWriterData    * packet)
+/** 
+ * @internal Builds the frame header for the payload that will be
+ * referenced (not copied) at the sequencer buffer, placing it as the
+ * first piece of the packet.
+ *
+ * @return The header size or -1 if it fails.
+ */
+int __vortex_sequencer_build_header (VortexSequencerState * state,
+				     VortexSequencerData  * data,
+				     VortexWriterData     * packet,
+				     int                    size_to_copy)
+{
+	char * message_type;
+	int    header_size = 0;
+
+	switch (data->type) {
+	case VORTEX_FRAME_TYPE_MSG:
+		message_type = "MSG";
+		break;
+	case VORTEX_FRAME_TYPE_RPY:
+		message_type = "RPY";
+		break;
+	case VORTEX_FRAME_TYPE_ANS:
+		message_type = "ANS";
+		break;
+	case VORTEX_FRAME_TYPE_ERR:
+		message_type = "ERR";
+		break;
+	case VORTEX_FRAME_TYPE_NUL:
+		message_type = "NUL";
+		break;
+	default:
+		return -1;
+	} /* end switch */
+
+	/* build frame header (ansno only used for ANS frames) */
+	if (vortex_frame_build_header (state->send_buffer, state->send_buffer_size, &header_size,
+				       message_type, data->channel_num, data->msg_no,
+				       ! packet->is_complete || data->fixed_more,
+				       data->first_seq_no, size_to_copy,
+				       data->type == VORTEX_FRAME_TYPE_ANS ? data->ansno : -1,
+				       NULL, NULL) < 0)
+		return -1;
+
+	packet->pieces[0]      = state->send_buffer;
+	packet->pieces_size[0] = header_size;
+	packet->pieces_num     = 1;
+
+	return header_size;
+}
+
+/** 
+ * @internal Adds the frame trailer to the pieces of the packet and
+ * joins them at the sequencer buffer (after the header) if use_pieces
+ * is axl_false.
+ */
+char * __vortex_sequencer_finish_pieces (VortexSequencerState * state,
+					 VortexWriterData     * packet,
+					 int                    header_size,
+					 int                    size_to_copy,
+					 axl_bool               use_pieces)
+{
+	int    offset;
+	int    iterator;
+
+	/* frame trailer */
+	packet->pieces[packet->pieces_num]      = "END\x0D\x0A";
+	packet->pieces_size[packet->pieces_num] = 5;
+	packet->pieces_num++;
+
+	packet->the_size = header_size + size_to_copy + 5;
+
+	if (! use_pieces) {
+		/* join pieces after the header already placed */
+		offset = header_size;
+		for (iterator = 1; iterator < packet->pieces_num; iterator++) {
+			memcpy (state->send_buffer + offset, packet->pieces[iterator], packet->pieces_size[iterator]);
+			offset += packet->pieces_size[iterator];
+		} /* end for */
+		packet->pieces_num = 0;
+		packet->file_piece = 0;
+	} else {
+		/* terminate header (only used for log purposes) */
+		state->send_buffer[header_size] = 0;
+	} /* end if */
+
+	return state->send_buffer;
+}
+
+/** 
+ * @internal Builds the frame for a message that was not copied
+ * (no_copy), placing the frame header at the sequencer buffer and
+ * referencing MIME headers, the caller buffer and the trailer as
+ * pieces of the frame (see \ref vortex_frame_send_raw_pieces).
+ *
+ * If use_pieces is axl_false (the connection is not using the default
+ * send handler), pieces are joined at the sequencer buffer so the
+ * frame is still written with a single send operation.
+ */
+char * __vortex_sequencer_build_pieces (VortexCtx            * ctx,
+					VortexSequencerState * state,
+					VortexSequencerData  * data,
+					VortexWriterData     * packet,
+					int                    size_to_copy,
+					axl_bool               use_pieces)
+{
+	int    header_size;
+	int    offset      = data->step;
+	int    pending     = size_to_copy;
+	int    chunk;
+
+	/* build frame header */
+	header_size = __vortex_sequencer_build_header (state, data, packet, size_to_copy);
+	if (header_size < 0) {
+		packet->the_size = -1;
+		return NULL;
+	} /* end if */
+
+	/* mime headers still not sent */
+	if (offset < data->mime_headers_size) {
+		chunk = data->mime_headers_size - offset;
+		if (chunk > pending)
+			chunk = pending;
+
+		packet->pieces[packet->pieces_num]      = data->mime_headers + offset;
+		packet->pieces_size[packet->pieces_num] = chunk;
+		packet->pieces_num++;
+
+		offset  += chunk;
+		pending -= chunk;
+	} /* end if */
+
+	/* caller content */
+	if (pending > 0) {
+		packet->pieces[packet->pieces_num]      = data->message + (offset - data->mime_headers_size);
+		packet->pieces_size[packet->pieces_num] = pending;
+		packet->pieces_num++;
+	} /* end if */
+
+	return __vortex_sequencer_finish_pieces (state, packet, header_size, size_to_copy, use_pieces);
+}
+
+/** 
+ * @internal Builds the frame for the content returned by a feeder
+ * that maps it (see \ref vortex_payload_feeder_file_mapped),
+ * referencing the mapped content as a piece of the frame that is
+ * also found at the file (so it can be sent with sendfile, see \ref
+ * vortex_frame_send_raw_file).
+ *
+ * If use_pieces is axl_false, the mapped content is copied (once)
+ * into the sequencer buffer to build the frame.
+ */
+char * __vortex_sequencer_build_mapped (VortexCtx                * ctx,
+					VortexSequencerState     * state,
+					VortexSequencerData      * data,
+					VortexWriterData         * packet,
+					VortexPayloadFeederChunk * chunk,
+					int                        size_to_copy,
+					axl_bool                   use_pieces)
+{
+	int    header_size;
+
+	/* build frame header */
+	header_size = __vortex_sequencer_build_header (state, data, packet, size_to_copy);
+	if (header_size < 0) {
+		packet->the_size = -1;
+		return NULL;
+	} /* end if */
+
+	/* empty mime header */
+	if (chunk->prefix_size > 0) {
+		packet->pieces[packet->pieces_num]      = chunk->prefix;
+		packet->pieces_size[packet->pieces_num] = chunk->prefix_size;
+		packet->pieces_num++;
+	} /* end if */
+
+	/* mapped content */
+	if (chunk->content_size > 0) {
+		packet->file_piece  = packet->pieces_num;
+		packet->file_fd     = chunk->fd;
+		packet->file_offset = chunk->offset;
+
+		packet->pieces[packet->pieces_num]      = chunk->content;
+		packet->pieces_size[packet->pieces_num] = chunk->content_size;
+		packet->pieces_num++;
+	} /* end if */
+
+	return __vortex_sequencer_finish_pieces (state, packet, header_size, size_to_copy, use_pieces);
+}
+
+int vortex_sequencer_build_packet_to_send (VortexCtx            * ctx, 
+					   VortexSequencerState * state,
+					   VortexChannel        * channel, 
+					   VortexConnection     * conn, 
+					   VortexSequencerData  * data, 
+					   VortexWriterData     * packet)
 {
  	int          size_to_copy        = 0;
  	unsigned int max_seq_no_accepted = vortex_channel_get_max_seq_no_remote_accepted (channel);
 	char       * payload             = NULL;
+	/* payload can be referenced (not copied) while sending */
+	axl_bool     use_pieces          = data->no_copy && vortex_connection_is_default_send (conn);
+	/* feeder content mapped (referenced, not copied) */
+	axl_bool     mapped              = axl_false;
+	VortexPayloadFeederChunk chunk;
 
 	/* clear packet */
 	memset (packet, 0, sizeof (VortexWriterData));
@@ -317,12 +578,17 @@ int vortex_sequencer_build_packet_to_send (VortexCtx           * ctx,
 
 	/* check here if we have a feeder defined */
 	if (data->feeder) {
-		if (data->feeder->status == 0) {
+		if (data->feeder->status == 0 && vortex_payload_feeder_get_mapped (data->feeder, size_to_copy, &chunk)) {
+			/* content mapped: reference it while building the frame */
+			size_to_copy = chunk.prefix_size + chunk.content_size;
+			mapped       = axl_true;
+			use_pieces   = vortex_connection_is_default_send (conn);
+		} else if (data->feeder->status == 0) {
 			/* check and increase buffer */
-			CHECK_AND_INCREASE_BUFFER (size_to_copy, ctx->sequencer_feeder_buffer, ctx->sequencer_feeder_buffer_size);
+			CHECK_AND_INCREASE_BUFFER (size_to_copy, state->feeder_buffer, state->feeder_buffer_size);
 
 			/* get content available at this moment to be sent */
-			size_to_copy = vortex_payload_feeder_get_content (data->feeder, size_to_copy, ctx->sequencer_feeder_buffer);
+			size_to_copy = vortex_payload_feeder_get_content (data->feeder, size_to_copy, state->feeder_buffer);
 		} else {
 			vortex_log (VORTEX_LEVEL_DEBUG, "feeder cancelled, close transfer status is: %d", data->feeder->close_transfer);
 			if (! data->feeder->close_transfer) {
@@ -347,16 +613,16 @@ int vortex_sequencer_build_packet_to_send (VortexCtx           * ctx,
 	
 	vortex_log (VORTEX_LEVEL_DEBUG, "the channel=%d (on conn-id=%d) is not stalled, continue with sequencing, about to send (size_to_copy:%d) bytes as payload (buffer:%d)...",
  		    vortex_channel_get_number (channel), 
-		    vortex_connection_get_id (vortex_channel_get_connection (channel)), size_to_copy, ctx->sequencer_send_buffer_size);
+		    vortex_connection_get_id (vortex_channel_get_connection (channel)), size_to_copy, state->send_buffer_size);
  	vortex_log (VORTEX_LEVEL_DEBUG, "channel remote max seq no accepted: %u (proposed: %u)...",
  		    vortex_channel_get_max_seq_no_remote_accepted (channel), max_seq_no_accepted);
 	
 	/* create the new package to be managed by the vortex writer */
 	packet->msg_no = data->msg_no;
  
-	if (size_to_copy > 0) {
+	if (size_to_copy > 0 && ! use_pieces) {
 		/* check if we have to realloc buffer */
-		CHECK_AND_INCREASE_BUFFER (size_to_copy, ctx->sequencer_send_buffer, ctx->sequencer_send_buffer_size);
+		CHECK_AND_INCREASE_BUFFER (size_to_copy, state->send_buffer, state->send_buffer_size);
 	}
 	
 	/* we have the payload on buffer */
@@ -373,7 +639,7 @@ build_frame:
 
 	/* point to payload */
 	if (data->feeder) {
-		payload = (size_to_copy > 0) ? ctx->sequencer_feeder_buffer : NULL;
+		payload = (size_to_copy > 0 && ! mapped) ? state->feeder_buffer : NULL;
 	} else
 		payload = (data->message != NULL) ? (data->message + data->step) : NULL;
 
@@ -389,6 +655,18 @@ build_frame:
 	} else
 		packet->is_complete = (size_to_copy == data->message_size);
 
+	/* build frame referencing the payload (not copied) */
+	if (data->no_copy && size_to_copy > 0) {
+		packet->the_frame = __vortex_sequencer_build_pieces (ctx, state, data, packet, size_to_copy, use_pieces);
+		goto frame_built;
+	} /* end if */
+
+	/* build frame referencing feeder content mapped */
+	if (mapped && size_to_copy > 0) {
+		packet->the_frame = __vortex_sequencer_build_mapped (ctx, state, data, packet, &chunk, size_to_copy, use_pieces);
+		goto frame_built;
+	} /* end if */
+
 	/* build frame */
 	packet->the_frame = vortex_frame_build_up_from_params_s_buffer (
 		data->type,        /* frame type to be created */
@@ -411,8 +689,9 @@ build_frame:
 		/* calculated frame size */
 		&(packet->the_size),
 		/* buffer and its size */
-		ctx->sequencer_send_buffer, ctx->sequencer_send_buffer_size);
+		state->send_buffer, state->send_buffer_size);
 
+frame_built:
 	/* update fixed more flag on packet */
 	packet->fixed_more = data->fixed_more;
 	
@@ -420,13 +699,229 @@ build_frame:
 	return size_to_copy;
 }
 
+/** 
+ * @internal Reply written, pending to be signaled once the batch
+ * holding it is flushed.
+ */
+typedef struct _VortexSequencerReply {
+	VortexChannel * channel;
+	int             msg_no;
+} VortexSequencerReply;
+
+void __vortex_sequencer_reply_free (VortexSequencerReply * reply)
+{
+	vortex_channel_unref2 (reply->channel, "sequencer-batch");
+	axl_free (reply);
+	return;
+}
+
+/** 
+ * @internal Signals the reply (RPY or last NUL) identified by msg_no
+ * was written on the provided channel.
+ */
+void __vortex_sequencer_signal_reply_sent (VortexChannel * channel, int msg_no)
+{
+	/* update reply sent */
+	vortex_channel_update_status (channel, 0, msg_no, UPDATE_RPY_NO_WRITTEN);
+
+	/* unblock waiting thread for replies sent */
+	vortex_channel_signal_reply_sent_on_close_blocked (channel);
+		
+	/* signal reply sent */
+	vortex_channel_signal_rpy_sent (channel, msg_no);
+
+	return;
+}
+
+void __vortex_sequencer_batch_free (VortexSequencerBatch * batch)
+{
+	if (batch == NULL)
+		return;
+	axl_list_free (batch->replies);
+	axl_free (batch->buffer);
+	vortex_connection_unref (batch->conn, "sequencer-batch");
+	axl_free (batch);
+	return;
+}
+
+/** 
+ * @internal Writes all frames joined on the provided batch, signaling
+ * replies written.
+ */
+axl_bool __vortex_sequencer_batch_flush (VortexCtx * ctx, VortexSequencerBatch * batch)
+{
+	axl_bool               result = axl_true;
+	VortexSequencerReply * reply;
+	int                    iterator;
+
+	if (batch->size == 0)
+		return axl_true;
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "flushing %d bytes joined (replies: %d) over connection id=%d",
+		    batch->size, axl_list_length (batch->replies), vortex_connection_get_id (batch->conn));
+
+	if (! vortex_frame_send_raw (batch->conn, batch->buffer, batch->size)) {
+		/* drop a log */
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to flush frames joined over connection id=%d: errno=(%d): %s", 
+			    vortex_connection_get_id (batch->conn),
+			    errno, vortex_errno_get_error (errno));
+		result = axl_false;
+	} /* end if */
+	batch->size = 0;
+
+	/* signal replies written */
+	iterator = 0;
+	while (iterator < axl_list_length (batch->replies)) {
+		reply = axl_list_get_nth (batch->replies, iterator);
+		__vortex_sequencer_signal_reply_sent (reply->channel, reply->msg_no);
+		iterator++;
+	} /* end while */
+	axl_list_free (batch->replies);
+	batch->replies = NULL;
+
+	return result;
+}
+
+/** 
+ * @internal Flushes frames joined for the provided connection (if
+ * any).
+ */
+void __vortex_sequencer_batch_flush_conn (VortexCtx * ctx, VortexSequencerState * state, VortexConnection * conn)
+{
+	VortexSequencerBatch * batch;
+
+	batch = axl_hash_get (state->batches, conn);
+	if (batch != NULL)
+		__vortex_sequencer_batch_flush (ctx, batch);
+	return;
+}
+
+/** 
+ * @internal Flushes frames joined during previous sequencer rounds.
+ *
+ * @param force If axl_true, all batches are flushed. Otherwise, only
+ * batches older than VORTEX_SEQUENCER_FLUSH_LATENCY are flushed.
+ */
+void __vortex_sequencer_batch_flush_all (VortexCtx * ctx, VortexSequencerState * state, axl_bool force)
+{
+	axlHashCursor        * cursor;
+	VortexSequencerBatch * batch;
+	struct timeval         now;
+	struct timeval         diff;
+
+	if (axl_hash_items (state->batches) == 0)
+		return;
+
+	/* check if we have to flush all batches */
+	if (ctx->sequencer_flush_latency <= 0)
+		force = axl_true;
+	if (! force)
+		gettimeofday (&now, NULL);
+
+	cursor = axl_hash_cursor_new (state->batches);
+	axl_hash_cursor_first (cursor);
+	while (axl_hash_cursor_has_item (cursor)) {
+		batch = axl_hash_cursor_get_value (cursor);
+
+		if (! force) {
+			/* keep joining frames while latency is not reached */
+			vortex_timeval_substract (&now, &(batch->stamp), &diff);
+			if (((diff.tv_sec * 1000000) + diff.tv_usec) < ctx->sequencer_flush_latency) {
+				axl_hash_cursor_next (cursor);
+				continue;
+			} /* end if */
+		} /* end if */
+
+		/* flush and release batch */
+		__vortex_sequencer_batch_flush (ctx, batch);
+		axl_hash_cursor_remove (cursor);
+	} /* end while */
+	axl_hash_cursor_free (cursor);
+
+	return;
+}
+
+/** 
+ * @internal Sends the packet built, joining it with other frames
+ * built for the same connection during this round so all of them
+ * are written with a single send operation. Frames that reference
+ * their payload (not copied) or frames larger than
+ * VORTEX_SEQUENCER_FLUSH_SIZE are written directly (after flushing
+ * frames joined to keep order).
+ */
+axl_bool __vortex_sequencer_batch_send (VortexCtx            * ctx,
+					VortexSequencerState * state,
+					VortexConnection     * conn,
+					VortexChannel        * channel,
+					VortexWriterData     * packet)
+{
+	VortexSequencerBatch * batch;
+	VortexSequencerReply * reply;
+
+	/* write batching disabled or frame not suitable to be joined */
+	if (ctx->sequencer_flush_size <= 0 || packet->pieces_num > 0 || 
+	    packet->the_frame == NULL || packet->the_size >= ctx->sequencer_flush_size) {
+		__vortex_sequencer_batch_flush_conn (ctx, state, conn);
+		return vortex_sequencer_direct_send (conn, channel, packet);
+	} /* end if */
+
+	/* get batch for this connection */
+	batch = axl_hash_get (state->batches, conn);
+	if (batch == NULL) {
+		if (! vortex_connection_ref (conn, "sequencer-batch"))
+			return vortex_sequencer_direct_send (conn, channel, packet);
+		batch       = axl_new (VortexSequencerBatch, 1);
+		batch->conn = conn;
+		axl_hash_insert_full (state->batches, conn, NULL, batch, (axlDestroyFunc) __vortex_sequencer_batch_free);
+	} /* end if */
+
+	/* flush if the frame does not fit */
+	if ((batch->size + packet->the_size) > ctx->sequencer_flush_size)
+		__vortex_sequencer_batch_flush (ctx, batch);
+
+	/* check and increase buffer */
+	if ((batch->size + packet->the_size) > batch->buffer_size) {
+		batch->buffer_size = ctx->sequencer_flush_size;
+		batch->buffer      = axl_realloc (batch->buffer, batch->buffer_size);
+	} /* end if */
+
+	/* record when the first frame was joined */
+	if (batch->size == 0)
+		gettimeofday (&(batch->stamp), NULL);
+
+	/* join frame */
+	memcpy (batch->buffer + batch->size, packet->the_frame, packet->the_size);
+	batch->size += packet->the_size;
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "frame joined (size %d) over channel=%d, connection id=%d, pending to flush: %d",
+		    packet->the_size, vortex_channel_get_number (channel), vortex_connection_get_id (conn), batch->size);
+
+	/* record reply to be signaled once written */
+	if ((packet->type == VORTEX_FRAME_TYPE_RPY || packet->type == VORTEX_FRAME_TYPE_NUL) && packet->is_complete && ! packet->fixed_more) {  
+		if (! vortex_channel_ref2 (channel, "sequencer-batch")) {
+			/* unable to hold the channel: signal now */
+			__vortex_sequencer_signal_reply_sent (channel, packet->msg_no);
+			return axl_true;
+		} /* end if */
+
+		reply          = axl_new (VortexSequencerReply, 1);
+		reply->channel = channel;
+		reply->msg_no  = packet->msg_no;
+		if (batch->replies == NULL)
+			batch->replies = axl_list_new (axl_list_always_return_1, (axlDestroyFunc) __vortex_sequencer_reply_free);
+		axl_list_append (batch->replies, reply);
+	} /* end if */
+
+	return axl_true;
+}
+
 /** 
  * @internal Function that does a send round for a channel. The
  * function assumes the channel is not stalled (but can end stalled
  * after the function finished).
  *
  */ 
-void __vortex_sequencer_do_send_round (VortexCtx * ctx, VortexChannel * channel, VortexConnection * conn, axl_bool * paused, axl_bool * complete)
+void __vortex_sequencer_do_send_round (VortexCtx * ctx, VortexSequencerState * state, VortexChannel * channel, VortexConnection * conn, axl_bool * paused, axl_bool * complete)
 {
 	VortexSequencerData  * data;
 #if defined(ENABLE_VORTEX_LOG)
@@ -462,7 +957,7 @@ void __vortex_sequencer_do_send_round (VortexCtx * ctx, VortexChannel * channel,
 		    data, data->type, data->msg_no, data->first_seq_no, message_size, max_seq_no, data->step);
   		
 	/* build the packet to send */
-	size_to_copy = vortex_sequencer_build_packet_to_send (ctx, channel, conn, data, &packet);
+	size_to_copy = vortex_sequencer_build_packet_to_send (ctx, state, channel, conn, data, &packet);
 	*complete    = packet.is_complete;
 
 	/* check if the transfer is cancelled or paused */
@@ -515,7 +1010,7 @@ void __vortex_sequencer_do_send_round (VortexCtx * ctx, VortexChannel * channel,
 	vortex_log (VORTEX_LEVEL_DEBUG, "frame built, send the frame directly (over channel=%d, conn-id=%d)",
 		    vortex_channel_get_number (channel), vortex_connection_get_id (conn));
 
-	if (! vortex_sequencer_direct_send (conn, channel, &packet)) {
+	if (! __vortex_sequencer_batch_send (ctx, state, conn, channel, &packet)) {
 		vortex_log (VORTEX_LEVEL_WARNING, "unable to send data at this moment");
 		return;
 	}
@@ -524,6 +1019,288 @@ void __vortex_sequencer_do_send_round (VortexCtx * ctx, VortexChannel * channel,
 	return;
 }
 
+/** 
+ * @internal Wakes up the output thread while it is blocked waiting
+ * for sockets to be writable (the read end of the wake pipe is part
+ * of its fd group).
+ */
+void __vortex_sequencer_output_wake (VortexCtx * ctx)
+{
+	if (ctx->output_wake[1] < 0)
+		return;
+
+	/* the pipe may be full (output thread not draining it yet),
+	 * in such case it will wake up anyway */
+	send (ctx->output_wake[1], "w", 1, 0);
+	return;
+}
+
+/** 
+ * @internal Closes the output thread wake pipe.
+ */
+void __vortex_sequencer_output_close_wake (VortexCtx * ctx)
+{
+	if (ctx->output_wake[0] >= 0)
+		vortex_close_socket (ctx->output_wake[0]);
+	if (ctx->output_wake[1] >= 0)
+		vortex_close_socket (ctx->output_wake[1]);
+	ctx->output_wake[0] = -1;
+	ctx->output_wake[1] = -1;
+	return;
+}
+
+/** 
+ * @internal Reads all wake notifications pending on the wake pipe.
+ */
+void __vortex_sequencer_output_woken (VortexCtx * ctx)
+{
+	char buffer[64];
+
+	if (ctx->output_wake[0] < 0)
+		return;
+
+	while (recv (ctx->output_wake[0], buffer, sizeof (buffer), 0) > 0);
+	return;
+}
+
+/** 
+ * @internal Notifies the output thread that the provided connection
+ * has content queued (asynchronous writes, see \ref
+ * VORTEX_ASYNC_WRITES) that must be written once its socket is
+ * writable.
+ *
+ * @param ctx The context where the output thread is running.
+ *
+ * @param conn The connection to watch.
+ */
+void vortex_sequencer_watch_output (VortexCtx * ctx, VortexConnection * conn)
+{
+	axl_bool running;
+	axl_bool resume;
+
+	if (ctx == NULL || conn == NULL)
+		return;
+
+	/* acquire a reference that is released by the output thread */
+	if (! vortex_connection_ref (conn, "sequencer-output")) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to acquire reference to conn-id=%d (%p) to watch its output",
+			    vortex_connection_get_id (conn), conn);
+		return;
+	} /* end if */
+
+	/* output thread stopped (or being stopped, see
+	 * vortex_sequencer_stop): write content queued here */
+	running = ctx->output_running;
+	if (running) {
+		vortex_mutex_lock (&ctx->output_mutex);
+		running = ctx->output_running;
+		if (running) {
+			axl_list_append (ctx->output_conns, conn);
+			vortex_cond_signal (&ctx->output_cond);
+		} /* end if */
+		vortex_mutex_unlock (&ctx->output_mutex);
+	} /* end if */
+	if (! running) {
+		vortex_frame_flush_output (conn);
+		vortex_frame_notify_writable (conn);
+		vortex_frame_drain_output (conn, &resume);
+		vortex_connection_unref (conn, "sequencer-output");
+		return;
+	} /* end if */
+
+	/* wake up the output thread in the case it is waiting for
+	 * other sockets to be writable */
+	__vortex_sequencer_output_wake (ctx);
+
+	return;
+}
+
+/** 
+ * @internal Installs a handler that is notified (once) by the output
+ * thread when the provided connection socket can be written without
+ * blocking. It allows writers that don't use the connection output
+ * queue (TUNNEL relays) to wait for the socket without polling it.
+ *
+ * @param ctx The context where the output thread is running.
+ *
+ * @param conn The connection to watch.
+ *
+ * @param on_writable The handler to notify.
+ *
+ * @param user_data User defined data passed to the handler.
+ *
+ * @return axl_true if the handler was installed, otherwise axl_false
+ * is returned: the output thread is not running (see \ref
+ * VORTEX_ASYNC_WRITES) or the connection already has a handler
+ * installed.
+ */
+axl_bool vortex_sequencer_watch_writable (VortexCtx                  * ctx,
+					  VortexConnection           * conn,
+					  VortexConnectionOnWritable   on_writable,
+					  axlPointer                   user_data)
+{
+	axl_bool watch;
+
+	if (ctx == NULL || conn == NULL || on_writable == NULL || ! ctx->output_running)
+		return axl_false;
+
+	if (! vortex_frame_set_writable (conn, on_writable, user_data, &watch))
+		return axl_false;
+
+	/* notify output thread (if it was stopped meanwhile, the
+	 * handler is notified from here) */
+	if (watch)
+		vortex_sequencer_watch_output (ctx, conn);
+
+	return axl_true;
+}
+
+axl_bool __vortex_sequencer_collect_channel (axlPointer key, axlPointer value, axlPointer user_data)
+{
+	VortexChannel * channel  = value;
+	axlList       * channels = user_data;
+
+	if (vortex_channel_ref2 (channel, "sequencer-output"))
+		axl_list_append (channels, channel);
+
+	/* keep on iterating */
+	return axl_false;
+}
+
+/** 
+ * @internal Puts again into the sequencer all channels of a
+ * connection that was parked because its output queue was over the
+ * high water mark.
+ */
+void __vortex_sequencer_output_resume (VortexConnection * conn)
+{
+	axlList       * channels = axl_list_new (axl_list_always_return_1, NULL);
+	VortexChannel * channel;
+
+	/* collect channels (without holding the connection lock
+	 * while the sequencer is signaled) */
+	vortex_connection_foreach_channel (conn, __vortex_sequencer_collect_channel, channels);
+
+	while (axl_list_length (channels) > 0) {
+		channel = axl_list_get_first (channels);
+		axl_list_unlink_first (channels);
+
+		vortex_sequencer_signal_update (channel, conn);
+		vortex_channel_unref2 (channel, "sequencer-output");
+	} /* end while */
+	axl_list_free (channels);
+
+	return;
+}
+
+/** 
+ * @internal Output thread: writes content queued on connections
+ * (asynchronous writes) as soon as their sockets are writable,
+ * resuming channels parked by the sequencer once a connection goes
+ * below the high water mark.
+ */
+axlPointer __vortex_sequencer_output_run (axlPointer _data)
+{
+	VortexCtx        * ctx      = _data;
+	axlList          * pending  = axl_list_new (axl_list_always_return_1, NULL);
+	axlPointer         on_write = vortex_io_waiting_invoke_create_fd_group (ctx, WRITE_OPERATIONS);
+	VortexConnection * conn;
+	VORTEX_SOCKET      max_fds;
+	axl_bool           resume;
+	axl_bool           drained;
+	int                iterator;
+
+	vortex_mutex_lock (&ctx->output_mutex);
+	while (! ctx->output_exit) {
+		/* wait for new connections to watch */
+		if (axl_list_length (ctx->output_conns) == 0 && axl_list_length (pending) == 0) {
+			vortex_cond_timedwait (&ctx->output_cond, &ctx->output_mutex, 100000);
+			continue;
+		} /* end if */
+
+		/* get connections notified */
+		while (axl_list_length (ctx->output_conns) > 0) {
+			axl_list_append (pending, axl_list_get_first (ctx->output_conns));
+			axl_list_unlink_first (ctx->output_conns);
+		} /* end while */
+		vortex_mutex_unlock (&ctx->output_mutex);
+
+		/* write what is possible on each connection */
+		if (on_write != NULL)
+			vortex_io_waiting_invoke_clear_fd_group (ctx, on_write);
+		max_fds  = 0;
+		iterator = 0;
+
+		/* watch the wake pipe to attend new connections
+		 * notified while waiting (otherwise the wait is only
+		 * bounded by the I/O mechanism timeout) */
+		__vortex_sequencer_output_woken (ctx);
+		if (on_write != NULL && vortex_io_waiting_invoke_add_wake_to_fd_group (ctx, ctx->output_wake[0], on_write))
+			max_fds = ctx->output_wake[0];
+
+		while (iterator < axl_list_length (pending)) {
+			conn = axl_list_get_nth (pending, iterator);
+
+			drained = vortex_frame_drain_output (conn, &resume);
+			if (resume)
+				__vortex_sequencer_output_resume (conn);
+
+			/* all content queued was written: notify the
+			 * write readiness handler (if any), checking
+			 * again in case it was installed again */
+			if (! drained && vortex_frame_notify_writable (conn)) {
+				drained = vortex_frame_drain_output (conn, &resume);
+				if (resume)
+					__vortex_sequencer_output_resume (conn);
+			} /* end if */
+
+			if (drained) {
+				/* nothing more to write */
+				axl_list_remove_ptr (pending, conn);
+				vortex_connection_unref (conn, "sequencer-output");
+				continue;
+			} /* end if */
+
+			/* watch the socket */
+			if (on_write != NULL)
+				vortex_io_waiting_invoke_add_to_fd_group (ctx, vortex_connection_get_socket (conn), conn, on_write);
+			if (vortex_connection_get_socket (conn) > max_fds)
+				max_fds = vortex_connection_get_socket (conn);
+			iterator++;
+		} /* end while */
+
+		/* wait until some socket is writable */
+		if (axl_list_length (pending) > 0 && on_write != NULL)
+			vortex_io_waiting_invoke_wait (ctx, on_write, max_fds + 1, WRITE_OPERATIONS);
+
+		vortex_mutex_lock (&ctx->output_mutex);
+	} /* end while */
+
+	/* release connections still watched, writing first content
+	 * queued (bounded wait, see vortex_frame_flush_output) */
+	while (axl_list_length (ctx->output_conns) > 0) {
+		axl_list_append (pending, axl_list_get_first (ctx->output_conns));
+		axl_list_unlink_first (ctx->output_conns);
+	} /* end while */
+	vortex_mutex_unlock (&ctx->output_mutex);
+
+	while (axl_list_length (pending) > 0) {
+		conn = axl_list_get_first (pending);
+		axl_list_unlink_first (pending);
+		vortex_frame_flush_output (conn);
+		vortex_frame_notify_writable (conn);
+		vortex_frame_drain_output (conn, &resume);
+		vortex_connection_unref (conn, "sequencer-output");
+	} /* end while */
+	axl_list_free (pending);
+
+	if (on_write != NULL)
+		vortex_io_waiting_invoke_destroy_fd_group (ctx, on_write);
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "output thread finished");
+	return NULL;
+}
+
 void vortex_sequencer_process_channels (VortexCtx * ctx, VortexSequencerState * state, axl_bool process_channel_0)
 {
 	axl_bool               paused;
@@ -569,6 +1346,14 @@ void vortex_sequencer_process_channels (VortexCtx * ctx, VortexSequencerState *
 		/* get connection reference */
 		conn = vortex_channel_get_connection (channel);
 		
+		/* check if the connection has too much output queued */
+		if (vortex_frame_output_blocked (conn)) {
+			vortex_log (VORTEX_LEVEL_DEBUG, "conn-id=%d output is over the high water mark, parking channel=%d (%p)",
+				    vortex_connection_get_id (conn), vortex_channel_get_number (channel), channel);
+			axl_hash_cursor_remove (state->ready_cursor);
+			continue;
+		} /* end if */
+
 		/* acquire connection */
 		if (! vortex_connection_ref (conn, "vortex-sequencer")) {
 			vortex_log (VORTEX_LEVEL_CRITICAL, "Unable to acquire reference to the connection (%p) inside vortex sequencer to do sending round, dropping channel (%p)",
@@ -587,7 +1372,7 @@ void vortex_sequencer_process_channels (VortexCtx * ctx, VortexSequencerState *
 		paused   = axl_false;
 		complete = axl_false;
 		is_empty = axl_false;
-		__vortex_sequencer_do_send_round (ctx, channel, conn, &paused, &complete);
+		__vortex_sequencer_do_send_round (ctx, state, channel, conn, &paused, &complete);
 		
 		vortex_log (VORTEX_LEVEL_DEBUG, "it seems the message was sent completely over conn-id=%d, channel=%d (%p)",
 			    vortex_connection_get_id (conn), vortex_channel_get_number (channel), channel);
@@ -640,12 +1425,10 @@ void vortex_sequencer_process_channels (VortexCtx * ctx, VortexSequencerState *
 	
 axlPointer __vortex_sequencer_run (axlPointer _data)
 {
+	/* get the state handled by this thread */
+	VortexSequencerState * state = _data;
 	/* get current context */
-	VortexCtx            * ctx = _data;
-	VortexSequencerState * state;
-
-	/* get the state */
-	state = ctx->sequencer_state;
+	VortexCtx            * ctx   = state->ctx;
 
 	/* lock mutex (acquire) */
 	vortex_mutex_lock (&state->mutex);
@@ -655,6 +1438,13 @@ axlPointer __vortex_sequencer_run (axlPointer _data)
 		 * only if there are no ready events) */
 		vortex_log (VORTEX_LEVEL_DEBUG, "sequencer locking (ready channels: %d, exit: %d)",
 			    axl_hash_items (state->ready), state->exit);
+		if ((axl_hash_items (state->ready) == 0) && (axl_hash_items (state->batches) > 0)) {
+			/* nothing more to sequence: write frames joined
+			 * before waiting */
+			vortex_mutex_unlock (&state->mutex);
+			__vortex_sequencer_batch_flush_all (ctx, state, axl_true);
+			vortex_mutex_lock (&state->mutex);
+		} /* end if */
 		while ((axl_hash_items (state->ready) == 0) && (! state->exit )) {
 			vortex_cond_timedwait (&state->cond, &state->mutex, 10000);
 		} /* end if */
@@ -668,6 +1458,9 @@ axlPointer __vortex_sequencer_run (axlPointer _data)
 
 			/* release unlock now we are finishing */
 			vortex_mutex_unlock (&state->mutex);
+
+			/* write frames still joined */
+			__vortex_sequencer_batch_flush_all (ctx, state, axl_true);
 			
 			vortex_log (VORTEX_LEVEL_DEBUG, "exiting vortex sequencer thread ..");
 
@@ -682,6 +1475,12 @@ axlPointer __vortex_sequencer_run (axlPointer _data)
 
 		/* now process the rest */
 		vortex_sequencer_process_channels (ctx, state, axl_false);
+
+		/* write frames joined during this round (according
+		 * to the latency configured) */
+		vortex_mutex_unlock (&state->mutex);
+		__vortex_sequencer_batch_flush_all (ctx, state, axl_false);
+		vortex_mutex_lock (&state->mutex);
 		
 	} /* end while */
 
@@ -715,30 +1514,87 @@ axlPointer __vortex_sequencer_run (axlPointer _data)
  **/
 axl_bool  vortex_sequencer_run (VortexCtx * ctx)
 {
+	VortexSequencerState * state;
+	int                    iterator;
 
 	v_return_val_if_fail (ctx, axl_false);
 
-	/* sequencer queue where all data is received */
-	if (ctx->sequencer_state != NULL)
-		vortex_sequencer_release_state (ctx->sequencer_state);
-	ctx->sequencer_state  = vortex_sequencer_create_state ();
-
-	/* init sequencer buffer */
-	ctx->sequencer_send_buffer_size = 4096 + 100;
-	if (ctx->sequencer_send_buffer == NULL)
-		ctx->sequencer_send_buffer = axl_new (char, ctx->sequencer_send_buffer_size);
-
-	/* acquire a reference to the context to avoid loosing it
-	 * during a log running sequencer not stopped */
-	vortex_ctx_ref2 (ctx, "sequencer");
-
-	/* starts the vortex sequencer */
-	if (! vortex_thread_create (&ctx->sequencer_thread,
-				    (VortexThreadFunc) __vortex_sequencer_run,
-				    ctx,
-				    VORTEX_THREAD_CONF_END)) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to initialize the sequencer thread");
-		return axl_false;
+	/* sequencer queues where all data is received (one per
+	 * sequencer thread) */
+	if (ctx->sequencer_states != NULL) {
+		for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++)
+			vortex_sequencer_release_state (ctx->sequencer_states[iterator]);
+		axl_free (ctx->sequencer_states);
+	} /* end if */
+	ctx->sequencer_states_num = ctx->sequencer_threads > 1 ? ctx->sequencer_threads : 1;
+	ctx->sequencer_states     = axl_new (VortexSequencerState *, ctx->sequencer_states_num);
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++) {
+		state        = vortex_sequencer_create_state ();
+		state->ctx   = ctx;
+		state->id    = iterator;
+
+		/* init sequencer buffer */
+		state->send_buffer_size = 4096 + 100;
+		state->send_buffer      = axl_new (char, state->send_buffer_size);
+
+		ctx->sequencer_states[iterator] = state;
+	} /* end for */
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "starting vortex sequencer with %d threads", ctx->sequencer_states_num);
+
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++) {
+		state = ctx->sequencer_states[iterator];
+
+		/* acquire a reference to the context to avoid loosing it
+		 * during a log running sequencer not stopped */
+		vortex_ctx_ref2 (ctx, "sequencer");
+
+		/* starts the vortex sequencer */
+		if (! vortex_thread_create (&state->thread,
+					    (VortexThreadFunc) __vortex_sequencer_run,
+					    state,
+					    VORTEX_THREAD_CONF_END)) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to initialize the sequencer thread %d", iterator);
+			vortex_ctx_unref2 (&ctx, "sequencer");
+			return axl_false;
+		} /* end if */
+	} /* end for */
+
+	/* starts the output thread (asynchronous writes) */
+	if (ctx->async_writes && ! ctx->output_running) {
+		vortex_mutex_create (&ctx->output_mutex);
+		vortex_cond_create  (&ctx->output_cond);
+		ctx->output_conns   = axl_list_new (axl_list_always_return_1, NULL);
+		ctx->output_exit    = axl_false;
+		ctx->output_running = axl_true;
+
+		/* create the wake pipe (without it, the output thread
+		 * attends new connections after the write wait times
+		 * out) */
+		if (vortex_support_pipe (ctx, ctx->output_wake) != 0) {
+			vortex_log (VORTEX_LEVEL_WARNING, "unable to create output thread wake pipe");
+			ctx->output_wake[0] = -1;
+			ctx->output_wake[1] = -1;
+		} else {
+			/* both ends are non blocking: the output
+			 * thread drains the read end on each
+			 * iteration */
+			vortex_connection_set_sock_block (ctx->output_wake[0], axl_false);
+			vortex_connection_set_sock_block (ctx->output_wake[1], axl_false);
+		} /* end if */
+
+		if (! vortex_thread_create (&ctx->output_thread,
+					    (VortexThreadFunc) __vortex_sequencer_output_run,
+					    ctx,
+					    VORTEX_THREAD_CONF_END)) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to initialize the output thread, using blocking writes");
+			ctx->output_running = axl_false;
+			__vortex_sequencer_output_close_wake (ctx);
+			axl_list_free (ctx->output_conns);
+			ctx->output_conns   = NULL;
+			vortex_mutex_destroy (&ctx->output_mutex);
+			vortex_cond_destroy  (&ctx->output_cond);
+		} /* end if */
 	} /* end if */
 
 	/* ok, sequencer initialized */
@@ -752,6 +1608,7 @@ axl_bool  vortex_sequencer_run (VortexCtx * ctx)
 void vortex_sequencer_stop (VortexCtx * ctx)
 {
 	VortexSequencerState * state;
+	int                    iterator;
 
 	v_return_if_fail (ctx);
 
@@ -762,26 +1619,52 @@ void vortex_sequencer_stop (VortexCtx * ctx)
 	 */
 	vortex_log (VORTEX_LEVEL_DEBUG, "stopping vortex sequencer");
 
-	/* get reference tot he sequencer state */
-	state = ctx->sequencer_state;
-
-	/* signal the sequencer to stop */
-	vortex_mutex_lock (&state->mutex);
-	state->exit = axl_true;
-	vortex_cond_signal (&state->cond);
-	vortex_mutex_unlock (&state->mutex);
+	if (ctx->sequencer_states == NULL)
+		return;
 
-	/* wait until the sequencer stops */
-	vortex_log (VORTEX_LEVEL_DEBUG, "vortex sequencer properly stopped, cleaning thread..");
-	vortex_thread_destroy  (&ctx->sequencer_thread, axl_false);
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++) {
+		/* get reference tot he sequencer state */
+		state = ctx->sequencer_states[iterator];
 
-	/* release state */
-	vortex_sequencer_release_state (state);
-	ctx->sequencer_state = NULL;
+		/* signal the sequencer to stop */
+		vortex_mutex_lock (&state->mutex);
+		state->exit = axl_true;
+		vortex_cond_signal (&state->cond);
+		vortex_mutex_unlock (&state->mutex);
+	} /* end for */
+
+	/* wait until sequencer threads stop */
+	vortex_log (VORTEX_LEVEL_DEBUG, "vortex sequencer properly stopped, cleaning threads..");
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++)
+		vortex_thread_destroy  (&ctx->sequencer_states[iterator]->thread, axl_false);
+
+	/* stop the output thread (it writes content still queued
+	 * before finishing) */
+	if (ctx->output_running) {
+		/* from now on, connections are not handed to the
+		 * output thread (see vortex_sequencer_watch_output) */
+		vortex_mutex_lock (&ctx->output_mutex);
+		ctx->output_running = axl_false;
+		ctx->output_exit    = axl_true;
+		vortex_cond_signal (&ctx->output_cond);
+		vortex_mutex_unlock (&ctx->output_mutex);
+		__vortex_sequencer_output_wake (ctx);
+
+		/* join the thread before releasing what it uses */
+		vortex_thread_destroy (&ctx->output_thread, axl_false);
+		__vortex_sequencer_output_close_wake (ctx);
+		axl_list_free (ctx->output_conns);
+		ctx->output_conns   = NULL;
+		vortex_mutex_destroy (&ctx->output_mutex);
+		vortex_cond_destroy  (&ctx->output_cond);
+	} /* end if */
 
-	/* free sequencer buffer */
-	axl_free (ctx->sequencer_send_buffer);
-	axl_free (ctx->sequencer_feeder_buffer);
+	/* release states (and their buffers) */
+	for (iterator = 0; iterator < ctx->sequencer_states_num; iterator++)
+		vortex_sequencer_release_state (ctx->sequencer_states[iterator]);
+	axl_free (ctx->sequencer_states);
+	ctx->sequencer_states     = NULL;
+	ctx->sequencer_states_num = 0;
 
 	return; 
 }
@@ -810,7 +1693,17 @@ axl_bool      vortex_sequencer_direct_send (VortexConnection    * connection,
 			    vortex_channel_get_number (channel), channel, vortex_connection_get_id (connection), errno);
 #endif
 
-	if (! vortex_frame_send_raw (connection, packet->the_frame, packet->the_size)) {
+	/* send the frame: pieces referencing the payload (not copied)
+	 * or the frame built at a single buffer */
+	if (packet->file_piece > 0)
+		result = vortex_frame_send_raw_file (connection, packet->pieces, packet->pieces_size, packet->pieces_num,
+						     packet->file_piece, packet->file_fd, packet->file_offset);
+	else if (packet->pieces_num > 0)
+		result = vortex_frame_send_raw_pieces (connection, packet->pieces, packet->pieces_size, packet->pieces_num);
+	else
+		result = vortex_frame_send_raw (connection, packet->the_frame, packet->the_size);
+
+	if (! result) {
 		/* drop a log */
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to send frame over connection id=%d: errno=(%d): %s", 
 			    vortex_connection_get_id (connection),
@@ -821,17 +1714,8 @@ axl_bool      vortex_sequencer_direct_send (VortexConnection    * connection,
 	}
 	
 	/* signal the message have been sent */
-	if ((packet->type == VORTEX_FRAME_TYPE_RPY || packet->type == VORTEX_FRAME_TYPE_NUL) && packet->is_complete && ! packet->fixed_more) {  
-
-		/* update reply sent */
-		vortex_channel_update_status (channel, 0, packet->msg_no, UPDATE_RPY_NO_WRITTEN);
-
-		/* unblock waiting thread for replies sent */
-		vortex_channel_signal_reply_sent_on_close_blocked (channel);
-		
-		/* signal reply sent */
-		vortex_channel_signal_rpy_sent (channel, packet->msg_no);
-	}
+	if ((packet->type == VORTEX_FRAME_TYPE_RPY || packet->type == VORTEX_FRAME_TYPE_NUL) && packet->is_complete && ! packet->fixed_more) 
+		__vortex_sequencer_signal_reply_sent (channel, packet->msg_no);
 
 	/* nothing more */
 	return result;
@@ -859,7 +1743,9 @@ void     vortex_sequencer_signal_update        (VortexChannel       * channel,
 	if (vortex_channel_next_pending_message (channel)) {
 
 		/* get reference to the state */
-		state = ctx->sequencer_state;
+		state = __vortex_sequencer_get_state (ctx, channel);
+		if (state == NULL)
+			return;
 
 		/* move to ready */
 		vortex_mutex_lock (&state->mutex);
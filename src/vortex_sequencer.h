@@ -59,6 +59,16 @@ void     vortex_sequencer_signal_update            (VortexChannel       * channe
 void     vortex_sequencer_remove_channel           (VortexCtx        * ctx,
 						    VortexChannel    * channel);
 
+void     vortex_sequencer_release_message          (VortexSequencerData * data);
+
+void     vortex_sequencer_watch_output             (VortexCtx        * ctx,
+						    VortexConnection * conn);
+
+axl_bool vortex_sequencer_watch_writable           (VortexCtx                  * ctx,
+						    VortexConnection           * conn,
+						    VortexConnectionOnWritable   on_writable,
+						    axlPointer                   user_data);
+
 #endif
 
 
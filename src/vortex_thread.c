@@ -978,6 +978,164 @@ void vortex_cond_destroy   (VortexCond        * cond)
 	return;
 }
 
+#if ! defined(__GNUC__) && defined(AXL_OS_UNIX)
+/* fallback used by atomic operations when the compiler provides no
+ * builtins */
+static pthread_mutex_t __vortex_atomic_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/** 
+ * @brief Atomically adds the provided delta to the integer value
+ * referenced, without requiring a mutex. Used by the library to
+ * update reference counters and identifiers shared by several
+ * threads.
+ *
+ * @param value Reference to the value to update.
+ *
+ * @param delta The amount to add (use negative values to subtract).
+ *
+ * @return The value after being updated.
+ */
+int                vortex_atomic_add      (int               * value,
+					   int                 delta)
+{
+#if defined(__GNUC__)
+	return __sync_add_and_fetch (value, delta);
+#elif defined(AXL_OS_WIN32)
+	return InterlockedExchangeAdd ((LONG volatile *) value, delta) + delta;
+#else
+	int result;
+
+	pthread_mutex_lock (&__vortex_atomic_mutex);
+	(* value) += delta;
+	result     = (* value);
+	pthread_mutex_unlock (&__vortex_atomic_mutex);
+
+	return result;
+#endif
+}
+
+/** 
+ * @brief Atomically replaces the integer value referenced with
+ * new_value if it currently holds old_value.
+ *
+ * @param value Reference to the value to update.
+ *
+ * @param old_value The value expected.
+ *
+ * @param new_value The value to set.
+ *
+ * @return axl_true if the value was replaced, otherwise axl_false is
+ * returned (value didn't hold old_value).
+ */
+axl_bool           vortex_atomic_compare_and_swap (int       * value,
+						   int         old_value,
+						   int         new_value)
+{
+#if defined(__GNUC__)
+	return __sync_bool_compare_and_swap (value, old_value, new_value);
+#elif defined(AXL_OS_WIN32)
+	return InterlockedCompareExchange ((LONG volatile *) value, new_value, old_value) == old_value;
+#else
+	axl_bool result = axl_false;
+
+	pthread_mutex_lock (&__vortex_atomic_mutex);
+	if ((* value) == old_value) {
+		(* value) = new_value;
+		result    = axl_true;
+	} /* end if */
+	pthread_mutex_unlock (&__vortex_atomic_mutex);
+
+	return result;
+#endif
+}
+
+/** 
+ * @brief Atomically reads the integer value referenced (with a full
+ * memory barrier).
+ *
+ * @param value Reference to the value to read.
+ *
+ * @return The current value.
+ */
+int                vortex_atomic_get      (int               * value)
+{
+	return vortex_atomic_add (value, 0);
+}
+
+/** 
+ * @brief Atomically adds the provided delta to the long value
+ * referenced, without ordering other memory operations (relaxed). It
+ * is used to update counters (like bytes sent and received on a
+ * connection) that are read from other threads.
+ *
+ * @param value Reference to the value to update.
+ *
+ * @param delta The amount to add (use negative values to subtract).
+ *
+ * @return The value after being updated.
+ */
+long               vortex_atomic_add_long (long              * value,
+					   long                delta)
+{
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+	return __atomic_add_fetch (value, delta, __ATOMIC_RELAXED);
+#elif defined(__GNUC__)
+	return __sync_add_and_fetch (value, delta);
+#elif defined(AXL_OS_WIN32)
+	return InterlockedExchangeAdd ((LONG volatile *) value, delta) + delta;
+#else
+	long result;
+
+	pthread_mutex_lock (&__vortex_atomic_mutex);
+	(* value) += delta;
+	result     = (* value);
+	pthread_mutex_unlock (&__vortex_atomic_mutex);
+
+	return result;
+#endif
+}
+
+/** 
+ * @brief Atomically stores the provided long value (relaxed).
+ *
+ * @param value Reference to the value to update.
+ *
+ * @param new_value The value to set.
+ */
+void               vortex_atomic_set_long (long              * value,
+					   long                new_value)
+{
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+	__atomic_store_n (value, new_value, __ATOMIC_RELAXED);
+#elif defined(__GNUC__)
+	__sync_lock_test_and_set (value, new_value);
+#elif defined(AXL_OS_WIN32)
+	InterlockedExchange ((LONG volatile *) value, new_value);
+#else
+	pthread_mutex_lock (&__vortex_atomic_mutex);
+	(* value) = new_value;
+	pthread_mutex_unlock (&__vortex_atomic_mutex);
+#endif
+	return;
+}
+
+/** 
+ * @brief Atomically reads the long value referenced (relaxed).
+ *
+ * @param value Reference to the value to read.
+ *
+ * @return The current value.
+ */
+long               vortex_atomic_get_long (long              * value)
+{
+#if defined(__GNUC__) && defined(__ATOMIC_RELAXED)
+	return __atomic_load_n (value, __ATOMIC_RELAXED);
+#else
+	return vortex_atomic_add_long (value, 0);
+#endif
+}
+
 /** 
  * @internal Definition for the async queue.
  */
@@ -111,6 +111,23 @@ axl_bool           vortex_cond_timedwait  (VortexCond        * cond,
 
 void               vortex_cond_destroy    (VortexCond        * cond);
 
+int                vortex_atomic_add      (int               * value,
+					   int                 delta);
+
+axl_bool           vortex_atomic_compare_and_swap (int       * value,
+						   int         old_value,
+						   int         new_value);
+
+int                vortex_atomic_get      (int               * value);
+
+long               vortex_atomic_add_long (long              * value,
+					   long                delta);
+
+void               vortex_atomic_set_long (long              * value,
+					   long                new_value);
+
+long               vortex_atomic_get_long (long              * value);
+
 VortexAsyncQueue * vortex_async_queue_new       (void);
 
 axl_bool           vortex_async_queue_push      (VortexAsyncQueue * queue,
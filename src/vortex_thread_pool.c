@@ -41,8 +41,67 @@
 /* local include */
 #include <vortex_ctx_private.h>
 
+#if defined(AXL_OS_UNIX) && defined(__linux__)
+#include <sched.h>
+#endif
+
 #define LOG_DOMAIN "vortex-thread-pool"
 
+/** 
+ * @internal Max number of threads (worker slots) supported by the
+ * thread pool when work stealing is enabled.
+ */
+#define VORTEX_THREAD_POOL_MAX_WORKERS 1024
+
+/* vortex thread pool struct used by vortex library to notify to tasks
+ * to be performed to vortex thread pool */
+typedef struct _VortexThreadPoolTask {
+	VortexThreadFunc   func;
+	axlPointer         data;
+} VortexThreadPoolTask;
+
+/* worker slot used when work stealing is enabled: each thread owns a
+ * task queue (ring) that other threads steal from when idle. Slots
+ * are never released until the pool is stopped (a slot whose thread
+ * was removed is reused by the next thread added). */
+typedef struct _VortexThreadPoolWorker {
+	int                    index;
+	VortexThreadPool     * pool;
+	VortexThread         * thread;
+
+	/* task ring, protected by mutex */
+	VortexMutex            mutex;
+	VortexCond             cond;
+	VortexThreadPoolTask * tasks;
+	int                    size;
+	int                    head;
+	int                    count;
+
+	/* worker state (read without lock as a hint through
+	 * vortex_atomic_get) */
+	int                    sleeping;
+	int                    wakeup;
+	int                    stop;
+	int                    running;
+
+	/* last time events and resize were checked */
+	struct timeval         last_check;
+} VortexThreadPoolWorker;
+
+/* struct used to represent async events: events are stored on a
+ * binary min heap ordered by next_step (heap_index is the event
+ * position, -1 while its handler is running) and on a hash by id */
+typedef struct _VortexThreadPoolEvent {
+	int                      id;
+	VortexThreadAsyncEvent   func;
+	axlPointer               data;
+	axlPointer               data2;
+	long                     delay;
+	struct timeval           next_step;
+	int                      heap_index;
+	axl_bool                 removed;
+} VortexThreadPoolEvent;
+
 struct _VortexThreadPool {
 	/* new tasks to be procesed */
 	VortexAsyncQueue * queue;
@@ -53,10 +112,18 @@ struct _VortexThreadPool {
 	axlList          * stopped;
 	VortexMutex        stopped_mutex;
 
-	/* list of events */
-	axlList          * events;
-	axlListCursor    * events_cursor;
-	axl_bool           processing_events;
+	/* events: min heap (next to expire first), index by id and
+	 * the thread that sleeps until next event expires, all of
+	 * them protected by events_mutex */
+	VortexThreadPoolEvent ** events;
+	int                      events_num;
+	int                      events_size;
+	axlHash                * events_by_id;
+	int                      events_next_id;
+	VortexMutex              events_mutex;
+	VortexCond               events_cond;
+	VortexThread             events_thread;
+	axl_bool                 events_stop;
 
 	/* context */
 	VortexCtx        * ctx;
@@ -73,25 +140,18 @@ struct _VortexThreadPool {
 	axl_bool           preemtive;
 	struct timeval     last;
 
+	/* work stealing (see VORTEX_THREAD_POOL_WORK_STEALING):
+	 * workers_num slots used (only grows), next_worker round
+	 * robin cursor and idle number of sleeping workers (all of
+	 * them updated through vortex_atomic_*) */
+	axl_bool                  stealing;
+	axl_bool                  cpu_affinity;
+	VortexThreadPoolWorker ** workers;
+	int                       workers_num;
+	int                       next_worker;
+	int                       idle;
 };
 
-/* vortex thread pool struct used by vortex library to notify to tasks
- * to be performed to vortex thread pool */
-typedef struct _VortexThreadPoolTask {
-	VortexThreadFunc   func;
-	axlPointer         data;
-} VortexThreadPoolTask;
-
-/* struct used to represent async events */
-typedef struct _VortexThreadPoolEvent {
-	VortexThreadAsyncEvent   func;
-	axlPointer               data;
-	axlPointer               data2;
-	long                     delay;
-	struct timeval           next_step;
-	int                      ref_count;
-} VortexThreadPoolEvent;
-
 typedef struct _VortexThreadPoolStarter {
 	VortexThreadPool * pool;
 	VortexThread     * thread;
@@ -101,128 +161,233 @@ typedef struct _VortexThreadPoolStarter {
 /* update next step to the appropiate value */
 void __vortex_thread_pool_increase_stamp (VortexThreadPoolEvent * event)
 {
-	/* increase seconds part */
-	if ((event->next_step.tv_usec + event->delay) > 1000000) {
-		/* update seconds part */
-		event->next_step.tv_sec += ((event->next_step.tv_usec + event->delay) / 1000000);
-	} /* end if */
+	long usec = event->next_step.tv_usec + event->delay;
 
-	/* now increase microseconds part */
-	event->next_step.tv_usec = ((event->next_step.tv_usec + event->delay) % 1000000);
+	/* update seconds and microseconds part */
+	event->next_step.tv_sec  += (usec / 1000000);
+	event->next_step.tv_usec  = (usec % 1000000);
 
 	return;
 }
 
-void __vortex_thread_pool_unref_event (axlPointer _event)
+/** 
+ * @internal Returns axl_true if event a expires before event b.
+ */
+axl_bool __vortex_thread_pool_event_before (VortexThreadPoolEvent * a, VortexThreadPoolEvent * b)
 {
-	VortexThreadPoolEvent * event = _event;
-	event->ref_count--;
-	if (event->ref_count == 0) 
-		axl_free (event);
-	return;
+	if (a->next_step.tv_sec != b->next_step.tv_sec)
+		return a->next_step.tv_sec < b->next_step.tv_sec;
+	return a->next_step.tv_usec < b->next_step.tv_usec;
 }
 
-void __vortex_thread_pool_process_events (VortexCtx * ctx, VortexThreadPool * pool)
+/** 
+ * @internal Places the event at the provided heap position, updating
+ * its index.
+ */
+void __vortex_thread_pool_event_place (VortexThreadPool * pool, VortexThreadPoolEvent * event, int index)
 {
-	int                     length;
-	int                     iterator;
-	struct timeval          now;
-	VortexThreadPoolEvent * event;
-
-	/* reference to implement the call */
-	VortexThreadAsyncEvent   func;
-	axlPointer               data;
-	axlPointer               data2;
-
-	/* ensure only one thread is processing */
-	if (vortex_is_exiting (ctx))
-		return;
-
-	/* acquire lock */
-	vortex_mutex_lock (&pool->mutex);
-	/* ensure again we can continue */
-	if (pool->processing_events || axl_list_length (pool->events) == 0 || vortex_is_exiting (ctx)) {
-		vortex_mutex_unlock (&pool->mutex);
-		return;
-	} /* end if */
-
-	/* flag we are processing */
-	pool->processing_events = axl_true;
-	length = axl_list_length (pool->events);
-	vortex_mutex_unlock (&pool->mutex);
-	
-	/* get current stamp */
-	gettimeofday (&now, NULL);
-	iterator = 0;
-	/* vortex_log2 (VORTEX_LEVEL_DEBUG, "Found (%d) events to process: now (%d, %d)..", length, (int) now.tv_sec, (int) now.tv_usec); */
-	while (iterator < length) {
+	pool->events[index] = event;
+	event->heap_index   = index;
+	return;
+}
 
-		/* get event reference */
-		vortex_mutex_lock (&pool->mutex);
-		event = axl_list_get_nth (pool->events, iterator);
-		if (event == NULL) {
-			vortex_mutex_unlock (&pool->mutex);
+/** 
+ * @internal Moves the event at the provided heap position up or down
+ * until heap order is restored.
+ */
+void __vortex_thread_pool_event_sift (VortexThreadPool * pool, int index)
+{
+	VortexThreadPoolEvent * event = pool->events[index];
+	int                     parent;
+	int                     child;
+
+	/* up */
+	while (index > 0) {
+		parent = (index - 1) / 2;
+		if (! __vortex_thread_pool_event_before (event, pool->events[parent]))
 			break;
-		}
+		__vortex_thread_pool_event_place (pool, pool->events[parent], index);
+		index = parent;
+	} /* end while */
+
+	/* down */
+	while ((child = index * 2 + 1) < pool->events_num) {
+		if ((child + 1) < pool->events_num && __vortex_thread_pool_event_before (pool->events[child + 1], pool->events[child]))
+			child++;
+		if (! __vortex_thread_pool_event_before (pool->events[child], event))
+			break;
+		__vortex_thread_pool_event_place (pool, pool->events[child], index);
+		index = child;
+	} /* end while */
 
-		/* increase ref count now we have the look */
-		event->ref_count++;
+	__vortex_thread_pool_event_place (pool, event, index);
+	return;
+}
 
-		/* get stamp */
-		if ((now.tv_sec > event->next_step.tv_sec) ||
-		    ((now.tv_sec == event->next_step.tv_sec) &&
-		     (now.tv_usec >= event->next_step.tv_usec))) {
+/** 
+ * @internal Adds the event into the heap (events_mutex acquired).
+ */
+axl_bool __vortex_thread_pool_event_push (VortexThreadPool * pool, VortexThreadPoolEvent * event)
+{
+	VortexThreadPoolEvent ** events;
+
+	if (pool->events_num == pool->events_size) {
+		events = axl_realloc (pool->events, sizeof (VortexThreadPoolEvent *) * (pool->events_size > 0 ? pool->events_size * 2 : 64));
+		if (events == NULL)
+			return axl_false;
+		pool->events       = events;
+		pool->events_size  = pool->events_size > 0 ? pool->events_size * 2 : 64;
+	} /* end if */
 
-			func  = event->func;
-			data  = event->data;
-			data2 = event->data2;
+	__vortex_thread_pool_event_place (pool, event, pool->events_num);
+	pool->events_num++;
+	__vortex_thread_pool_event_sift (pool, event->heap_index);
+	return axl_true;
+}
 
-			/* unlock before calling */
-			vortex_mutex_unlock (&pool->mutex);
+/** 
+ * @internal Removes the event at the provided heap position
+ * (events_mutex acquired).
+ */
+void __vortex_thread_pool_event_remove_at (VortexThreadPool * pool, int index)
+{
+	VortexThreadPoolEvent * event = pool->events[index];
 
-			/* call to notify event */
-			if (func (ctx, data, data2)) {
-				vortex_mutex_lock (&pool->mutex);
+	pool->events_num--;
+	if (index != pool->events_num) {
+		__vortex_thread_pool_event_place (pool, pool->events[pool->events_num], index);
+		__vortex_thread_pool_event_sift (pool, index);
+	} /* end if */
+	event->heap_index = -1;
+	return;
+}
 
-				/* remove event using the pointer not
-				 * the position because it may be
-				 * pointing to a different location
-				 * (i.e: someone removed or added an
-				 * event durint the last func()
-				 * call) */
-				axl_list_remove_ptr (pool->events, event);
+/** 
+ * @internal Releases all events installed.
+ */
+void __vortex_thread_pool_events_release (VortexThreadPool * pool)
+{
+	while (pool->events_num > 0) 
+		axl_free (pool->events[--pool->events_num]);
+	axl_free (pool->events);
+	pool->events      = NULL;
+	pool->events_size = 0;
+	axl_hash_free (pool->events_by_id);
+	pool->events_by_id = NULL;
+	return;
+}
 
-				/* decrease local reference */
-				__vortex_thread_pool_unref_event (event);
+/** 
+ * @internal Thread that runs events installed: it sleeps until the
+ * next event expires (or a new event is installed before it), so no
+ * periodic scan is done. Event handlers are called, one at a time,
+ * without holding events_mutex.
+ */
+axlPointer __vortex_thread_pool_events_dispatcher (VortexThreadPool * pool)
+{
+	VortexCtx             * ctx = pool->ctx;
+	VortexThreadPoolEvent * event;
+	struct timeval          now;
+	struct timeval          diff;
+	long                    microseconds;
+	axl_bool                remove;
+
+	vortex_mutex_lock (&pool->events_mutex);
+	while (! pool->events_stop) {
+		/* no event, wait for one to be installed */
+		if (pool->events_num == 0) {
+			vortex_cond_wait (&pool->events_cond, &pool->events_mutex);
+			continue;
+		} /* end if */
 
-				vortex_mutex_unlock (&pool->mutex);
+		/* wait until next event expires (waking up at least
+		 * once a minute) */
+		event = pool->events[0];
+		gettimeofday (&now, NULL);
+		if ((now.tv_sec < event->next_step.tv_sec) ||
+		    ((now.tv_sec == event->next_step.tv_sec) && (now.tv_usec < event->next_step.tv_usec))) {
+			vortex_timeval_substract (&event->next_step, &now, &diff);
+			microseconds = diff.tv_sec >= 60 ? 60000000 : (diff.tv_sec * 1000000 + diff.tv_usec);
+			vortex_cond_timedwait (&pool->events_cond, &pool->events_mutex, microseconds);
+			continue;
+		} /* end if */
 
-				/* don't update iterator to manage next position */
-				continue;
-			}
+		/* event expired, remove it from the heap while its
+		 * handler runs */
+		__vortex_thread_pool_event_remove_at (pool, 0);
+		vortex_mutex_unlock (&pool->events_mutex);
+
+		/* call to notify event (keep it while exiting) */
+		remove = vortex_is_exiting (ctx) ? axl_false : event->func (ctx, event->data, event->data2);
+
+		vortex_mutex_lock (&pool->events_mutex);
+		if (remove || event->removed) {
+			/* event removed by the handler or by
+			 * vortex_thread_pool_remove_event */
+			if (! event->removed)
+				axl_hash_remove (pool->events_by_id, INT_TO_PTR (event->id));
+			axl_free (event);
+			continue;
+		} /* end if */
 
-			/* now recalculate event to be executed in the
-			 * future (because the user did selected to
-			 * keep it) */
-			vortex_mutex_lock (&pool->mutex);
-			__vortex_thread_pool_increase_stamp (event);
-			
+		/* now recalculate event to be executed in the future
+		 * (because the user did selected to keep it) */
+		__vortex_thread_pool_increase_stamp (event);
+		if (! __vortex_thread_pool_event_push (pool, event)) {
+			axl_hash_remove (pool->events_by_id, INT_TO_PTR (event->id));
+			axl_free (event);
 		} /* end if */
+	} /* end while */
+	vortex_mutex_unlock (&pool->events_mutex);
 
-		/* decrease local reference */
-		__vortex_thread_pool_unref_event (event);
+	return NULL;
+}
 
-		/* unlock for the next lock */
-		vortex_mutex_unlock (&pool->mutex);
+/** 
+ * @internal Starts the events thread.
+ */
+void __vortex_thread_pool_events_start (VortexCtx * ctx, VortexThreadPool * pool)
+{
+	vortex_mutex_create (&pool->events_mutex);
+	vortex_cond_create (&pool->events_cond);
+	pool->events_by_id   = axl_hash_new (axl_hash_int, axl_hash_equal_int);
+	pool->events_next_id = 1;
+	pool->events_stop    = axl_false;
+
+	if (! vortex_thread_create (&pool->events_thread,
+				    (VortexThreadFunc) __vortex_thread_pool_events_dispatcher,
+				    pool,
+				    VORTEX_THREAD_CONF_END)) 
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to create thread pool events thread");
+	return;
+}
 
-		/* next position */
-		iterator++;
-	}
+/** 
+ * @internal Returns the number of threads waiting for tasks and the
+ * number of tasks pending to be processed, for both the shared queue
+ * and the work stealing mode.
+ */
+void __vortex_thread_pool_counters (VortexThreadPool * pool, int * waiting_threads, int * pending_tasks)
+{
+	VortexThreadPoolWorker * worker;
+	int                      iterator;
+	int                      workers_num;
 
-	/* flag that no more processing events */
-	vortex_mutex_lock (&pool->mutex);
-	pool->processing_events = axl_false;
-	vortex_mutex_unlock (&pool->mutex);
+	if (! pool->stealing) {
+		*waiting_threads = vortex_async_queue_waiters (pool->queue);
+		*pending_tasks   = vortex_async_queue_items (pool->queue);
+		return;
+	} /* end if */
+
+	*waiting_threads = vortex_atomic_get (&pool->idle);
+	*pending_tasks   = 0;
+	workers_num      = vortex_atomic_get (&pool->workers_num);
+	for (iterator = 0; iterator < workers_num; iterator++) {
+		worker = pool->workers[iterator];
+		vortex_mutex_lock (&worker->mutex);
+		(*pending_tasks) += worker->count;
+		vortex_mutex_unlock (&worker->mutex);
+	} /* end for */
 	return;
 }
 
@@ -254,8 +419,7 @@ void __vortex_thread_pool_automatic_resize (VortexCtx * ctx)
 	}
 
 	running_threads = axl_list_length (ctx->thread_pool->threads);
-	waiting_threads = vortex_async_queue_waiters (ctx->thread_pool->queue);
-	pending_tasks   = vortex_async_queue_items (ctx->thread_pool->queue);
+	__vortex_thread_pool_counters (ctx->thread_pool, &waiting_threads, &pending_tasks);
 
 	/* now get difference in diff */
 	gettimeofday (&now, NULL);
@@ -337,9 +501,6 @@ axlPointer __vortex_thread_pool_dispatcher (VortexThreadPoolStarter * _data)
 		task = vortex_async_queue_timedpop (queue, 100000);
 		
 		if (task == NULL) {
-			/* call to process events */
-			__vortex_thread_pool_process_events (ctx, pool);
-
 			/* do automatic reasize */
 			__vortex_thread_pool_automatic_resize (ctx);
 
@@ -406,9 +567,6 @@ axlPointer __vortex_thread_pool_dispatcher (VortexThreadPoolStarter * _data)
 		if (! ctx->thread_pool_being_stopped && ! ctx->vortex_exit) 
 			func (data);
 
-		/* call to process events after finishing tasks */
-		__vortex_thread_pool_process_events (ctx, pool);
-
 		/* do automatic reasize */
 		if (ctx && ctx->thread_pool && ! ctx->thread_pool->preemtive)
 			__vortex_thread_pool_automatic_resize (ctx);
@@ -422,6 +580,352 @@ axlPointer __vortex_thread_pool_dispatcher (VortexThreadPoolStarter * _data)
 	return NULL;
 }
 
+/** 
+ * @internal Queues a task into the provided worker ring, waking up
+ * the worker if it is sleeping.
+ *
+ * @return axl_true if the task was queued. The worker sleeping status
+ * (before queueing) is returned on was_sleeping. axl_false is
+ * returned if the worker was flagged to stop: it may have already
+ * moved its pending tasks to other workers.
+ */
+axl_bool __vortex_thread_pool_worker_push (VortexThreadPoolWorker * worker,
+					   VortexThreadFunc         func,
+					   axlPointer               data,
+					   axl_bool               * was_sleeping)
+{
+	VortexThreadPoolTask * tasks;
+	int                    size;
+	int                    iterator;
+
+	vortex_mutex_lock (&worker->mutex);
+
+	/* the worker may have been flagged to stop after being
+	 * selected (stop is only set with the mutex held) */
+	if (worker->stop) {
+		vortex_mutex_unlock (&worker->mutex);
+		return axl_false;
+	} /* end if */
+
+	/* grow the ring (unrolling pending tasks) if it is full */
+	if (worker->count == worker->size) {
+		size  = worker->size > 0 ? worker->size * 2 : 64;
+		tasks = axl_new (VortexThreadPoolTask, size);
+		if (tasks == NULL) {
+			vortex_mutex_unlock (&worker->mutex);
+			return axl_false;
+		} /* end if */
+		for (iterator = 0; iterator < worker->count; iterator++)
+			tasks[iterator] = worker->tasks[(worker->head + iterator) % worker->size];
+		axl_free (worker->tasks);
+		worker->tasks = tasks;
+		worker->size  = size;
+		worker->head  = 0;
+	} /* end if */
+
+	/* store the task */
+	tasks       = &worker->tasks[(worker->head + worker->count) % worker->size];
+	tasks->func = func;
+	tasks->data = data;
+	worker->count++;
+
+	/* wake up the worker */
+	(*was_sleeping) = worker->sleeping;
+	if (worker->sleeping) {
+		worker->wakeup = axl_true;
+		vortex_cond_signal (&worker->cond);
+	} /* end if */
+
+	vortex_mutex_unlock (&worker->mutex);
+	return axl_true;
+}
+
+/** 
+ * @internal Gets the oldest task queued on the provided worker (its
+ * own one or other worker's when stealing).
+ */
+axl_bool __vortex_thread_pool_worker_pop (VortexThreadPoolWorker * worker,
+					  VortexThreadPoolTask   * task)
+{
+	/* skip lock if nothing is queued */
+	if (vortex_atomic_get (&worker->count) == 0)
+		return axl_false;
+
+	vortex_mutex_lock (&worker->mutex);
+	if (worker->count == 0) {
+		vortex_mutex_unlock (&worker->mutex);
+		return axl_false;
+	} /* end if */
+
+	(*task)      = worker->tasks[worker->head];
+	worker->head = (worker->head + 1) % worker->size;
+	worker->count--;
+
+	vortex_mutex_unlock (&worker->mutex);
+	return axl_true;
+}
+
+/** 
+ * @internal Tries to steal a task from other workers (starting from
+ * the next one to the caller).
+ */
+axl_bool __vortex_thread_pool_worker_steal (VortexThreadPool       * pool,
+					    VortexThreadPoolWorker * worker,
+					    VortexThreadPoolTask   * task)
+{
+	int workers_num = vortex_atomic_get (&pool->workers_num);
+	int iterator;
+
+	for (iterator = 1; iterator < workers_num; iterator++) {
+		if (__vortex_thread_pool_worker_pop (pool->workers[(worker->index + iterator) % workers_num], task))
+			return axl_true;
+	} /* end for */
+
+	return axl_false;
+}
+
+/** 
+ * @internal Wakes up a sleeping worker (if any) so it can steal
+ * pending tasks.
+ */
+void __vortex_thread_pool_wake_one (VortexThreadPool * pool, int start)
+{
+	VortexThreadPoolWorker * worker;
+	int                      workers_num = vortex_atomic_get (&pool->workers_num);
+	int                      iterator;
+
+	for (iterator = 0; iterator < workers_num; iterator++) {
+		worker = pool->workers[(start + iterator) % workers_num];
+		if (! vortex_atomic_get (&worker->sleeping))
+			continue;
+
+		vortex_mutex_lock (&worker->mutex);
+		if (worker->sleeping) {
+			worker->wakeup = axl_true;
+			vortex_cond_signal (&worker->cond);
+			vortex_mutex_unlock (&worker->mutex);
+			return;
+		} /* end if */
+		vortex_mutex_unlock (&worker->mutex);
+	} /* end for */
+
+	return;
+}
+
+/** 
+ * @internal Queues a new task on the pool when work stealing is
+ * enabled: a sleeping worker is selected when available, otherwise
+ * tasks are spread among workers (round robin). If the selected
+ * worker is busy, a sleeping one is waked up to steal the task.
+ */
+axl_bool __vortex_thread_pool_stealing_push (VortexThreadPool * pool,
+					     VortexThreadFunc   func,
+					     axlPointer         data)
+{
+	VortexThreadPoolWorker * worker;
+	VortexThreadPoolWorker * target      = NULL;
+	int                      workers_num = vortex_atomic_get (&pool->workers_num);
+	int                      start;
+	int                      iterator;
+	axl_bool                 was_sleeping = axl_false;
+	axl_bool                 queued;
+
+	if (workers_num == 0)
+		return axl_false;
+	start = (int) (((unsigned int) vortex_atomic_add (&pool->next_worker, 1)) % workers_num);
+
+	/* prefer a sleeping worker so the task is started now */
+	if (vortex_atomic_get (&pool->idle) > 0) {
+		for (iterator = 0; iterator < workers_num; iterator++) {
+			worker = pool->workers[(start + iterator) % workers_num];
+			if (vortex_atomic_get (&worker->running) && ! vortex_atomic_get (&worker->stop) &&
+			    vortex_atomic_get (&worker->sleeping)) {
+				target = worker;
+				break;
+			} /* end if */
+		} /* end for */
+	} /* end if */
+
+	queued = target != NULL && __vortex_thread_pool_worker_push (target, func, data, &was_sleeping);
+
+	/* otherwise, next running worker (a worker flagged to stop
+	 * after being selected rejects the task, so the next one is
+	 * tried) */
+	for (iterator = 0; ! queued && iterator < workers_num; iterator++) {
+		worker = pool->workers[(start + iterator) % workers_num];
+		if (worker == target || ! vortex_atomic_get (&worker->running) || vortex_atomic_get (&worker->stop))
+			continue;
+		if (__vortex_thread_pool_worker_push (worker, func, data, &was_sleeping)) {
+			target = worker;
+			queued = axl_true;
+		} /* end if */
+	} /* end for */
+
+	if (! queued)
+		return axl_false;
+
+	/* the worker selected is busy, wake up a sleeping one to
+	 * steal the task */
+	if (! was_sleeping && vortex_atomic_get (&pool->idle) > 0)
+		__vortex_thread_pool_wake_one (pool, target->index + 1);
+
+	return axl_true;
+}
+
+/** 
+ * @internal Task used to release threads removed from the pool when
+ * work stealing is enabled (see beacon 3 on the shared queue mode).
+ */
+axlPointer __vortex_thread_pool_collect_stopped (VortexThreadPool * pool)
+{
+	vortex_mutex_lock (&pool->stopped_mutex);
+	axl_list_remove_first (pool->stopped);
+	vortex_mutex_unlock (&pool->stopped_mutex);
+	return NULL;
+}
+
+/** 
+ * @internal Binds the calling worker thread to a CPU (see
+ * VORTEX_THREAD_POOL_CPU_AFFINITY).
+ */
+void __vortex_thread_pool_worker_set_affinity (VortexThreadPoolWorker * worker)
+{
+#if defined(AXL_OS_UNIX) && defined(__linux__)
+	VortexCtx * ctx     = worker->pool->ctx;
+	long        cpu_num = sysconf (_SC_NPROCESSORS_ONLN);
+	cpu_set_t   cpus;
+
+	if (cpu_num <= 0)
+		return;
+	CPU_ZERO (&cpus);
+	CPU_SET (worker->index % cpu_num, &cpus);
+	if (pthread_setaffinity_np (pthread_self (), sizeof (cpu_set_t), &cpus) != 0)
+		vortex_log (VORTEX_LEVEL_WARNING, "unable to bind thread pool worker %d to cpu %ld", 
+			    worker->index, worker->index % cpu_num);
+#elif defined(AXL_OS_WIN32)
+	SYSTEM_INFO info;
+
+	GetSystemInfo (&info);
+	if (info.dwNumberOfProcessors > 0)
+		SetThreadAffinityMask (GetCurrentThread (), ((DWORD_PTR) 1) << (worker->index % info.dwNumberOfProcessors));
+#endif
+	return;
+}
+
+/** 
+ * @internal Work stealing version of the thread pool dispatcher: it
+ * runs tasks queued on its own ring, or stolen from other workers,
+ * sleeping (up to 100ms, as done with the shared queue, to check
+ * automatic resize) when no task is found.
+ */
+axlPointer __vortex_thread_pool_worker_dispatcher (VortexThreadPoolWorker * worker)
+{
+	VortexThreadPool     * pool   = worker->pool;
+	VortexCtx            * ctx    = pool->ctx;
+	VortexThreadPoolTask   task;
+	axl_bool               found;
+	struct timeval         now;
+	struct timeval         diff;
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "thread from pool started (work stealing, worker=%d)", worker->index);
+
+	if (pool->cpu_affinity)
+		__vortex_thread_pool_worker_set_affinity (worker);
+
+	while (! vortex_atomic_get (&worker->stop) && ! ctx->thread_pool_being_stopped) {
+
+		/* get next task: own ring first, then steal */
+		found = __vortex_thread_pool_worker_pop (worker, &task) || 
+			__vortex_thread_pool_worker_steal (pool, worker, &task);
+
+		if (! found) {
+			/* flag sleeping before checking again so a
+			 * task queued on a busy worker meanwhile
+			 * wakes us up */
+			vortex_mutex_lock (&worker->mutex);
+			worker->sleeping = axl_true;
+			vortex_mutex_unlock (&worker->mutex);
+			vortex_atomic_add (&pool->idle, 1);
+
+			found = __vortex_thread_pool_worker_steal (pool, worker, &task);
+			if (! found) {
+				vortex_mutex_lock (&worker->mutex);
+				if (! worker->wakeup && worker->count == 0 && ! worker->stop && ! ctx->thread_pool_being_stopped)
+					vortex_cond_timedwait (&worker->cond, &worker->mutex, 100000);
+				worker->wakeup = axl_false;
+				vortex_mutex_unlock (&worker->mutex);
+			} /* end if */
+
+			vortex_mutex_lock (&worker->mutex);
+			worker->sleeping = axl_false;
+			vortex_mutex_unlock (&worker->mutex);
+			vortex_atomic_add (&pool->idle, -1);
+
+			if (! found) {
+				/* do automatic reasize */
+				__vortex_thread_pool_automatic_resize (ctx);
+				gettimeofday (&worker->last_check, NULL);
+				continue;
+			} /* end if */
+		} /* end if */
+
+		/* do automatic reasize (preemtive) */
+		if (pool->preemtive)
+			__vortex_thread_pool_automatic_resize (ctx);
+
+		/* at this point we already are executing inside a thread */
+		if (! ctx->thread_pool_being_stopped && ! ctx->vortex_exit) 
+			task.func (task.data);
+
+		/* check resize after finishing tasks, but not more
+		 * than once every 10ms to avoid locking the pool after
+		 * each task */
+		gettimeofday (&now, NULL);
+		vortex_timeval_substract (&now, &worker->last_check, &diff);
+		if (diff.tv_sec > 0 || diff.tv_usec >= 10000) {
+			if (! pool->preemtive)
+				__vortex_thread_pool_automatic_resize (ctx);
+			worker->last_check = now;
+		} /* end if */
+	} /* end while */
+
+	/* pool stopped, finish */
+	if (ctx->thread_pool_being_stopped) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "--> thread from pool stoping, found finish beacon");
+		vortex_ctx_unref2 (&ctx, "end pool dispatcher");
+		return NULL;
+	} /* end if */
+
+	/* thread removed from the pool: move pending tasks to other
+	 * workers */
+	vortex_log (VORTEX_LEVEL_DEBUG, "--> thread from pool stoping, found thread stop beacon");
+	while (__vortex_thread_pool_worker_pop (worker, &task)) {
+		if (! __vortex_thread_pool_stealing_push (pool, task.func, task.data)) {
+			/* no other worker available, run it */
+			task.func (task.data);
+		} /* end if */
+	} /* end while */
+
+	vortex_mutex_lock (&pool->stopped_mutex);
+
+	/* remove thread from the pool */
+	vortex_mutex_lock (&pool->mutex);
+	axl_list_unlink_ptr (pool->threads, worker->thread);
+	vortex_mutex_unlock (&pool->mutex);
+
+	axl_list_append (pool->stopped, worker->thread);
+	vortex_mutex_unlock (&pool->stopped_mutex);
+
+	/* release the thread from other worker */
+	__vortex_thread_pool_stealing_push (pool, (VortexThreadFunc) __vortex_thread_pool_collect_stopped, pool);
+
+	/* release the slot */
+	vortex_atomic_compare_and_swap (&worker->running, 1, 0);
+
+	vortex_ctx_unref2 (&ctx, "end pool dispatcher");
+	return NULL;
+}
+
 /** 
  * @internal Function that terminates the thread and deallocates the
  * memory hold by the thread.
@@ -455,17 +959,6 @@ void __vortex_thread_pool_terminate_thread (axlPointer _thread)
  * @{
  */
 
-int  __vortex_thread_pool_soon_events_first (axlPointer a, axlPointer b)
-{
-	VortexThreadPoolEvent * event_a = a;
-	VortexThreadPoolEvent * event_b = a;
-
-	/* first a if microseconds is sort */
-	if (event_a->delay < event_b->delay)
-		return -1;
-	return 1;
-}
-
 /**
  * @brief Init the Vortex Thread Pool subsystem.
  * 
@@ -488,7 +981,10 @@ void vortex_thread_pool_init     (VortexCtx * ctx,
 				  int         max_threads)
 {
 	/* get current context */
-	VortexThread * thread;
+	VortexThread           * thread;
+	VortexThreadPoolWorker * worker;
+	int                      iterator;
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "creating thread pool threads=%d", max_threads);
 
 	/* create the thread pool and its internal values */
@@ -508,17 +1004,37 @@ void vortex_thread_pool_init     (VortexCtx * ctx,
 			axl_free (thread);
 		} /* end while */
 		axl_list_free (ctx->thread_pool->threads);
-		axl_list_free (ctx->thread_pool->events);
-		axl_list_cursor_free (ctx->thread_pool->events_cursor);
 		axl_list_free (ctx->thread_pool->stopped);
+
+		/* drop events installed (the events thread is not
+		 * running anymore) */
+		__vortex_thread_pool_events_release (ctx->thread_pool);
+
+		/* reset worker slots (tasks queued are dropped, as
+		 * done with the queue) */
+		for (iterator = 0; iterator < ctx->thread_pool->workers_num; iterator++) {
+			worker = ctx->thread_pool->workers[iterator];
+			vortex_mutex_create (&worker->mutex);
+			vortex_cond_create (&worker->cond);
+			worker->head     = 0;
+			worker->count    = 0;
+			worker->sleeping = axl_false;
+			worker->running  = axl_false;
+		} /* end for */
+		ctx->thread_pool->idle = 0;
 	} /* end if */
 
 	ctx->thread_pool->threads       = axl_list_new (axl_list_always_return_1, __vortex_thread_pool_terminate_thread);
 	ctx->thread_pool->stopped       = axl_list_new (axl_list_always_return_1, __vortex_thread_pool_terminate_thread);
-	ctx->thread_pool->events        = axl_list_new (__vortex_thread_pool_soon_events_first, __vortex_thread_pool_unref_event);
-	ctx->thread_pool->events_cursor = axl_list_cursor_new (ctx->thread_pool->events);
 	ctx->thread_pool->ctx           = ctx;
 
+	/* configure work stealing (worker slots are kept if the pool
+	 * is initialized again) */
+	ctx->thread_pool->stealing      = ctx->thread_pool_work_stealing;
+	ctx->thread_pool->cpu_affinity  = ctx->thread_pool_cpu_affinity;
+	if (ctx->thread_pool->stealing && ctx->thread_pool->workers == NULL) 
+		ctx->thread_pool->workers = axl_new (VortexThreadPoolWorker *, VORTEX_THREAD_POOL_MAX_WORKERS);
+
 	/* init the queue */
 	if (ctx->thread_pool->queue != NULL)
 		vortex_async_queue_release (ctx->thread_pool->queue);
@@ -527,6 +1043,9 @@ void vortex_thread_pool_init     (VortexCtx * ctx,
 	/* init mutex */
 	vortex_mutex_create (&(ctx->thread_pool->mutex));
 	vortex_mutex_create (&(ctx->thread_pool->stopped_mutex));
+
+	/* start events thread */
+	__vortex_thread_pool_events_start (ctx, ctx->thread_pool);
 	
 	/* init all threads required */
 	vortex_thread_pool_add (ctx, max_threads);
@@ -635,6 +1154,83 @@ void vortex_thread_pool_setup2              (VortexCtx * ctx,
 	return;
 }
 
+/** 
+ * @internal Starts the provided thread on a free worker slot (work
+ * stealing mode). Called with the pool mutex acquired.
+ */
+axl_bool __vortex_thread_pool_add_worker (VortexCtx * ctx, VortexThread * thread)
+{
+	VortexThreadPool       * pool   = ctx->thread_pool;
+	VortexThreadPoolWorker * worker = NULL;
+	VortexCtx              * local_ctx;
+	int                      iterator;
+
+	/* reuse a slot released by a thread removed */
+	for (iterator = 0; iterator < pool->workers_num; iterator++) {
+		if (! vortex_atomic_get (&pool->workers[iterator]->running)) {
+			worker = pool->workers[iterator];
+			break;
+		} /* end if */
+	} /* end for */
+
+	/* or create a new one */
+	if (worker == NULL) {
+		if (pool->workers_num == VORTEX_THREAD_POOL_MAX_WORKERS) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to add more threads to the pool, max limit %d reached",
+				    VORTEX_THREAD_POOL_MAX_WORKERS);
+			axl_free (thread);
+			return axl_false;
+		} /* end if */
+		worker = axl_new (VortexThreadPoolWorker, 1);
+		if (worker == NULL) {
+			axl_free (thread);
+			return axl_false;
+		} /* end if */
+		worker->index = pool->workers_num;
+		worker->pool  = pool;
+		vortex_mutex_create (&worker->mutex);
+		vortex_cond_create (&worker->cond);
+
+		/* publish the slot */
+		pool->workers[pool->workers_num] = worker;
+		vortex_atomic_add (&pool->workers_num, 1);
+	} /* end if */
+
+	/* configure the slot */
+	vortex_mutex_lock (&worker->mutex);
+	worker->thread = thread;
+	worker->stop   = axl_false;
+	worker->wakeup = axl_false;
+	vortex_mutex_unlock (&worker->mutex);
+	vortex_atomic_add (&worker->running, 1);
+
+	/* acquire a reference to the context */
+	vortex_ctx_ref2 (ctx, "begin pool dispatcher");
+
+	if (! vortex_thread_create (thread,
+				    /* function to execute */
+				    (VortexThreadFunc)__vortex_thread_pool_worker_dispatcher,
+				    /* the worker slot */
+				    worker,
+				    /* finish thread configuration */
+				    VORTEX_THREAD_CONF_END)) {
+		/* release the slot */
+		vortex_atomic_add (&worker->running, -1);
+
+		/* failed, release ctx */
+		local_ctx = ctx;
+		vortex_ctx_unref2 (&local_ctx, "(failed) begin pool dispatcher");
+
+		/* free the reference */
+		vortex_thread_destroy (thread, axl_true);
+
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to create a thread required for the pool");
+		return axl_false;
+	} /* end if */
+
+	return axl_true;
+}
+
 /** 
  * @internal Unlocked thread add implementation.
  *
@@ -670,6 +1266,18 @@ void vortex_thread_pool_add_internal                 (VortexCtx        * ctx,
 		starter->thread = thread;
 		starter->pool   = ctx->thread_pool;
 
+		/* work stealing: run the thread on a worker slot */
+		if (ctx->thread_pool->stealing) {
+			axl_free (starter);
+			if (! __vortex_thread_pool_add_worker (ctx, thread)) 
+				break;
+
+			/* store the thread reference */
+			axl_list_add (ctx->thread_pool->threads, thread);
+			iterator++;
+			continue;
+		} /* end if */
+
 		/* update the reference counting for this thread to
 		 * the queue */
 		if (! vortex_async_queue_ref (ctx->thread_pool->queue)) {
@@ -755,11 +1363,38 @@ void vortex_thread_pool_add                 (VortexCtx        * ctx,
 void vortex_thread_pool_remove_internal        (VortexCtx        * ctx, 
 						int                threads)
 {
-	int threads_running;
+	VortexThreadPoolWorker * worker;
+	int                      threads_running;
+	int                      iterator;
+
 	if (ctx == NULL || threads <= 0)
 		return;
 
 	threads_running = axl_list_length (ctx->thread_pool->threads);
+
+	/* work stealing: flag the last workers running to stop */
+	if (ctx->thread_pool->stealing) {
+		iterator = ctx->thread_pool->workers_num - 1;
+		while (threads > 0 && threads_running > 1 && iterator >= 0) {
+			worker = ctx->thread_pool->workers[iterator];
+			iterator--;
+
+			vortex_mutex_lock (&worker->mutex);
+			if (! vortex_atomic_get (&worker->running) || worker->stop) {
+				vortex_mutex_unlock (&worker->mutex);
+				continue;
+			} /* end if */
+			worker->stop   = axl_true;
+			worker->wakeup = axl_true;
+			vortex_cond_signal (&worker->cond);
+			vortex_mutex_unlock (&worker->mutex);
+
+			threads--;
+			threads_running--;
+		} /* end while */
+		return;
+	} /* end if */
+
 	while (threads > 0 && threads_running > 1) {
 		/* push a task to stop one thread */
 		vortex_async_queue_push (ctx->thread_pool->queue, INT_TO_PTR (2));
@@ -807,8 +1442,9 @@ void vortex_thread_pool_remove        (VortexCtx        * ctx,
 void vortex_thread_pool_exit (VortexCtx * ctx) 
 {
 	/* get current context */
-	int             iterator;
-	VortexThread  * thread;
+	int                      iterator;
+	VortexThread           * thread;
+	VortexThreadPoolWorker * worker;
 
 	vortex_log (VORTEX_LEVEL_DEBUG, "stopping thread pool..");
 
@@ -817,9 +1453,25 @@ void vortex_thread_pool_exit (VortexCtx * ctx)
 	ctx->thread_pool_being_stopped = axl_true;
 	vortex_mutex_unlock (&ctx->thread_pool->mutex);
 
+	/* stop events thread */
+	vortex_mutex_lock (&ctx->thread_pool->events_mutex);
+	ctx->thread_pool->events_stop = axl_true;
+	vortex_cond_signal (&ctx->thread_pool->events_cond);
+	vortex_mutex_unlock (&ctx->thread_pool->events_mutex);
+	vortex_thread_destroy (&ctx->thread_pool->events_thread, axl_false);
+
+	/* wake up work stealing workers to stop */
+	for (iterator = 0; iterator < ctx->thread_pool->workers_num; iterator++) {
+		worker = ctx->thread_pool->workers[iterator];
+		vortex_mutex_lock (&worker->mutex);
+		worker->wakeup = axl_true;
+		vortex_cond_signal (&worker->cond);
+		vortex_mutex_unlock (&worker->mutex);
+	} /* end for */
+
 	/* push beacons to notify eacy thread created to stop */
 	iterator = 0;
-	while (iterator < axl_list_length (ctx->thread_pool->threads)) {
+	while (! ctx->thread_pool->stealing && iterator < axl_list_length (ctx->thread_pool->threads)) {
 		vortex_log (VORTEX_LEVEL_DEBUG, "pushing beacon to stop thread from the pool..");
 		/* push a notifier */
 		vortex_async_queue_push (ctx->thread_pool->queue, INT_TO_PTR (1));
@@ -850,13 +1502,29 @@ void vortex_thread_pool_exit (VortexCtx * ctx)
 	} /* end if */
 
 	axl_list_free (ctx->thread_pool->threads);
-	axl_list_free (ctx->thread_pool->events);
-	axl_list_cursor_free (ctx->thread_pool->events_cursor);
 	axl_list_free (ctx->thread_pool->stopped);
 
+	/* release events */
+	__vortex_thread_pool_events_release (ctx->thread_pool);
+	vortex_mutex_destroy (&ctx->thread_pool->events_mutex);
+	vortex_cond_destroy (&ctx->thread_pool->events_cond);
+
 	/* unref the queue */
 	vortex_async_queue_unref (ctx->thread_pool->queue);
 
+	/* release worker slots (threads already finished unless
+	 * skip thread pool wait was configured: in such case slots
+	 * are not released because they may still be used) */
+	for (iterator = 0; ! ctx->skip_thread_pool_wait && iterator < ctx->thread_pool->workers_num; iterator++) {
+		worker = ctx->thread_pool->workers[iterator];
+		vortex_mutex_destroy (&worker->mutex);
+		vortex_cond_destroy (&worker->cond);
+		axl_free (worker->tasks);
+		axl_free (worker);
+	} /* end for */
+	if (! ctx->skip_thread_pool_wait)
+		axl_free (ctx->thread_pool->workers);
+
 	/* terminate mutex */
 	vortex_mutex_destroy (&ctx->thread_pool->mutex);
 	vortex_mutex_destroy (&(ctx->thread_pool->stopped_mutex));
@@ -901,30 +1569,42 @@ void vortex_thread_pool_being_closed        (VortexCtx * ctx)
  * @param func the function to execute.
  * @param data the data to be passed in to the function.
  *
- * 
+ * @return axl_true if the task was queued, otherwise axl_false is
+ * returned (for example, because the thread pool is being stopped)
+ * and the caller must release the data provided.
  **/
-void vortex_thread_pool_new_task (VortexCtx * ctx, VortexThreadFunc func, axlPointer data)
+axl_bool vortex_thread_pool_new_task (VortexCtx * ctx, VortexThreadFunc func, axlPointer data)
 {
 	/* get current context */
 	VortexThreadPoolTask * task;
 
 	/* check parameters */
 	if (func == NULL || ctx == NULL || ctx->thread_pool == NULL || ctx->thread_pool_being_stopped)
-		return;
+		return axl_false;
+
+	/* work stealing: queue the task on a worker (no allocation
+	 * required) */
+	if (ctx->thread_pool->stealing) {
+		if (! __vortex_thread_pool_stealing_push (ctx->thread_pool, func, data)) {
+			vortex_log (VORTEX_LEVEL_CRITICAL, "unable to queue task on the thread pool");
+			return axl_false;
+		} /* end if */
+		return axl_true;
+	} /* end if */
 
 	/* create the task data */
 	task       = malloc (sizeof (VortexThreadPoolTask));
 
 	/* check allocated result */
 	if (task == NULL)
-		return;
+		return axl_false;
 	task->func = func;
 	task->data = data;
 
 	/* queue the task for the next available thread */
 	vortex_async_queue_push (ctx->thread_pool->queue, task);
 
-	return;
+	return axl_true;
 }
 
 /** 
@@ -939,9 +1619,9 @@ void vortex_thread_pool_new_task (VortexCtx * ctx, VortexThreadFunc func, axlPoi
  *
  * Note that events installed on this function must be tasks that
  * aren't loops or takes too long to complete. This is because the
- * thread pool asigns one thread to check and execute pending events,
- * so, if one of those events delays, the rest won't be executed until
- * the former finishes. In the case you want to install a loop handler
+ * thread pool has one thread (that sleeps until the next event
+ * expires) to execute pending events, so, if one of those events
+ * delays, the rest won't be executed until the former finishes. In the case you want to install a loop handler
  * or some handler that executes a long running code, then use \ref
  * vortex_thread_pool_new_task.
  *
@@ -979,35 +1659,42 @@ int  vortex_thread_pool_new_event           (VortexCtx              * ctx,
 	if (event_handler == NULL || ctx == NULL || ctx->thread_pool == NULL || ctx->thread_pool_being_stopped)
 		return -1;
 
-	/* lock the thread pool */
-	vortex_mutex_lock (&(ctx->thread_pool->mutex));
-
 	/* create the event data */
-	event            = axl_new (VortexThreadPoolEvent, 1);
-	/* check alloc result */
-	if (event) {
-		event->func      = event_handler;
-		event->ref_count = 1;
-		event->data      = user_data;
-		event->data2     = user_data2;
-		event->delay     = microseconds;
-		gettimeofday (&event->next_step, NULL);
-
-		/* update next step to the appropiate value */
-		__vortex_thread_pool_increase_stamp (event);
-
-		/* add into the event event */
-		axl_list_add (ctx->thread_pool->events, event);
+	event = axl_new (VortexThreadPoolEvent, 1);
+	if (event == NULL)
+		return -1;
+	event->func      = event_handler;
+	event->data      = user_data;
+	event->data2     = user_data2;
+	event->delay     = microseconds;
+	gettimeofday (&event->next_step, NULL);
+
+	/* update next step to the appropiate value */
+	__vortex_thread_pool_increase_stamp (event);
+
+	/* lock events */
+	vortex_mutex_lock (&(ctx->thread_pool->events_mutex));
+
+	/* add the event, getting a free id */
+	while (ctx->thread_pool->events_next_id <= 0 || 
+	       axl_hash_get (ctx->thread_pool->events_by_id, INT_TO_PTR (ctx->thread_pool->events_next_id))) 
+		ctx->thread_pool->events_next_id = ctx->thread_pool->events_next_id <= 0 ? 1 : ctx->thread_pool->events_next_id + 1;
+	event->id = ctx->thread_pool->events_next_id++;
+	if (! __vortex_thread_pool_event_push (ctx->thread_pool, event)) {
+		vortex_mutex_unlock (&(ctx->thread_pool->events_mutex));
+		axl_free (event);
+		return -1;
 	} /* end if */
+	axl_hash_insert (ctx->thread_pool->events_by_id, INT_TO_PTR (event->id), event);
 
-	/* (un)lock the thread pool */
-	vortex_mutex_unlock (&(ctx->thread_pool->mutex));
+	/* wake up events thread if this is the next event to expire */
+	if (event->heap_index == 0)
+		vortex_cond_signal (&(ctx->thread_pool->events_cond));
 
-	/* in case of failure */
-	if (event == NULL)
-		return PTR_TO_INT (-1);
-	
-	return PTR_TO_INT (event);
+	/* (un)lock events */
+	vortex_mutex_unlock (&(ctx->thread_pool->events_mutex));
+
+	return event->id;
 }
 
 /** 
@@ -1032,36 +1719,32 @@ axl_bool vortex_thread_pool_remove_event        (VortexCtx              * ctx,
 
 	/* v_return_val_if_fail (ctx, axl_false); */
 
-	/* lock the thread pool */
-	vortex_mutex_lock (&(ctx->thread_pool->mutex));
-
-	/* reset cursor list */
-	axl_list_cursor_first (ctx->thread_pool->events_cursor);
-	while (axl_list_cursor_has_item (ctx->thread_pool->events_cursor)) {
-
-		/* get event at the current position */
-		event = axl_list_cursor_get (ctx->thread_pool->events_cursor);
-
-		if (PTR_TO_INT (event) == event_id) {
-			/* found event to remove */
-			axl_list_cursor_remove (ctx->thread_pool->events_cursor);
+	/* lock events */
+	vortex_mutex_lock (&(ctx->thread_pool->events_mutex));
 
-			vortex_log (VORTEX_LEVEL_DEBUG, "Removing event id %d, total events registered after removal: %d",
-				    event_id, axl_list_length (ctx->thread_pool->events));
-
-			/* unlock the thread pool */
-			vortex_mutex_unlock (&(ctx->thread_pool->mutex));
+	/* find the event */
+	event = axl_hash_get (ctx->thread_pool->events_by_id, INT_TO_PTR (event_id));
+	if (event == NULL) {
+		vortex_mutex_unlock (&(ctx->thread_pool->events_mutex));
+		return axl_false; /* not removed */
+	} /* end if */
+	axl_hash_remove (ctx->thread_pool->events_by_id, INT_TO_PTR (event_id));
 
-			return axl_true; /* event removed */
-		} /* end if */
-		
-		/* next position */
-		axl_list_cursor_next (ctx->thread_pool->events_cursor);
+	if (event->heap_index >= 0) {
+		/* remove from the heap */
+		__vortex_thread_pool_event_remove_at (ctx->thread_pool, event->heap_index);
+		axl_free (event);
+	} else {
+		/* handler running: the events thread will release it */
+		event->removed = axl_true;
 	} /* end if */
 
-	/* unlock the thread pool */
-	vortex_mutex_unlock (&(ctx->thread_pool->mutex));
-	return axl_false; /* not removed */
+	vortex_log (VORTEX_LEVEL_DEBUG, "Removing event id %d, total events registered after removal: %d",
+		    event_id, axl_hash_items (ctx->thread_pool->events_by_id));
+
+	/* unlock events */
+	vortex_mutex_unlock (&(ctx->thread_pool->events_mutex));
+	return axl_true; /* event removed */
 }
 
 /** 
@@ -1089,6 +1772,9 @@ void vortex_thread_pool_stats               (VortexCtx        * ctx,
 					     int              * waiting_threads,
 					     int              * pending_tasks)
 {
+	int waiting;
+	int pending;
+
 	/* clear variables received */
 	if (running_threads)
 		*running_threads = 0;
@@ -1104,12 +1790,13 @@ void vortex_thread_pool_stats               (VortexCtx        * ctx,
 	vortex_mutex_lock (&(ctx->thread_pool->mutex));
 
 	/* update values */
+	__vortex_thread_pool_counters (ctx->thread_pool, &waiting, &pending);
 	if (running_threads)
 		*running_threads = axl_list_length (ctx->thread_pool->threads);
 	if (waiting_threads)
-		*waiting_threads = vortex_async_queue_waiters (ctx->thread_pool->queue);
+		*waiting_threads = waiting;
 	if (pending_tasks)
-		*pending_tasks = vortex_async_queue_items (ctx->thread_pool->queue);
+		*pending_tasks = pending;
 
 	/* lock the thread pool */
 	vortex_mutex_unlock (&(ctx->thread_pool->mutex));
@@ -1131,15 +1818,15 @@ void vortex_thread_pool_event_stats         (VortexCtx        * ctx,
 	if (ctx == NULL)
 		return;
 
-	/* lock the thread pool */
-	vortex_mutex_lock (&(ctx->thread_pool->mutex));
+	/* lock events */
+	vortex_mutex_lock (&(ctx->thread_pool->events_mutex));
 
 	/* update values */
 	if (events_installed)
-		*events_installed = axl_list_length (ctx->thread_pool->events);
+		*events_installed = axl_hash_items (ctx->thread_pool->events_by_id);
 
-	/* lock the thread pool */
-	vortex_mutex_unlock (&(ctx->thread_pool->mutex));
+	/* unlock events */
+	vortex_mutex_unlock (&(ctx->thread_pool->events_mutex));
 	
 	return;
 }
@@ -69,7 +69,7 @@ void vortex_thread_pool_exit                (VortexCtx * ctx);
 
 void vortex_thread_pool_being_closed        (VortexCtx * ctx);
 
-void vortex_thread_pool_new_task            (VortexCtx        * ctx,
+axl_bool vortex_thread_pool_new_task        (VortexCtx        * ctx,
 					     VortexThreadFunc   func, 
 					     axlPointer         data);
 
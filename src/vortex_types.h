@@ -307,7 +307,15 @@ typedef enum {
 	 * is being requested for its availability to perform a write
 	 * operation on them.
 	 */
-	WRITE_OPERATIONS = 1 << 1
+	WRITE_OPERATIONS = 1 << 1,
+	/** 
+	 * @brief Flag that can be combined with \ref READ_OPERATIONS
+	 * or \ref WRITE_OPERATIONS on a wait operation to request it
+	 * to check socket descriptors ready without blocking (zero
+	 * timeout). Wait handlers not supporting it just perform
+	 * their usual wait.
+	 */
+	NO_WAIT_OPERATIONS = 1 << 2
 } VortexIoWaitingFor;
 
 /**
@@ -822,10 +830,44 @@ typedef struct _VortexSequencerData {
 	 * should have all of them the more flag enabled.
 	 */
 	axl_bool              fixed_more;
+
+	/** 
+	 * @brief Signals that \ref VortexSequencerData.message is a
+	 * reference to the caller buffer rather than a copy (see
+	 * \ref vortex_channel_send_msg_nocopy). In such case, MIME
+	 * headers are kept apart at \ref VortexSequencerData.mime_headers
+	 * and the payload is made of both pieces.
+	 */
+	axl_bool              no_copy;
+
+	/** 
+	 * @brief Optional handler called to release the caller
+	 * buffer once it is no longer required (only used when
+	 * no_copy is enabled).
+	 */
+	axlDestroyFunc        release;
+
+	/** 
+	 * @brief MIME headers to be sent before the caller buffer
+	 * (only used when no_copy is enabled).
+	 */
+	char                * mime_headers;
+
+	/** 
+	 * @brief Size of the MIME headers hold by mime_headers.
+	 */
+	int                   mime_headers_size;
 } VortexSequencerData;
 
 
 
+/** 
+ * @internal Max number of pieces a frame can be made of when it is
+ * sent without copying its payload (header, MIME headers, payload
+ * and trailer).
+ */
+#define VORTEX_WRITER_MAX_PIECES 4
+
 /**
  * @internal
  *
@@ -846,6 +888,19 @@ typedef struct _VortexWriterData {
 	axl_bool          the_size;
 	axl_bool          is_complete;
 	axl_bool          fixed_more;
+	/* optional list of pieces that build up the frame (header,
+	 * payload and trailer) when it is sent without copying the
+	 * payload. If pieces_num is 0, the_frame holds the entire
+	 * frame */
+	int               pieces_num;
+	const char      * pieces[VORTEX_WRITER_MAX_PIECES];
+	int               pieces_size[VORTEX_WRITER_MAX_PIECES];
+	/* optional file holding the content of the piece file_piece
+	 * (starting at file_offset), so it can be sent with sendfile.
+	 * If file_piece is 0, no file is used */
+	int               file_piece;
+	int               file_fd;
+	long              file_offset;
 }VortexWriterData;
 
 /** 
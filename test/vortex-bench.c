@@ -0,0 +1,696 @@
+/*  LibVortex:  A BEEP implementation
+ *  Copyright (C) 2026 Advanced Software Production Line, S.L.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * vortex-bench: performance harness for the library. It runs an
+ * in-process listener and measures frame build, frame parse, MSG/RPY
+ * round trip latency, ANS streaming throughput and scaling with
+ * connections/channels. Results are written as JSON so they can be
+ * compared between releases.
+ *
+ * Usage: vortex-bench [--iterations N] [--payload-size N]
+ *                     [--ans-frames N] [--connections N]
+ *                     [--channels N] [--work-stealing]
+ *                     [--output file.json]
+ */
+
+#include <vortex.h>
+
+/* profile used by the bench listener: MSG are echoed as RPY, and
+ * MSG with "ans:<frames>:<size>" are replied with ANS/NUL */
+#define BENCH_URI "http://www.aspl.es/vortex/profiles/bench"
+
+/* max payload used by the frame parse bench: frames are pushed on
+ * channel 0 and must fit its initial window */
+#define BENCH_PARSE_MAX_PAYLOAD 4000
+
+/* bench configuration */
+int          bench_iterations      = 10000;
+int          bench_payload_size    = 256;
+int          bench_ans_frames      = 1000;
+int          bench_max_connections = 8;
+int          bench_max_channels    = 8;
+int          bench_work_stealing   = 0;
+
+/* listener and client contexts */
+VortexCtx        * listener_ctx = NULL;
+VortexCtx        * client_ctx   = NULL;
+VortexConnection * listener     = NULL;
+
+/* json output */
+FILE             * bench_output = NULL;
+axl_bool           bench_first  = axl_true;
+
+/**
+ * @internal Returns the time elapsed since start in microseconds.
+ */
+long bench_elapsed (struct timeval * start)
+{
+	struct timeval stop;
+	struct timeval result;
+
+	gettimeofday (&stop, NULL);
+	vortex_timeval_substract (&stop, start, &result);
+	return (result.tv_sec * 1000000) + result.tv_usec;
+}
+
+/**
+ * @internal Opens a new result object inside the results array.
+ */
+void bench_result_begin (const char * name, const char * transport)
+{
+	fprintf (bench_output, "%s\n    {\"name\": \"%s\", \"transport\": \"%s\"",
+		 bench_first ? "" : ",", name, transport);
+	bench_first = axl_false;
+	return;
+}
+
+/**
+ * @internal Writes the common ops/time fields and closes the result
+ * object.
+ */
+void bench_result_end (long ops, long usecs)
+{
+	if (usecs <= 0)
+		usecs = 1;
+	fprintf (bench_output, ", \"ops\": %ld, \"usecs\": %ld, \"ops_per_sec\": %.2f, \"ns_per_op\": %.2f}",
+		 ops, usecs, ((double) ops * 1000000) / usecs, ((double) usecs * 1000) / (ops > 0 ? ops : 1));
+	fflush (bench_output);
+	return;
+}
+
+/**
+ * @internal Allocates a payload of the provided size. The payload
+ * starts with an empty MIME header section so the receiving side
+ * parses it as a regular BEEP payload.
+ */
+char * bench_payload_new (int size)
+{
+	char * payload;
+
+	if (size < 2)
+		size = 2;
+	payload = axl_new (char, size + 1);
+	memset (payload, 'x', size);
+	payload[0] = '\r';
+	payload[1] = '\n';
+	return payload;
+}
+
+/**
+ * @internal Listener side frame received: echo MSG as RPY or stream
+ * ANS frames when requested.
+ */
+void bench_frame_received (VortexChannel    * channel,
+			   VortexConnection * connection,
+			   VortexFrame      * frame,
+			   axlPointer         user_data)
+{
+	const char * payload = vortex_frame_get_payload (frame);
+	char       * content;
+	int          frames  = 0;
+	int          size    = 0;
+	int          iterator;
+
+	if (vortex_frame_get_type (frame) != VORTEX_FRAME_TYPE_MSG)
+		return;
+
+	if (payload != NULL && axl_memcmp (payload, "ans:", 4)) {
+		/* stream the requested amount of ANS frames */
+		sscanf (payload + 4, "%d:%d", &frames, &size);
+		content = bench_payload_new (size);
+		for (iterator = 0; iterator < frames; iterator++) {
+			if (! vortex_channel_send_ans_rpy (channel, content, size, vortex_frame_get_msgno (frame))) {
+				fprintf (stderr, "ERROR: failed to send ANS frame %d..\n", iterator);
+				break;
+			} /* end if */
+		} /* end for */
+		vortex_channel_finalize_ans_rpy (channel, vortex_frame_get_msgno (frame));
+		axl_free (content);
+		return;
+	} /* end if */
+
+	/* echo */
+	vortex_channel_send_rpy (channel,
+				 vortex_frame_get_payload (frame),
+				 vortex_frame_get_payload_size (frame),
+				 vortex_frame_get_msgno (frame));
+	return;
+}
+
+/**
+ * @internal Creates a connected pair of sockets, either using
+ * socketpair (AF_UNIX) or a TCP loopback connection.
+ */
+axl_bool bench_socket_pair (axl_bool loopback, VORTEX_SOCKET * a, VORTEX_SOCKET * b)
+{
+	struct sockaddr_in addr;
+	VORTEX_SOCKET      server;
+#if defined(AXL_OS_WIN32)
+	int                addr_len = sizeof (addr);
+#else
+	socklen_t          addr_len = sizeof (addr);
+#endif
+#if defined(AXL_OS_UNIX)
+	int                pair[2];
+
+	if (! loopback) {
+		if (socketpair (AF_UNIX, SOCK_STREAM, 0, pair) != 0)
+			return axl_false;
+		(*a) = pair[0];
+		(*b) = pair[1];
+		return axl_true;
+	} /* end if */
+#else
+	if (! loopback)
+		return axl_false;
+#endif
+
+	server = socket (AF_INET, SOCK_STREAM, 0);
+	if (server == VORTEX_INVALID_SOCKET)
+		return axl_false;
+
+	memset (&addr, 0, sizeof (addr));
+	addr.sin_family      = AF_INET;
+	addr.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+	addr.sin_port        = 0;
+	if (bind (server, (struct sockaddr *) &addr, sizeof (addr)) != 0 ||
+	    listen (server, 1) != 0 ||
+	    getsockname (server, (struct sockaddr *) &addr, &addr_len) != 0) {
+		vortex_close_socket (server);
+		return axl_false;
+	} /* end if */
+
+	(*a) = socket (AF_INET, SOCK_STREAM, 0);
+	if (connect ((*a), (struct sockaddr *) &addr, sizeof (addr)) != 0) {
+		vortex_close_socket ((*a));
+		vortex_close_socket (server);
+		return axl_false;
+	} /* end if */
+	(*b) = vortex_listener_accept (server);
+	vortex_close_socket (server);
+
+	return (*b) != VORTEX_INVALID_SOCKET;
+}
+
+/**
+ * @internal Frame build bench: serializes MSG frames into a
+ * preallocated buffer.
+ */
+axl_bool bench_frame_build (void)
+{
+	char           * payload = bench_payload_new (bench_payload_size);
+	int              buffer_size = bench_payload_size + 128;
+	char           * buffer  = axl_new (char, buffer_size);
+	char           * result;
+	int              frame_size;
+	int              iterator;
+	struct timeval   start;
+
+	gettimeofday (&start, NULL);
+	for (iterator = 0; iterator < bench_iterations; iterator++) {
+		result = vortex_frame_build_up_from_params_s_buffer (VORTEX_FRAME_TYPE_MSG, 1, iterator, axl_false,
+								     (unsigned int) iterator * bench_payload_size,
+								     bench_payload_size, 0, NULL, NULL,
+								     payload, &frame_size, buffer, buffer_size);
+		if (result == NULL) {
+			fprintf (stderr, "ERROR: failed to build frame..\n");
+			return axl_false;
+		} /* end if */
+		if (result != buffer)
+			axl_free (result);
+	} /* end for */
+
+	bench_result_begin ("frame_build", "none");
+	fprintf (bench_output, ", \"payload_size\": %d, \"frame_size\": %d", bench_payload_size, frame_size);
+	bench_result_end (bench_iterations, bench_elapsed (&start));
+
+	axl_free (payload);
+	axl_free (buffer);
+	return axl_true;
+}
+
+/**
+ * @internal Frame parse bench: serialized frames are written into
+ * one end of a socket pair and parsed from the other end with
+ * vortex_frame_get_next through an empty connection (no greetings,
+ * not watched by the reader).
+ */
+axl_bool bench_frame_parse (axl_bool loopback)
+{
+	VORTEX_SOCKET      a, b;
+	VortexConnection * conn;
+	VortexFrame      * frame;
+	char             * payload;
+	char             * wire;
+	int                size = bench_payload_size;
+	int                wire_size;
+	int                batch;
+	int                iterator;
+	int                pending;
+	int                written;
+	int                parsed = 0;
+	struct timeval     start;
+	long               usecs  = 0;
+
+	if (! bench_socket_pair (loopback, &a, &b)) {
+		fprintf (stderr, "ERROR: unable to create %s socket pair..\n", loopback ? "loopback" : "socketpair");
+		return axl_false;
+	} /* end if */
+
+	/* frames are sent on channel 0 with seqno 0 so they always
+	 * fit the window */
+	if (size > BENCH_PARSE_MAX_PAYLOAD)
+		size = BENCH_PARSE_MAX_PAYLOAD;
+	payload = bench_payload_new (size);
+	wire    = vortex_frame_build_up_from_params_s (VORTEX_FRAME_TYPE_MSG, 0, 0, axl_false, 0, size, 0,
+						       NULL, NULL, payload, &wire_size);
+	conn    = vortex_connection_new_empty (client_ctx, b, VortexRoleInitiator);
+
+	/* write as many frames as fit in the socket buffers, then
+	 * parse them */
+	batch = 32768 / wire_size;
+	if (batch < 1)
+		batch = 1;
+	while (parsed < bench_iterations) {
+		if (batch > bench_iterations - parsed)
+			batch = bench_iterations - parsed;
+		for (iterator = 0; iterator < batch; iterator++) {
+			pending = wire_size;
+			while (pending > 0) {
+				written = send (a, wire + (wire_size - pending), pending, 0);
+				if (written <= 0) {
+					fprintf (stderr, "ERROR: failed to write frame..\n");
+					return axl_false;
+				} /* end if */
+				pending -= written;
+			} /* end while */
+		} /* end for */
+
+		gettimeofday (&start, NULL);
+		for (iterator = 0; iterator < batch; iterator++) {
+			frame = vortex_frame_get_next (conn);
+			if (frame == NULL) {
+				fprintf (stderr, "ERROR: failed to parse frame %d: %s..\n", parsed, vortex_connection_get_message (conn));
+				return axl_false;
+			} /* end if */
+			vortex_frame_unref (frame);
+			parsed++;
+		} /* end for */
+		usecs += bench_elapsed (&start);
+	} /* end while */
+
+	bench_result_begin ("frame_parse", loopback ? "loopback" : "socketpair");
+	fprintf (bench_output, ", \"payload_size\": %d, \"frame_size\": %d", size, wire_size);
+	bench_result_end (parsed, usecs);
+
+	vortex_connection_shutdown (conn);
+	vortex_connection_unref (conn, "bench");
+	vortex_close_socket (a);
+	axl_free (payload);
+	axl_free (wire);
+	return axl_true;
+}
+
+/**
+ * @internal Creates a connection with the bench listener.
+ */
+VortexConnection * bench_connection_new (void)
+{
+	VortexConnection * conn;
+
+	conn = vortex_connection_new (client_ctx, "127.0.0.1", vortex_connection_get_port (listener), NULL, NULL);
+	if (! vortex_connection_is_ok (conn, axl_false)) {
+		fprintf (stderr, "ERROR: unable to connect to bench listener: %s..\n", vortex_connection_get_message (conn));
+		vortex_connection_close (conn);
+		return NULL;
+	} /* end if */
+	return conn;
+}
+
+/**
+ * @internal Creates a bench channel, optionally configuring a queue
+ * to receive replies.
+ */
+VortexChannel * bench_channel_new (VortexConnection * conn, VortexAsyncQueue * queue)
+{
+	return vortex_channel_new (conn, 0, BENCH_URI,
+				   /* no close handling */
+				   NULL, NULL,
+				   /* frame received */
+				   queue ? vortex_channel_queue_reply : NULL, queue,
+				   /* no async channel creation */
+				   NULL, NULL);
+}
+
+/**
+ * @internal Performs a MSG/RPY round trip, returning axl_false if it
+ * fails.
+ */
+axl_bool bench_round_trip (VortexChannel * channel, const char * payload, int size)
+{
+	WaitReplyData * wait_reply;
+	VortexFrame   * frame;
+	int             msg_no;
+
+	wait_reply = vortex_channel_create_wait_reply ();
+	if (! vortex_channel_send_msg_and_wait (channel, payload, size, &msg_no, wait_reply)) {
+		vortex_channel_free_wait_reply (wait_reply);
+		return axl_false;
+	} /* end if */
+	frame = vortex_channel_wait_reply (channel, msg_no, wait_reply);
+	if (frame == NULL || vortex_frame_get_payload_size (frame) != size)
+		return axl_false;
+	vortex_frame_unref (frame);
+	return axl_true;
+}
+
+int bench_compare_long (const void * a, const void * b)
+{
+	long _a = *((const long *) a);
+	long _b = *((const long *) b);
+
+	return (_a > _b) - (_a < _b);
+}
+
+/**
+ * @internal MSG/RPY latency bench: sequential round trips reporting
+ * percentiles.
+ */
+axl_bool bench_msg_rpy_latency (void)
+{
+	VortexConnection * conn;
+	VortexChannel    * channel;
+	char             * payload;
+	long             * latencies;
+	long               total = 0;
+	int                iterator;
+	struct timeval     start;
+
+	conn = bench_connection_new ();
+	if (conn == NULL)
+		return axl_false;
+	channel = bench_channel_new (conn, NULL);
+	if (channel == NULL) {
+		fprintf (stderr, "ERROR: unable to create bench channel..\n");
+		return axl_false;
+	} /* end if */
+
+	payload   = bench_payload_new (bench_payload_size);
+	latencies = axl_new (long, bench_iterations);
+	for (iterator = 0; iterator < bench_iterations; iterator++) {
+		gettimeofday (&start, NULL);
+		if (! bench_round_trip (channel, payload, bench_payload_size)) {
+			fprintf (stderr, "ERROR: round trip %d failed..\n", iterator);
+			return axl_false;
+		} /* end if */
+		latencies[iterator] = bench_elapsed (&start);
+		total              += latencies[iterator];
+	} /* end for */
+
+	qsort (latencies, bench_iterations, sizeof (long), bench_compare_long);
+
+	bench_result_begin ("msg_rpy_latency", "loopback");
+	fprintf (bench_output, ", \"payload_size\": %d, \"p50_us\": %ld, \"p90_us\": %ld, \"p99_us\": %ld, \"max_us\": %ld, \"mean_us\": %.2f",
+		 bench_payload_size,
+		 latencies[(bench_iterations - 1) * 50 / 100],
+		 latencies[(bench_iterations - 1) * 90 / 100],
+		 latencies[(bench_iterations - 1) * 99 / 100],
+		 latencies[bench_iterations - 1],
+		 (double) total / bench_iterations);
+	bench_result_end (bench_iterations, total);
+
+	axl_free (latencies);
+	axl_free (payload);
+	vortex_channel_close (channel, NULL);
+	vortex_connection_close (conn);
+	return axl_true;
+}
+
+/**
+ * @internal ANS streaming bench: requests bench_ans_frames ANS
+ * replies and measures the time until NUL is received.
+ */
+axl_bool bench_ans_throughput (void)
+{
+	VortexConnection * conn;
+	VortexChannel    * channel;
+	VortexAsyncQueue * queue;
+	VortexFrame      * frame;
+	char             * request;
+	long               bytes  = 0;
+	int                frames = 0;
+	long               usecs;
+	struct timeval     start;
+
+	conn = bench_connection_new ();
+	if (conn == NULL)
+		return axl_false;
+	queue   = vortex_async_queue_new ();
+	channel = bench_channel_new (conn, queue);
+	if (channel == NULL) {
+		fprintf (stderr, "ERROR: unable to create bench channel..\n");
+		return axl_false;
+	} /* end if */
+
+	request = axl_strdup_printf ("ans:%d:%d", bench_ans_frames, bench_payload_size);
+	gettimeofday (&start, NULL);
+	if (! vortex_channel_send_msg (channel, request, strlen (request), NULL)) {
+		fprintf (stderr, "ERROR: failed to send ANS request..\n");
+		return axl_false;
+	} /* end if */
+	while (axl_true) {
+		frame = vortex_channel_get_reply (channel, queue);
+		if (frame == NULL) {
+			fprintf (stderr, "ERROR: expected to receive ANS frame %d..\n", frames);
+			return axl_false;
+		} /* end if */
+		if (vortex_frame_get_type (frame) == VORTEX_FRAME_TYPE_NUL) {
+			vortex_frame_unref (frame);
+			break;
+		} /* end if */
+		bytes  += vortex_frame_get_payload_size (frame);
+		frames ++;
+		vortex_frame_unref (frame);
+	} /* end while */
+	usecs = bench_elapsed (&start);
+	if (usecs <= 0)
+		usecs = 1;
+
+	bench_result_begin ("ans_throughput", "loopback");
+	fprintf (bench_output, ", \"payload_size\": %d, \"frames\": %d, \"bytes\": %ld, \"mb_per_sec\": %.2f",
+		 bench_payload_size, frames, bytes, ((double) bytes / (1024 * 1024)) / ((double) usecs / 1000000));
+	bench_result_end (frames, usecs);
+
+	axl_free (request);
+	vortex_channel_close (channel, NULL);
+	vortex_connection_close (conn);
+	vortex_async_queue_unref (queue);
+	return axl_true;
+}
+
+typedef struct _BenchWorker {
+	VortexChannel    * channel;
+	VortexAsyncQueue * done;
+	int                ops;
+	axl_bool           status;
+} BenchWorker;
+
+axlPointer bench_scaling_worker (axlPointer user_data)
+{
+	BenchWorker * worker  = user_data;
+	char        * payload = bench_payload_new (bench_payload_size);
+	int           iterator;
+
+	worker->status = axl_true;
+	for (iterator = 0; iterator < worker->ops; iterator++) {
+		if (! bench_round_trip (worker->channel, payload, bench_payload_size)) {
+			worker->status = axl_false;
+			break;
+		} /* end if */
+	} /* end for */
+	axl_free (payload);
+
+	vortex_async_queue_push (worker->done, INT_TO_PTR (1));
+	return NULL;
+}
+
+/**
+ * @internal Scaling bench: runs concurrent MSG/RPY round trips over
+ * connections x channels, one thread per channel.
+ */
+axl_bool bench_scaling (int connections, int channels)
+{
+	VortexConnection ** conns;
+	BenchWorker       * workers;
+	VortexThread      * threads;
+	VortexAsyncQueue  * done;
+	int                 total = connections * channels;
+	int                 ops   = bench_iterations / total;
+	int                 iterator;
+	axl_bool            status = axl_true;
+	struct timeval      start;
+
+	if (ops < 10)
+		ops = 10;
+
+	conns   = axl_new (VortexConnection *, connections);
+	workers = axl_new (BenchWorker, total);
+	threads = axl_new (VortexThread, total);
+	done    = vortex_async_queue_new ();
+
+	for (iterator = 0; iterator < connections; iterator++) {
+		conns[iterator] = bench_connection_new ();
+		if (conns[iterator] == NULL)
+			return axl_false;
+	} /* end for */
+	for (iterator = 0; iterator < total; iterator++) {
+		workers[iterator].channel = bench_channel_new (conns[iterator % connections], NULL);
+		workers[iterator].done    = done;
+		workers[iterator].ops     = ops;
+		if (workers[iterator].channel == NULL) {
+			fprintf (stderr, "ERROR: unable to create bench channel..\n");
+			return axl_false;
+		} /* end if */
+	} /* end for */
+
+	gettimeofday (&start, NULL);
+	for (iterator = 0; iterator < total; iterator++) {
+		if (! vortex_thread_create (&threads[iterator], bench_scaling_worker, &workers[iterator],
+					    VORTEX_THREAD_CONF_END)) {
+			fprintf (stderr, "ERROR: failed to create bench thread..\n");
+			return axl_false;
+		} /* end if */
+	} /* end for */
+	for (iterator = 0; iterator < total; iterator++)
+		vortex_async_queue_pop (done);
+
+	bench_result_begin ("scaling", "loopback");
+	fprintf (bench_output, ", \"payload_size\": %d, \"connections\": %d, \"channels\": %d",
+		 bench_payload_size, connections, channels);
+	bench_result_end ((long) ops * total, bench_elapsed (&start));
+
+	for (iterator = 0; iterator < total; iterator++) {
+		vortex_thread_destroy (&threads[iterator], axl_false);
+		if (! workers[iterator].status)
+			status = axl_false;
+		vortex_channel_close (workers[iterator].channel, NULL);
+	} /* end for */
+	for (iterator = 0; iterator < connections; iterator++)
+		vortex_connection_close (conns[iterator]);
+
+	vortex_async_queue_unref (done);
+	axl_free (threads);
+	axl_free (workers);
+	axl_free (conns);
+	return status;
+}
+
+int main (int argc, char ** argv)
+{
+	const char * output_file = NULL;
+	int          iterator;
+	int          connections;
+	int          channels;
+	axl_bool     status = axl_true;
+
+	for (iterator = 1; iterator < argc; iterator++) {
+		if (axl_cmp (argv[iterator], "--iterations") && (iterator + 1) < argc)
+			bench_iterations = atoi (argv[++iterator]);
+		else if (axl_cmp (argv[iterator], "--payload-size") && (iterator + 1) < argc)
+			bench_payload_size = atoi (argv[++iterator]);
+		else if (axl_cmp (argv[iterator], "--ans-frames") && (iterator + 1) < argc)
+			bench_ans_frames = atoi (argv[++iterator]);
+		else if (axl_cmp (argv[iterator], "--connections") && (iterator + 1) < argc)
+			bench_max_connections = atoi (argv[++iterator]);
+		else if (axl_cmp (argv[iterator], "--channels") && (iterator + 1) < argc)
+			bench_max_channels = atoi (argv[++iterator]);
+		else if (axl_cmp (argv[iterator], "--work-stealing"))
+			bench_work_stealing = 1;
+		else if (axl_cmp (argv[iterator], "--output") && (iterator + 1) < argc)
+			output_file = argv[++iterator];
+		else {
+			printf ("Usage: %s [--iterations N] [--payload-size N] [--ans-frames N]\n"
+				"       [--connections N] [--channels N] [--work-stealing]\n"
+				"       [--output file.json]\n", argv[0]);
+			return -1;
+		} /* end if */
+	} /* end for */
+
+	if (bench_iterations < 1 || bench_payload_size < 2 || bench_ans_frames < 1 ||
+	    bench_max_connections < 1 || bench_max_channels < 1) {
+		fprintf (stderr, "ERROR: wrong bench parameters provided..\n");
+		return -1;
+	} /* end if */
+
+	bench_output = stdout;
+	if (output_file != NULL) {
+		bench_output = fopen (output_file, "w");
+		if (bench_output == NULL) {
+			fprintf (stderr, "ERROR: unable to open %s..\n", output_file);
+			return -1;
+		} /* end if */
+	} /* end if */
+
+	/* init listener and client contexts */
+	listener_ctx = vortex_ctx_new ();
+	client_ctx   = vortex_ctx_new ();
+	vortex_conf_set (listener_ctx, VORTEX_THREAD_POOL_WORK_STEALING, bench_work_stealing, NULL);
+	vortex_conf_set (client_ctx, VORTEX_THREAD_POOL_WORK_STEALING, bench_work_stealing, NULL);
+	if (! vortex_init_ctx (listener_ctx) || ! vortex_init_ctx (client_ctx)) {
+		fprintf (stderr, "ERROR: unable to init vortex..\n");
+		return -1;
+	} /* end if */
+
+	vortex_profiles_register (listener_ctx, BENCH_URI,
+				  NULL, NULL,
+				  NULL, NULL,
+				  bench_frame_received, NULL);
+	listener = vortex_listener_new (listener_ctx, "127.0.0.1", "0", NULL, NULL);
+	if (! vortex_connection_is_ok (listener, axl_false)) {
+		fprintf (stderr, "ERROR: unable to start bench listener: %s..\n", vortex_connection_get_message (listener));
+		return -1;
+	} /* end if */
+
+	fprintf (bench_output, "{\n  \"iterations\": %d,\n  \"payload_size\": %d,\n  \"work_stealing\": %s,\n  \"results\": [",
+		 bench_iterations, bench_payload_size, bench_work_stealing ? "true" : "false");
+
+	/* frame encode/decode */
+	status = status && bench_frame_build ();
+#if defined(AXL_OS_UNIX)
+	status = status && bench_frame_parse (axl_false);
+#endif
+	status = status && bench_frame_parse (axl_true);
+
+	/* end to end */
+	status = status && bench_msg_rpy_latency ();
+	status = status && bench_ans_throughput ();
+	for (connections = 1; status && connections <= bench_max_connections; connections *= 2) {
+		for (channels = 1; status && channels <= bench_max_channels; channels *= 2)
+			status = bench_scaling (connections, channels);
+	} /* end for */
+
+	fprintf (bench_output, "\n  ],\n  \"status\": \"%s\"\n}\n", status ? "ok" : "failed");
+	if (bench_output != stdout)
+		fclose (bench_output);
+
+	vortex_exit_ctx (client_ctx, axl_true);
+	vortex_exit_ctx (listener_ctx, axl_true);
+
+	return status ? 0 : -1;
+}
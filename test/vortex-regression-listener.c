@@ -215,6 +215,28 @@ axl_bool init_stats (int                channel_num,
 	return axl_true;
 }
 
+/* delays every read on the connection 5ms so the remote peer
+ * measures a stable round trip time (SEQ frames received are
+ * delayed) while the transfer is limited by its window (see
+ * test_01z16). The handler replaced and the queue used to wait are
+ * stored on the connection */
+int regression_delayed_receive (VortexConnection * connection,
+				char             * buffer,
+				int                buffer_len)
+{
+	VortexAsyncQueue     * queue   = vortex_connection_get_data (connection, "regression:delayed");
+	VortexReceiveHandler   receive;
+
+	vortex_async_queue_timedpop (queue, 5000);
+
+	/* the handler replaced is stored right after installing this
+	 * one */
+	while ((receive = (VortexReceiveHandler) vortex_connection_get_data (connection, "regression:receive")) == NULL)
+		vortex_async_queue_timedpop (queue, 1000);
+
+	return receive (connection, buffer, buffer_len);
+}
+
 void frame_received (VortexChannel    * channel,
 		     VortexConnection * connection,
 		     VortexFrame      * frame,
@@ -341,6 +363,14 @@ void frame_received (VortexChannel    * channel,
 		/* changing window size */
 		vortex_channel_set_window_size (channel, window_size);
 
+		/* ok reply to the peer client   */
+		vortex_channel_send_rpy (channel, "ok", 2, vortex_frame_get_msgno (frame));
+		return;
+	} else if (axl_memcmp (vortex_frame_get_payload (frame), "autotune=", 9)) {
+		/* enable or disable channel autotuning */
+		vortex_conf_set (CONN_CTX (connection), VORTEX_CHANNEL_AUTOTUNE, 
+				 atoi ((char *) vortex_frame_get_payload (frame) + 9), NULL);
+
 		/* ok reply to the peer client   */
 		vortex_channel_send_rpy (channel, "ok", 2, vortex_frame_get_msgno (frame));
 		return;
@@ -369,6 +399,15 @@ void frame_received (VortexChannel    * channel,
 		/* enable channel serialization */
 		vortex_channel_set_serialize (channel, axl_true);
 	} else if (axl_memcmp (vortex_frame_get_payload (frame), "get-file-by-feeder-rpy", 22)) {
+		/* artificial delay requested */
+		if (axl_cmp (vortex_frame_get_payload (frame), "get-file-by-feeder-rpy,delayed") &&
+		    vortex_connection_get_data (connection, "regression:delayed") == NULL) {
+			vortex_connection_set_data_full (connection, "regression:delayed", vortex_async_queue_new (),
+							 NULL, (axlDestroyFunc) vortex_async_queue_unref);
+			vortex_connection_set_data (connection, "regression:receive", 
+						    (axlPointer) vortex_connection_set_receive_handler (connection, regression_delayed_receive));
+		} /* end if */
+
 		/* create the feeder */
 		feeder = vortex_payload_feeder_file ("vortex-regression-client.c", axl_true);
 		
@@ -1586,6 +1625,199 @@ axl_bool  close_channel_connection (int channel_num, VortexConnection * conn, ax
 	return axl_true;
 }
 
+#if defined(ENABLE_XML_RPC_SUPPORT)
+/** 
+ * @internal Returns the hex representation of the provided string
+ * (used by regression_xml_rpc_describe).
+ */
+char * regression_xml_rpc_hex (const char * value)
+{
+	char * result;
+	int    iterator;
+	int    length = (value != NULL) ? strlen (value) : 0;
+
+	result = axl_new (char, (length * 2) + 1);
+	for (iterator = 0; iterator < length; iterator++)
+		sprintf (result + (iterator * 2), "%02x", (unsigned char) value[iterator]);
+	return result;
+}
+
+/** 
+ * @internal Returns a plain ASCII description of the value received
+ * (type and content, strings and member names in hex) so the
+ * client can check how values were unmarshalled (test_07b).
+ */
+char * regression_xml_rpc_describe (XmlRpcMethodValue * value)
+{
+	char              * result = NULL;
+	char              * aux;
+	char              * hex;
+	char              * item;
+	XmlRpcStruct      * _struct;
+	XmlRpcArray       * array;
+	int                 iterator;
+
+	switch (method_value_get_type (value)) {
+	case XML_RPC_INT_VALUE:
+		return axl_strdup_printf ("int:%d", method_value_get_as_int (value));
+	case XML_RPC_BOOLEAN_VALUE:
+		return axl_strdup_printf ("boolean:%d", method_value_get_as_int (value));
+	case XML_RPC_DOUBLE_VALUE:
+		return axl_strdup_printf ("double:%g", method_value_get_as_double (value));
+	case XML_RPC_STRING_VALUE:
+	case XML_RPC_STRING_REF_VALUE:
+	case XML_RPC_BASE64_VALUE:
+	case XML_RPC_BASE64_REF_VALUE:
+		hex    = regression_xml_rpc_hex (method_value_get_as_string (value));
+		result = axl_strdup_printf ("string:%s", hex);
+		axl_free (hex);
+		return result;
+	case XML_RPC_NONE_VALUE:
+		return axl_strdup ("none");
+	case XML_RPC_STRUCT_VALUE:
+		_struct = method_value_get_as_struct (value);
+		result  = axl_strdup ("struct{");
+		for (iterator = 0; iterator < vortex_xml_rpc_struct_get_member_count (_struct); iterator++) {
+			hex    = regression_xml_rpc_hex (vortex_xml_rpc_struct_get_member_name_at (_struct, iterator));
+			item   = regression_xml_rpc_describe (vortex_xml_rpc_struct_get_member_value_at (_struct, iterator));
+			aux    = result;
+			result = axl_strdup_printf ("%s%s%s=%s", aux, iterator > 0 ? "," : "", hex, item);
+			axl_free (aux);
+			axl_free (hex);
+			axl_free (item);
+		} /* end for */
+		aux    = result;
+		result = axl_strdup_printf ("%s}", aux);
+		axl_free (aux);
+		return result;
+	case XML_RPC_ARRAY_VALUE:
+		array  = method_value_get_as_array (value);
+		result = axl_strdup ("array[");
+		for (iterator = 0; iterator < vortex_xml_rpc_array_count (array); iterator++) {
+			item   = regression_xml_rpc_describe (vortex_xml_rpc_array_get (array, iterator));
+			aux    = result;
+			result = axl_strdup_printf ("%s%s%s", aux, iterator > 0 ? "," : "", item);
+			axl_free (aux);
+			axl_free (item);
+		} /* end for */
+		aux    = result;
+		result = axl_strdup_printf ("%s]", aux);
+		axl_free (aux);
+		return result;
+	default:
+		return axl_strdup ("unknown");
+	} /* end switch */
+}
+
+/** 
+ * @internal XML-RPC dispatch used by the listener: replies used by
+ * test_07a are built with the XmlRpcWriter API, the rest of services
+ * are served by the stub generated from vortex-regression-client.idl.
+ */
+XmlRpcMethodResponse * regression_xml_rpc_dispatch (VortexChannel    * channel, 
+						     XmlRpcMethodCall * method_call, 
+						     axlPointer         user_data)
+{
+	XmlRpcWriter * writer;
+	int            iterator;
+	char         * summary;
+	char         * item;
+	char         * aux;
+
+	if (method_call_is (method_call, "direct_get_none", 0, -1)) {
+		/* none reply */
+		writer = vortex_xml_rpc_writer_new (0);
+		vortex_xml_rpc_writer_none (writer);
+		return vortex_xml_rpc_method_response_new_from_writer (writer);
+	} /* end if */
+
+	if (method_call_is (method_call, "direct_get_empty_array", 0, -1)) {
+		/* empty array reply */
+		writer = vortex_xml_rpc_writer_new (0);
+		vortex_xml_rpc_writer_array_open (writer);
+		vortex_xml_rpc_writer_array_close (writer);
+		return vortex_xml_rpc_method_response_new_from_writer (writer);
+	} /* end if */
+
+	if (method_call_is (method_call, "direct_get_empty_struct", 0, -1)) {
+		/* empty struct reply */
+		writer = vortex_xml_rpc_writer_new (0);
+		vortex_xml_rpc_writer_struct_open (writer);
+		vortex_xml_rpc_writer_struct_close (writer);
+		return vortex_xml_rpc_method_response_new_from_writer (writer);
+	} /* end if */
+
+	if (method_call_is (method_call, "direct_get_nested", 0, -1)) {
+		/* struct holding an array of structs holding arrays:
+		 * { name, items: [ {position, tags: [..]} ], next: none } */
+		writer = vortex_xml_rpc_writer_new (0);
+		vortex_xml_rpc_writer_struct_open (writer);
+
+		vortex_xml_rpc_writer_member (writer, "name");
+		vortex_xml_rpc_writer_string (writer, "nested <&> value");
+		vortex_xml_rpc_writer_member_close (writer);
+
+		vortex_xml_rpc_writer_member (writer, "items");
+		vortex_xml_rpc_writer_array_open (writer);
+		for (iterator = 0; iterator < 3; iterator++) {
+			vortex_xml_rpc_writer_struct_open (writer);
+			vortex_xml_rpc_writer_member (writer, "position");
+			vortex_xml_rpc_writer_int (writer, iterator);
+			vortex_xml_rpc_writer_member_close (writer);
+
+			/* first item has tags, second an empty array and
+			 * third a none value */
+			vortex_xml_rpc_writer_member (writer, "tags");
+			if (iterator == 2) 
+				vortex_xml_rpc_writer_none (writer);
+			else {
+				vortex_xml_rpc_writer_array_open (writer);
+				if (iterator == 0) {
+					vortex_xml_rpc_writer_string (writer, "a");
+					vortex_xml_rpc_writer_string (writer, "b");
+				} /* end if */
+				vortex_xml_rpc_writer_array_close (writer);
+			} /* end if */
+			vortex_xml_rpc_writer_member_close (writer);
+			vortex_xml_rpc_writer_struct_close (writer);
+		} /* end for */
+		vortex_xml_rpc_writer_array_close (writer);
+		vortex_xml_rpc_writer_member_close (writer);
+
+		vortex_xml_rpc_writer_member (writer, "next");
+		vortex_xml_rpc_writer_none (writer);
+		vortex_xml_rpc_writer_member_close (writer);
+
+		vortex_xml_rpc_writer_struct_close (writer);
+		return vortex_xml_rpc_method_response_new_from_writer (writer);
+	} /* end if */
+
+	if (strncmp (method_call_get_name (method_call), "describe", 8) == 0) {
+		/* reply a description of the method name and the
+		 * params received: <name hex>|<param>|<param>.. */
+		summary = regression_xml_rpc_hex (method_call_get_name (method_call));
+		for (iterator = 0; iterator < method_call_get_num_params (method_call); iterator++) {
+			item    = regression_xml_rpc_describe (method_call_get_param_value (method_call, iterator));
+			aux     = summary;
+			summary = axl_strdup_printf ("%s|%s", aux, item);
+			axl_free (aux);
+			axl_free (item);
+		} /* end for */
+		return vortex_xml_rpc_method_response_new (XML_RPC_OK, -1, NULL, 
+							   method_value_new (CHANNEL_CTX (channel), XML_RPC_STRING_REF_VALUE, summary));
+	} /* end if */
+
+	if (method_call_is (method_call, "echo", 1, -1)) {
+		/* reply the value received */
+		return vortex_xml_rpc_method_response_new (XML_RPC_OK, -1, NULL, 
+							   method_value_copy (method_call_get_param_value (method_call, 0)));
+	} /* end if */
+
+	/* rest of services */
+	return service_dispatch (channel, method_call, user_data);
+}
+#endif
+
 int process_greetings_features (VortexCtx               * ctx, 
 				VortexConnection        * conn,
 				VortexConnection       ** new_conn,
@@ -1890,7 +2122,7 @@ int main (int  argc, char ** argv)
                 /* no user space data for the validation resource
 		 * function. */
                 NULL,
-                service_dispatch,
+                regression_xml_rpc_dispatch,
                 /* no user space data for the dispatch function. */
                 NULL);
 #endif
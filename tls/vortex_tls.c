@@ -59,6 +59,24 @@
 #define POST_CHECK        "tls:post-checks"
 #define POST_CHECK_DATA   "tls:post-checks:data"
 #define TLS_CTX           "tls:ctx"
+#define TLS_SESSION       "tls:session"
+
+/* session id context installed on listener SSL_CTX objects so
+ * sessions can be resumed (required when peer verification is
+ * enabled) */
+#define VORTEX_TLS_SESSION_ID_CONTEXT "vortex-tls"
+
+#if defined(SSL_OP_ENABLE_KTLS) && defined(BIO_get_ktls_send)
+/* kernel TLS offload available (OpenSSL 3.0 or later built with
+ * kTLS support) */
+#define VORTEX_TLS_HAVE_KTLS
+#endif
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+/* reference helpers not available before OpenSSL 1.1.0 */
+#define SSL_CTX_up_ref(c)     CRYPTO_add (&(c)->references, 1, CRYPTO_LOCK_SSL_CTX)
+#define SSL_SESSION_up_ref(s) CRYPTO_add (&(s)->references, 1, CRYPTO_LOCK_SSL_SESSION)
+#endif
 
 /**
  * @internal Function that dumps all errors found on current ssl context.
@@ -122,8 +140,66 @@ typedef struct _VortexTlsCtx {
 	int      	                   connection_auto_tls_allow_failures;
 	char  *                            connection_auto_tls_server_name;
 
+	/** 
+	 * @internal SSL_CTX objects built by the default (no ctx
+	 * creation handler) paths, indexed by role, method,
+	 * certificate, private key and serverName. Each connection
+	 * using one of them holds its own reference.
+	 */
+	axlHash                          * ctx_cache;
+	VortexMutex                        ctx_cache_mutex;
+
+	/** 
+	 * @internal Request kernel TLS offload (see vortex_tls_set_ktls).
+	 */
+	axl_bool                           ktls;
+
 } VortexTlsCtx;
 
+/** 
+ * @internal TLS state stored on each connection with TLS activated
+ * (connection slot registered by vortex_tls_init), so send and
+ * receive handlers reach it without hash lookups.
+ */
+typedef struct _VortexTlsConnData {
+	SSL         * ssl;
+	SSL_CTX     * ssl_ctx;
+	/* protects the ssl object */
+	VortexMutex   mutex;
+} VortexTlsConnData;
+
+/** 
+ * @internal Connection slot holding the VortexTlsConnData.
+ */
+static int __vortex_tls_slot = -1;
+
+/** 
+ * @internal Releases TLS state stored on a connection.
+ */
+void __vortex_tls_conn_data_free (VortexTlsConnData * data)
+{
+	SSL_free (data->ssl);
+	SSL_CTX_free (data->ssl_ctx);
+	vortex_mutex_destroy (&data->mutex);
+	axl_free (data);
+	return;
+}
+
+/** 
+ * @internal Releases the tls context and the SSL_CTX objects it
+ * still caches.
+ */
+void __vortex_tls_ctx_free (VortexTlsCtx * tls_ctx)
+{
+	if (tls_ctx == NULL)
+		return;
+	axl_hash_free (tls_ctx->ctx_cache);
+	vortex_mutex_destroy (&tls_ctx->ctx_cache_mutex);
+	axl_free (tls_ctx->connection_auto_tls_server_name);
+	axl_free (tls_ctx);
+	return;
+}
+
 /** 
  * @internal Calls to the failure handler if it is defined with the
  * provided error message.
@@ -182,12 +258,21 @@ axl_bool      vortex_tls_init (VortexCtx * ctx)
 	if (tls_ctx != NULL) 
 		return axl_true;
 
+	/* register connection slot (shared by all contexts) */
+	__vortex_tls_slot = vortex_connection_slot_register ("vortex-tls");
+	if (__vortex_tls_slot == -1) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to register TLS connection slot, unable to activate TLS");
+		return axl_false;
+	} /* end if */
+
 	/* create the tls context */
 	tls_ctx = axl_new (VortexTlsCtx, 1);
+	tls_ctx->ctx_cache = axl_hash_new (axl_hash_string, axl_hash_equal_string);
+	vortex_mutex_create (&tls_ctx->ctx_cache_mutex);
 	vortex_ctx_set_data_full (ctx,
 				  /* key and value */
 				  TLS_CTX, tls_ctx,
-				  NULL, axl_free);
+				  NULL, (axlDestroyFunc) __vortex_tls_ctx_free);
 
 	/* install connection action */
 	vortex_connection_set_connection_actions (ctx,
@@ -444,27 +529,23 @@ void               vortex_tls_set_failure_handler        (VortexCtx
  */
 int  vortex_tls_ssl_read (VortexConnection * connection, char  * buffer, int  buffer_len)
 {
-	SSL         * ssl;
-	VortexMutex * mutex;
-	VortexCtx   * ctx = vortex_connection_get_ctx (connection);
+	SSL               * ssl;
+	VortexTlsConnData * data;
+	VortexCtx         * ctx = vortex_connection_get_ctx (connection);
 	int    res;
 	int    ssl_err;
 
 	/* get ssl object */
-	ssl = vortex_connection_get_data (connection, "ssl-data:ssl");
-	if (ssl == NULL) {
+	data = vortex_connection_get_slot (connection, __vortex_tls_slot);
+	if (data == NULL) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find ssl object to read data");
 		return 0;
 	}
+	ssl = data->ssl;
 
  retry:
-	/* get and lock the mutex */
-	mutex = vortex_connection_get_data (connection, "ssl-data:mutex");
-	if (mutex == NULL) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find mutex to protect ssl object to read data");
-		return 0;
-	}
-	vortex_mutex_lock (mutex);
+	/* lock the mutex */
+	vortex_mutex_lock (&data->mutex);
 
 	/* read data */
 	res = SSL_read (ssl, buffer, buffer_len);
@@ -480,11 +561,11 @@ int  vortex_tls_ssl_read (VortexConnection * connection, char  * buffer, int  bu
 	 * LibVortex does not produce this against itself, because its sequencer writes one
 	 * BEEP frame per SSL_write. Any peer that batches writes does, which is ordinary and
 	 * correct over a byte stream. Same shape as the WebSocket transport, which reports the
-	 * same thing through the same key. */
-	vortex_connection_set_data (connection, "try_read_pending", INT_TO_PTR (SSL_pending (ssl)));
+	 * same thing through vortex_connection_set_pending_input. */
+	vortex_connection_set_pending_input (connection, SSL_pending (ssl));
 
 	/* unlock the mutex */
-	vortex_mutex_unlock (mutex);
+	vortex_mutex_unlock (&data->mutex);
 
 	/* get error returned */
 	ssl_err = SSL_get_error(ssl, res);
@@ -541,33 +622,31 @@ int  vortex_tls_ssl_read (VortexConnection * connection, char  * buffer, int  bu
  */
 int  vortex_tls_ssl_write (VortexConnection * connection, const char  * buffer, int  buffer_len)
 {
-	int           res;
-	int           ssl_err;
-	VortexMutex * mutex;
+	int                 res;
+	int                 ssl_err;
+	SSL               * ssl;
+	VortexTlsConnData * data;
 #if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
-	VortexCtx   * ctx = vortex_connection_get_ctx (connection);
+	VortexCtx         * ctx = vortex_connection_get_ctx (connection);
 #endif
 
-	SSL * ssl = vortex_connection_get_data (connection, "ssl-data:ssl");
-	if (ssl == NULL) {
+	data = vortex_connection_get_slot (connection, __vortex_tls_slot);
+	if (data == NULL) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find ssl object to read data");
 		return 0;
 	}
+	ssl = data->ssl;
+
 	/* try to write */
  retry:
-	/* get and lock the mutex */
-	mutex = vortex_connection_get_data (connection, "ssl-data:mutex");
-	if (mutex == NULL) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find mutex to protect ssl object to read data");
-		return 0;
-	}
-	vortex_mutex_lock (mutex);
+	/* lock the mutex */
+	vortex_mutex_lock (&data->mutex);
 	
 	/* write data */
 	res = SSL_write (ssl, buffer, buffer_len);
 
 	/* unlock the mutex */
-	vortex_mutex_unlock (mutex);
+	vortex_mutex_unlock (&data->mutex);
 	
 	/* get error */
 	ssl_err = SSL_get_error(ssl, res);
@@ -608,20 +687,6 @@ int  vortex_tls_ssl_write (VortexConnection * connection, const char  * buffer,
 	return -1;
 }
 
-/** 
- * @internal Internal function to release and free the mutex memory
- * allocated.
- * 
- * @param mutex The mutex to destroy.
- */
-void __vortex_tls_free_mutex (VortexMutex * mutex)
-{
-	/* free mutex */
-	vortex_mutex_destroy (mutex);
-	axl_free (mutex);
-	return;
-}
-
 /** 
  * @internal Common function which sets needed data for the TLS
  * transport and default callbacks for read and write data.
@@ -633,34 +698,160 @@ void __vortex_tls_free_mutex (VortexMutex * mutex)
 void vortex_tls_set_common_data (VortexConnection * connection, 
 				 SSL* ssl, SSL_CTX * _ctx)
 {
-	VortexMutex * mutex;
+	VortexTlsConnData * data;
 #if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
-	VortexCtx   * ctx = vortex_connection_get_ctx (connection);
+	VortexCtx         * ctx = vortex_connection_get_ctx (connection);
 #endif
 
-	/* set some necessary ssl data (setting destroy functions for
-	 * both) */
-	vortex_connection_set_data_full (connection, "ssl-data:ssl", ssl, 
-					 NULL, (axlDestroyFunc) SSL_free);
-	vortex_connection_set_data_full (connection, "ssl-data:ctx", _ctx, 
-					 NULL, (axlDestroyFunc) SSL_CTX_free);
+	/* store ssl objects and the mutex used to protect the ssl
+	 * session (released with the connection) */
+	data          = axl_new (VortexTlsConnData, 1);
+	data->ssl     = ssl;
+	data->ssl_ctx = _ctx;
+	vortex_mutex_create (&data->mutex);
+	vortex_connection_set_slot (connection, __vortex_tls_slot, data,
+				    (axlDestroyFunc) __vortex_tls_conn_data_free);
 
 	/* set new handlers for read and write */
 	vortex_log (VORTEX_LEVEL_DEBUG, "change default handlers to be used for send/recv");
-
-	/* create the mutex */
-	mutex = axl_new (VortexMutex, 1);
-	vortex_mutex_create (mutex);
-	
-	/* configure the mutex used by the connection to protect the ssl session */	
-	vortex_connection_set_data_full (connection, "ssl-data:mutex", mutex,
-					 NULL, (axlDestroyFunc) __vortex_tls_free_mutex);
 	vortex_connection_set_receive_handler (connection, vortex_tls_ssl_read);
 	vortex_connection_set_send_handler    (connection, vortex_tls_ssl_write);
 
 	return;
 }
 
+/** 
+ * @internal Builds the key used to find an SSL_CTX already created
+ * for the same role, method, certificate, private key and
+ * serverName. The caller must release the result.
+ */
+char * __vortex_tls_ctx_cache_key (VortexConnection * connection,
+				   const char       * role,
+				   const char       * certificate_file,
+				   const char       * private_file)
+{
+	const char * method      = vortex_connection_get_data (connection, "tls:method");
+	const char * server_name = vortex_connection_get_server_name (connection);
+
+	return axl_strdup_printf ("%s:%s:%s:%s:%s", role,
+				  method           ? method           : "flex",
+				  certificate_file ? certificate_file : "",
+				  private_file     ? private_file     : "",
+				  server_name      ? server_name      : "");
+}
+
+/** 
+ * @internal Returns the cached SSL_CTX for the provided key with a
+ * new reference owned by the caller, or NULL if it is not cached.
+ */
+SSL_CTX * __vortex_tls_ctx_cache_get (VortexTlsCtx * tls_ctx, const char * key)
+{
+	SSL_CTX * ssl_ctx;
+
+	vortex_mutex_lock (&tls_ctx->ctx_cache_mutex);
+	ssl_ctx = axl_hash_get (tls_ctx->ctx_cache, (axlPointer) key);
+	if (ssl_ctx != NULL)
+		SSL_CTX_up_ref (ssl_ctx);
+	vortex_mutex_unlock (&tls_ctx->ctx_cache_mutex);
+
+	return ssl_ctx;
+}
+
+/** 
+ * @internal Stores a freshly configured SSL_CTX under the provided
+ * key. The function returns the SSL_CTX the caller must use, holding
+ * one reference for it: if another connection cached the same
+ * context meanwhile, the provided one is released and the cached one
+ * is returned.
+ */
+SSL_CTX * __vortex_tls_ctx_cache_put (VortexTlsCtx * tls_ctx, const char * key, SSL_CTX * ssl_ctx)
+{
+	SSL_CTX * cached;
+
+	vortex_mutex_lock (&tls_ctx->ctx_cache_mutex);
+	cached = axl_hash_get (tls_ctx->ctx_cache, (axlPointer) key);
+	if (cached != NULL) {
+		SSL_CTX_up_ref (cached);
+		vortex_mutex_unlock (&tls_ctx->ctx_cache_mutex);
+
+		SSL_CTX_free (ssl_ctx);
+		return cached;
+	} /* end if */
+
+	/* one reference for the cache and another for the caller */
+	SSL_CTX_up_ref (ssl_ctx);
+	axl_hash_insert_full (tls_ctx->ctx_cache,
+			      axl_strdup (key), axl_free,
+			      ssl_ctx, (axlDestroyFunc) SSL_CTX_free);
+	vortex_mutex_unlock (&tls_ctx->ctx_cache_mutex);
+
+	return ssl_ctx;
+}
+
+/** 
+ * @internal Enables the server side session cache and session
+ * tickets on a listener SSL_CTX so returning clients can skip the
+ * full handshake.
+ */
+void __vortex_tls_ctx_enable_resumption (SSL_CTX * ssl_ctx)
+{
+	SSL_CTX_set_session_cache_mode (ssl_ctx, SSL_SESS_CACHE_SERVER);
+	SSL_CTX_set_session_id_context (ssl_ctx,
+					(const unsigned char *) VORTEX_TLS_SESSION_ID_CONTEXT,
+					strlen (VORTEX_TLS_SESSION_ID_CONTEXT));
+#if defined(SSL_OP_NO_TICKET)
+	SSL_CTX_clear_options (ssl_ctx, SSL_OP_NO_TICKET);
+#endif
+	return;
+}
+
+/** 
+ * @internal Requests kernel TLS offload on the provided ssl object
+ * (before the handshake) if enabled by vortex_tls_set_ktls.
+ */
+void __vortex_tls_request_ktls (VortexTlsCtx * tls_ctx, SSL * ssl)
+{
+#if defined(VORTEX_TLS_HAVE_KTLS)
+	if (tls_ctx->ktls)
+		SSL_set_options (ssl, SSL_OP_ENABLE_KTLS);
+#endif
+	return;
+}
+
+/** 
+ * @internal Called once the handshake has finished. If the kernel
+ * took over the encryption of sent records, the plain send handler
+ * is installed so writes skip SSL_write and its mutex (and the
+ * connection can use the same zero-copy paths as plain TCP).
+ *
+ * Received data is still read with SSL_read: with receive offload it
+ * only copies octets already decrypted by the kernel, and it handles
+ * records other than application data (alerts, session tickets, key
+ * updates) that a plain recv can't.
+ */
+void __vortex_tls_check_ktls (VortexConnection * connection, SSL * ssl)
+{
+#if defined(VORTEX_TLS_HAVE_KTLS)
+#if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
+	VortexCtx * ctx = vortex_connection_get_ctx (connection);
+#endif
+
+	if (! (SSL_get_options (ssl) & SSL_OP_ENABLE_KTLS))
+		return;
+
+	if (! BIO_get_ktls_send (SSL_get_wbio (ssl))) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "kernel TLS not available for conn-id=%d (cipher or kernel not supported), using SSL_write",
+			    vortex_connection_get_id (connection));
+		return;
+	} /* end if */
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "kernel TLS send offload enabled for conn-id=%d (receive offload: %d)",
+		    vortex_connection_get_id (connection), BIO_get_ktls_recv (SSL_get_rbio (ssl)) ? 1 : 0);
+	vortex_connection_set_send_handler (connection, vortex_connection_default_send);
+#endif
+	return;
+}
+
 /** 
  * @internal
  * @brief Support data structure for \ref vortex_tls_start_negotiation function.
@@ -720,6 +911,8 @@ int      vortex_tls_invoke_tls_activation (VortexConnection * connection)
 	int                    ssl_error;
 	VortexTlsCtx         * tls_ctx;
 	const char           * method_label;
+	char                 * cache_key = NULL;
+	SSL_SESSION          * session;
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
 	const char           * method_requested = NULL;
 #endif	
@@ -748,9 +941,18 @@ int      vortex_tls_invoke_tls_activation (VortexConnection * connection)
 	method_requested = vortex_connection_get_data (connection, "tls:method");
 #endif
 
+	/* reuse the SSL_CTX already created for the same method and
+	 * serverName when no ctx creation handler is defined */
+	if (ctx_creation == NULL) {
+		cache_key = __vortex_tls_ctx_cache_key (connection, "client", NULL, NULL);
+		ssl_ctx   = __vortex_tls_ctx_cache_get (tls_ctx, cache_key);
+	} /* end if */
+
 	/* check ctx_creation is not defined to provide default method
 	   based on user preference or default Flexible method. */
-	if (ctx_creation == NULL) {
+	if (ssl_ctx != NULL) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "reusing cached ssl context %p", ssl_ctx);
+	} else if (ctx_creation == NULL) {
 	        /* First, select especific versions only if user requested
 		 * them. Otherwise, try first flexible method available
 		 * (NEW: TLS_client_method or OLD: SSLv23_client_method).
@@ -825,12 +1027,16 @@ int      vortex_tls_invoke_tls_activation (VortexConnection * connection)
 		if (ssl_ctx) {
 		        /* report was was configured for client side */
 		        vortex_log (VORTEX_LEVEL_DEBUG, "ssl context SSL_CTX_new (%s ()) returned = %p, method=%s", method_label, ssl_ctx, method_label);
+
+			/* share it with next connections */
+			ssl_ctx = __vortex_tls_ctx_cache_put (tls_ctx, cache_key, ssl_ctx);
 		}
 	} else {
 		/* call to the default handler to create the SSL_CTX */
 		ssl_ctx  = ctx_creation (connection, ctx_creation_data);
 		vortex_log (VORTEX_LEVEL_DEBUG, "ssl context ctx_creation (connection, ctx_creation_data) returned = %p", ssl_ctx);
 	} /* end if */
+	axl_free (cache_key);
 
 	/* create and register the TLS method */
 	if (ssl_ctx == NULL) {
@@ -850,6 +1056,14 @@ int      vortex_tls_invoke_tls_activation (VortexConnection * connection)
 	/* set the file descriptor */
 	vortex_log (VORTEX_LEVEL_DEBUG, "setting file descriptor");
 	SSL_set_fd (ssl, vortex_connection_get_socket (connection));
+	__vortex_tls_request_ktls (tls_ctx, ssl);
+
+	/* offer the session configured through vortex_tls_set_session
+	 * so the server can skip the full handshake */
+	session = vortex_connection_get_data (connection, TLS_SESSION);
+	if (session != NULL && SSL_set_session (ssl, session) != 1) {
+		vortex_log (VORTEX_LEVEL_WARNING, "unable to reuse the TLS session provided, doing a full handshake");
+	} /* end if */
 
 	/* configure read and write handlers and store default data to
 	 * be used while sending and receiving data */
@@ -921,6 +1135,9 @@ int      vortex_tls_invoke_tls_activation (VortexConnection * connection)
 		} /* end if */
 	} /* end if */
 
+	/* move sent records to the kernel if possible */
+	__vortex_tls_check_ktls (connection, ssl);
+
 	vortex_log (VORTEX_LEVEL_DEBUG, "TLS transport negotiation finished");
 	
 	return axl_true;
@@ -960,7 +1177,7 @@ axl_bool               vortex_tls_verify_cert                (VortexConnection
 	} /* end if */
 
 	/* get ssl object */
-	ssl = vortex_connection_get_data (connection, "ssl-data:ssl");
+	ssl = vortex_tls_get_ssl_object (connection);
 	if (! ssl) {
 		vortex_log (VORTEX_LEVEL_WARNING, "SSL object cannot found for this connection (id=%d), cert verify cannot succeed",
 			    vortex_connection_get_id (connection));
@@ -1603,8 +1820,9 @@ void vortex_tls_initial_accept (VortexConnection * connection)
 {
 	/* get current context */
 	VortexCtx            * ctx       = vortex_connection_get_ctx (connection);
-	SSL                  * ssl       = vortex_connection_get_data (connection, "ssl-data:ssl");
-	SSL_CTX              * ssl_ctx   = vortex_connection_get_data (connection, "ssl-data:ctx");
+	VortexTlsConnData    * data      = vortex_connection_get_slot (connection, __vortex_tls_slot);
+	SSL                  * ssl       = data ? data->ssl : NULL;
+	SSL_CTX              * ssl_ctx   = data ? data->ssl_ctx : NULL;
 	axl_bool               status    = axl_false;
 	VortexTlsPostCheck     post_check;
 	axlPointer             post_check_data;
@@ -1680,6 +1898,9 @@ void vortex_tls_initial_accept (VortexConnection * connection)
 			} /* end if */
 		} /* end if */
 		
+		/* move sent records to the kernel if possible */
+		__vortex_tls_check_ktls (connection, ssl);
+
 		/* flag this connection to be already TLS-ficated */
 		vortex_connection_set_tlsfication_status (connection, axl_true);
 
@@ -1712,8 +1933,10 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 	const char           * method_requested = NULL;
 #endif	
 	const char           * method_label     = NULL;
-	char                 * certificate_file;
-	char                 * private_file;
+	char                 * certificate_file = NULL;
+	char                 * private_file     = NULL;
+	char                 * cache_key        = NULL;
+	axl_bool               cached           = axl_false;
 	VortexConnection     * new_connection;
 	VORTEX_SOCKET          socket;
 	VortexTlsCtxCreation   ctx_creation;
@@ -1749,6 +1972,18 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 #endif	
 
 	if (ctx_creation == NULL) {
+		/* reuse the context already loaded with the same
+		 * method, certificate, private key and serverName */
+		certificate_file = vortex_connection_get_data (connection, "tls:certificate-file");
+		private_file     = vortex_connection_get_data (connection, "tls:private-file");
+		cache_key        = __vortex_tls_ctx_cache_key (connection, "server", certificate_file, private_file);
+		ssl_ctx          = __vortex_tls_ctx_cache_get (tls_ctx, cache_key);
+		cached           = (ssl_ctx != NULL);
+	} /* end if */
+
+	if (cached) {
+		vortex_log (VORTEX_LEVEL_DEBUG, "reusing cached ssl context %p for listener", ssl_ctx);
+	} else if (ctx_creation == NULL) {
 
 	        /* First, select especific versions only if user requested
 		 * them. Otherwise, try first flexible method available
@@ -1836,18 +2071,18 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 		 * given connection including the socket. */
 		vortex_log (VORTEX_LEVEL_CRITICAL, 
 		       "unable to create SSL context object, unable to start TLS profile");
+		axl_free (cache_key);
 		vortex_connection_set_close_socket (connection, axl_true);
 		vortex_connection_shutdown (connection);
 		return;
 	} /* end if */
 	
 
-	/* if the context creation is provided, do not perform the
-	 * following tasks */
-	if (ctx_creation == NULL) {
+	/* if the context creation is provided or the context was
+	 * found on the cache, do not perform the following tasks */
+	if (ctx_creation == NULL && ! cached) {
 
 		/* configure certificate file */
-		certificate_file = vortex_connection_get_data (connection, "tls:certificate-file");
 		vortex_log (VORTEX_LEVEL_DEBUG, "Using certificate: %s", certificate_file);
 		if (axl_memcmp (certificate_file, "-----BEGIN", 10)) {
 			/* get bufio */
@@ -1875,6 +2110,8 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 
 			/* dump error stack */
 			vortex_tls_notify_failure_handler (ctx, connection, "there was an error while setting certificate file into the SSl context, unable to start TLS profile. Failure found at SSL_CTX_use_certificate_file function.");
+			SSL_CTX_free (ssl_ctx);
+			axl_free (cache_key);
 			vortex_connection_set_close_socket (connection, axl_true);
 			vortex_connection_shutdown (connection);
 			return;
@@ -1883,7 +2120,6 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 		vortex_log (VORTEX_LEVEL_DEBUG, "Certificate loaded OK into SSL context");
 		
 		/* configure private file */
-		private_file    = vortex_connection_get_data (connection, "tls:private-file");
 		if (axl_memcmp (private_file, "-----BEGIN", 10)) {
 			/* get bufio */
 			bufio  = BIO_new_mem_buf (private_file, strlen (private_file));
@@ -1904,6 +2140,8 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 				    private_file, getuid (), geteuid ());
 			/* dump error stack */
 			vortex_tls_notify_failure_handler (ctx, connection, "there was an error while setting private file into the SSl context, unable to start TLS profile. Failure found at SSL_CTX_use_PrivateKey_file function.");
+			SSL_CTX_free (ssl_ctx);
+			axl_free (cache_key);
 			vortex_connection_set_close_socket (connection, axl_true);
 			vortex_connection_shutdown (connection);
 			return;
@@ -1917,12 +2155,20 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 				    "seems that certificate file and private key doesn't match!, unable to start TLS profile. Failure found at SSL_CTX_check_private_key function.");
 			/* dump error stack */
 			vortex_tls_notify_failure_handler (ctx, connection, "there was an error while setting private file into the SSl context, unable to start TLS profile. Failure found at SSL_CTX_use_PrivateKey_file function.");
+			SSL_CTX_free (ssl_ctx);
+			axl_free (cache_key);
 			vortex_connection_set_close_socket (connection, axl_true);
 			vortex_connection_shutdown (connection);
 			return;
 		} /* end if */
 
+		/* enable session resumption and share the context
+		 * with next connections */
+		__vortex_tls_ctx_enable_resumption (ssl_ctx);
+		ssl_ctx = __vortex_tls_ctx_cache_put (tls_ctx, cache_key, ssl_ctx);
+
 	} /* end if */
+	axl_free (cache_key);
 		
 	/* create ssl object */
 	vortex_log (VORTEX_LEVEL_DEBUG, "initializing TLS transport");
@@ -1938,6 +2184,7 @@ void vortex_tls_prepare_listener (VortexConnection * connection)
 	/* set the file descriptor */
 	vortex_log (VORTEX_LEVEL_DEBUG, "setting file descriptor");
 	SSL_set_fd (ssl, socket);
+	__vortex_tls_request_ktls (tls_ctx, ssl);
 
 	/* prepare the new connection */
 	new_connection = vortex_connection_new_empty_from_connection (ctx, socket, connection, VortexRoleListener);
@@ -2486,9 +2733,146 @@ axl_bool    vortex_tls_accept_negotiation (VortexCtx                       * ctx
  */
 axlPointer         vortex_tls_get_ssl_object             (VortexConnection * connection)
 {
-	/* return the ssl object which is stored under the key:
-	 * ssl-data:ssl */
-	return vortex_connection_get_data (connection, "ssl-data:ssl");
+	VortexTlsConnData * data;
+
+	/* return the ssl object stored on the TLS connection slot */
+	data = vortex_connection_get_slot (connection, __vortex_tls_slot);
+	if (data == NULL)
+		return NULL;
+	return data->ssl;
+}
+
+/** 
+ * @brief Returns the TLS session negotiated on the provided
+ * connection so it can be offered again when reconnecting (see \ref
+ * vortex_tls_set_session).
+ *
+ * Resuming a session skips the certificate exchange and the key
+ * agreement, which is the expensive part of the handshake for both
+ * peers. A typical reconnect looks like:
+ *
+ * \code
+ * // save session before closing the connection
+ * session = vortex_tls_get_session (connection);
+ * vortex_connection_close (connection);
+ *
+ * // later, offer it on the new connection
+ * connection = vortex_connection_new (ctx, host, port, NULL, NULL);
+ * vortex_tls_set_session (connection, session);
+ * vortex_tls_session_free (session);
+ * connection = vortex_tls_start_negotiation_sync (connection, NULL, &status, &status_message);
+ * \endcode
+ *
+ * @param connection The connection with a TLS session activated.
+ *
+ * @return A new reference to the SSL_SESSION object or NULL if the
+ * connection has no TLS session. The caller must release it with
+ * \ref vortex_tls_session_free.
+ */
+axlPointer         vortex_tls_get_session                (VortexConnection * connection)
+{
+	SSL * ssl = vortex_tls_get_ssl_object (connection);
+
+	if (ssl == NULL)
+		return NULL;
+	return SSL_get1_session (ssl);
+}
+
+/** 
+ * @brief Configures a TLS session, previously returned by \ref
+ * vortex_tls_get_session, to be offered to the remote peer on the next
+ * TLS negotiation started on the connection.
+ *
+ * The server will resume the session if it still knows it (it is
+ * still in its session cache or the session ticket is valid),
+ * otherwise a full handshake is done. Use \ref
+ * vortex_tls_session_reused to know which one happened.
+ *
+ * @param connection The connection where the TLS negotiation will be
+ * started (by \ref vortex_tls_start_negotiation or \ref
+ * vortex_tls_start_negotiation_sync).
+ *
+ * @param session The SSL_SESSION to offer or NULL to remove a session
+ * previously configured. The function acquires its own reference, so
+ * the caller still owns the session provided.
+ */
+void               vortex_tls_set_session                (VortexConnection * connection,
+							  axlPointer         session)
+{
+	if (connection == NULL)
+		return;
+
+	if (session == NULL) {
+		vortex_connection_set_data (connection, TLS_SESSION, NULL);
+		return;
+	} /* end if */
+
+	SSL_SESSION_up_ref ((SSL_SESSION *) session);
+	vortex_connection_set_data_full (connection, TLS_SESSION, session,
+					 NULL, (axlDestroyFunc) SSL_SESSION_free);
+	return;
+}
+
+/** 
+ * @brief Releases a session reference returned by \ref
+ * vortex_tls_get_session.
+ *
+ * @param session The session to release.
+ */
+void               vortex_tls_session_free               (axlPointer         session)
+{
+	if (session == NULL)
+		return;
+	SSL_SESSION_free ((SSL_SESSION *) session);
+	return;
+}
+
+/** 
+ * @brief Allows to check if the TLS session running on the provided
+ * connection was resumed instead of being fully negotiated.
+ *
+ * @param connection The connection with a TLS session activated.
+ *
+ * @return axl_true if the session was resumed, otherwise axl_false
+ * is returned (including when TLS is not activated).
+ */
+axl_bool           vortex_tls_session_reused             (VortexConnection * connection)
+{
+	SSL * ssl = vortex_tls_get_ssl_object (connection);
+
+	if (ssl == NULL)
+		return axl_false;
+	return SSL_session_reused (ssl) ? axl_true : axl_false;
+}
+
+/** 
+ * @brief Releases all SSL_CTX objects cached by the TLS module.
+ *
+ * When no ctx creation handler is configured (see \ref
+ * vortex_tls_set_ctx_creation), the SSL_CTX objects created are
+ * cached by method, certificate, private key and serverName, so the
+ * certificate and private key are parsed once and the session cache
+ * is shared by all connections. Call this function after replacing
+ * certificate or private key files so next TLS negotiations load them
+ * again. Connections already running are not affected.
+ *
+ * @param ctx The context where the operation will be performed.
+ */
+void               vortex_tls_ctx_cache_flush            (VortexCtx        * ctx)
+{
+	VortexTlsCtx * tls_ctx;
+
+	/* check if the tls ctx was created */
+	tls_ctx = vortex_ctx_get_data (ctx, TLS_CTX);
+	if (tls_ctx == NULL)
+		return;
+
+	vortex_mutex_lock (&tls_ctx->ctx_cache_mutex);
+	axl_hash_free (tls_ctx->ctx_cache);
+	tls_ctx->ctx_cache = axl_hash_new (axl_hash_string, axl_hash_equal_string);
+	vortex_mutex_unlock (&tls_ctx->ctx_cache_mutex);
+
+	return;
 }
 
 /** 
@@ -2949,4 +3333,70 @@ void                vortex_tls_set_auto_tls       (VortexCtx  * ctx,
 	return;
 }
 
+/** 
+ * @brief Allows to enable kernel TLS (kTLS) offload for TLS sessions
+ * negotiated from now on in the provided context (both for client
+ * and listener side).
+ *
+ * Once the handshake finishes, if the kernel supports the cipher
+ * agreed (and the OpenSSL library used supports kTLS), records sent
+ * are encrypted by the kernel and the connection goes back to the
+ * plain send handler, avoiding SSL_write and its per connection
+ * mutex, and allowing zero-copy transmission of large payloads. When
+ * the kernel can't take over, the connection keeps working as
+ * usual. See \ref vortex_tls_is_ktls.
+ *
+ * Received data is always read through SSL_read, which with receive
+ * offload only copies the content already decrypted by the kernel.
+ *
+ * On Linux, kTLS requires the "tls" kernel module loaded (modprobe
+ * tls). By default kTLS offload is disabled.
+ *
+ * @param ctx The context where the operation will be performed.
+ *
+ * @param enable axl_true to request kTLS offload, axl_false to
+ * disable it.
+ */
+void                vortex_tls_set_ktls           (VortexCtx  * ctx,
+						   axl_bool     enable)
+{
+	VortexTlsCtx * tls_ctx;
+
+	v_return_if_fail (ctx);
+
+	/* get a reference to the TLS context */
+	tls_ctx = vortex_ctx_get_data (ctx, TLS_CTX);
+	if (tls_ctx == NULL)
+		return;
+
+#if ! defined(VORTEX_TLS_HAVE_KTLS)
+	if (enable)
+		vortex_log (VORTEX_LEVEL_WARNING, "kernel TLS offload requested but the OpenSSL library used has no kTLS support");
+#endif
+	tls_ctx->ktls = enable;
+	return;
+}
+
+/** 
+ * @brief Allows to check if the provided connection has its TLS
+ * records sent by the kernel (see \ref vortex_tls_set_ktls).
+ *
+ * @param connection The connection with TLS activated.
+ *
+ * @return axl_true if kernel TLS send offload is active, otherwise
+ * axl_false is returned.
+ */
+axl_bool            vortex_tls_is_ktls            (VortexConnection * connection)
+{
+#if defined(VORTEX_TLS_HAVE_KTLS)
+	SSL * ssl = vortex_tls_get_ssl_object (connection);
+
+	if (ssl == NULL)
+		return axl_false;
+	return BIO_get_ktls_send (SSL_get_wbio (ssl)) ? axl_true : axl_false;
+#else
+	return axl_false;
+#endif
+}
+
 /* @} */
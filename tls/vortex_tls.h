@@ -396,6 +396,11 @@ void               vortex_tls_set_auto_tls               (VortexCtx         * ct
 							  axl_bool            allow_tls_failures,
 							  const char        * serverName);
 
+void               vortex_tls_set_ktls                   (VortexCtx         * ctx,
+							  axl_bool            enable);
+
+axl_bool           vortex_tls_is_ktls                    (VortexConnection  * connection);
+
 axl_bool           vortex_tls_accept_negotiation         (VortexCtx         * ctx, 
 							  VortexTlsAcceptQuery            accept_handler, 
 							  VortexTlsCertificateFileLocator certificate_handler,
@@ -403,6 +408,17 @@ axl_bool           vortex_tls_accept_negotiation         (VortexCtx         * ct
 
 axlPointer         vortex_tls_get_ssl_object             (VortexConnection * connection);
 
+axlPointer         vortex_tls_get_session                (VortexConnection * connection);
+
+void               vortex_tls_set_session                (VortexConnection * connection,
+							  axlPointer         session);
+
+void               vortex_tls_session_free               (axlPointer         session);
+
+axl_bool           vortex_tls_session_reused             (VortexConnection * connection);
+
+void               vortex_tls_ctx_cache_flush            (VortexCtx        * ctx);
+
 char             * vortex_tls_get_peer_ssl_digest        (VortexConnection   * connection, 
 							  VortexDigestMethod   method);
 
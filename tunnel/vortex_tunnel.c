@@ -37,10 +37,31 @@
  */
 #include <vortex_tunnel.h>
 
+#if defined(__linux__)
+/* splice (2) is used to move octets between tunnel connections */
+#include <fcntl.h>
+#define VORTEX_TUNNEL_HAVE_SPLICE
+#endif
+
 #define LOG_DOMAIN "vortex-tunnel"
 
-#define VORTEX_TUNNEL_PARTNER_CONNECTION "vo:tu:con"
-#define VORTEX_TUNNEL_BUFFER             "vo:tu:buf"
+/* name of the connection slot holding the tunnel relay state */
+#define VORTEX_TUNNEL_RELAY              "vortex-tunnel:relay"
+
+/* max octets moved on each read and size of the buffer used when
+ * octets can't be spliced */
+#define VORTEX_TUNNEL_RELAY_SIZE         65536
+
+/* max reads done each time a tunnel connection is found ready */
+#define VORTEX_TUNNEL_RELAY_ROUNDS       16
+
+/* period (microseconds) to check again a tunnel connection whose
+ * partner doesn't accept more octets (only used when the output
+ * thread is not running) */
+#define VORTEX_TUNNEL_RELAY_RETRY        5000
+
+/* connection slot registered by vortex_tunnel_accept_negotiation */
+static int __vortex_tunnel_relay_slot = -1;
 
 /* key for the accept tunnel and the tunnel resolver handler */
 #define VORTEX_TUNNEL_ACCEPT             "vo:tu:ac"
@@ -67,6 +88,27 @@ struct _VortexTunnelSettings{
 	VortexConnectionOpts * options;
 };
 
+/** 
+ * @internal State used to move octets read from a tunnel connection
+ * (on a middle hop) into its partner.
+ */
+typedef struct _VortexTunnelRelay {
+	/* connection where octets read are written */
+	VortexConnection * partner;
+	/* buffer used when octets can't be spliced, holding octets
+	 * (from offset) not written yet to the partner */
+	char             * buffer;
+	int                offset;
+	int                pending;
+	/* pipe used to splice octets (-1 when not used) and octets
+	 * it holds not written yet to the partner */
+	int                pipe[2];
+	int                pipe_pending;
+	/* the connection was closed by the remote peer, pending
+	 * octets are written before closing the partner */
+	axl_bool           eof;
+} VortexTunnelRelay;
+
 /** 
  * @brief Allows to create a new tunnel setting, a proxy configuration
  * for any BEEP session to be created (\ref VortexConnection).
@@ -756,54 +798,352 @@ void __vortex_tunnel_prepare_listener (VortexConnection * connection)
 	return;
 }
 
+/** 
+ * @internal Creates the state to move octets read from source into
+ * partner. Octets are spliced through a pipe when both ends are plain
+ * TCP sockets (default send and receive handlers), otherwise a buffer
+ * is used.
+ */
+VortexTunnelRelay * __vortex_tunnel_relay_new (VortexConnection * source, VortexConnection * partner)
+{
+	VortexTunnelRelay * relay = axl_new (VortexTunnelRelay, 1);
+
+	relay->partner = partner;
+	relay->pipe[0] = -1;
+	relay->pipe[1] = -1;
+
+#if defined(VORTEX_TUNNEL_HAVE_SPLICE)
+	if (vortex_connection_is_default_receive (source) && vortex_connection_is_default_send (partner)) {
+		if (pipe2 (relay->pipe, O_NONBLOCK | O_CLOEXEC) != 0) {
+			relay->pipe[0] = -1;
+			relay->pipe[1] = -1;
+		} /* end if */
+	} /* end if */
+#endif
+
+	return relay;
+}
+
+/** 
+ * @internal Releases the pipe used to splice octets (if any).
+ */
+void __vortex_tunnel_relay_close_pipe (VortexTunnelRelay * relay)
+{
+	if (relay->pipe[0] != -1) {
+		close (relay->pipe[0]);
+		close (relay->pipe[1]);
+	} /* end if */
+	relay->pipe[0]      = -1;
+	relay->pipe[1]      = -1;
+	relay->pipe_pending = 0;
+	return;
+}
+
+/** 
+ * @internal Releases the relay state (installed as connection data).
+ */
+void __vortex_tunnel_relay_free (axlPointer _relay)
+{
+	VortexTunnelRelay * relay = _relay;
+
+	__vortex_tunnel_relay_close_pipe (relay);
+	axl_free (relay->buffer);
+	axl_free (relay);
+	return;
+}
+
+/** 
+ * @internal Writes, without blocking, octets pending on the relay
+ * into the partner.
+ *
+ * @return Octets still pending (the partner doesn't accept more) or
+ * -1 if the partner failed.
+ */
+int __vortex_tunnel_relay_flush (VortexTunnelRelay * relay)
+{
+	int written;
+
+#if defined(VORTEX_TUNNEL_HAVE_SPLICE)
+	while (relay->pipe_pending > 0) {
+		written = splice (relay->pipe[0], NULL, vortex_connection_get_socket (relay->partner), NULL,
+				  relay->pipe_pending, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+		if (written < 0) {
+			if (errno == VORTEX_EINTR)
+				continue;
+			if (errno == VORTEX_EAGAIN || errno == VORTEX_EWOULDBLOCK)
+				return relay->pipe_pending;
+			return -1;
+		} /* end if */
+
+		relay->pipe_pending -= written;
+		vortex_connection_set_receive_stamp (relay->partner, 0, written);
+	} /* end while */
+#endif
+
+	while (relay->pending > 0) {
+		written = vortex_connection_invoke_send (relay->partner, relay->buffer + relay->offset, relay->pending);
+		if (written < 0) {
+			if (errno == VORTEX_EINTR)
+				continue;
+			if (written == -2 || errno == VORTEX_EAGAIN || errno == VORTEX_EWOULDBLOCK)
+				return relay->pending;
+			return -1;
+		} /* end if */
+		if (written == 0)
+			return -1;
+
+		relay->offset  += written;
+		relay->pending -= written;
+		vortex_connection_set_receive_stamp (relay->partner, 0, written);
+	} /* end while */
+	relay->offset = 0;
+
+	return 0;
+}
+
+/** 
+ * @internal Reads octets available on source into the relay.
+ *
+ * @return Octets read, 0 if the remote peer closed, -1 on error and
+ * -2 if nothing is available.
+ */
+int __vortex_tunnel_relay_read (VortexConnection * source, VortexTunnelRelay * relay)
+{
+	int read;
+
+#if defined(VORTEX_TUNNEL_HAVE_SPLICE)
+	/* octets already read by the connection must go first */
+	if (relay->pipe[0] != -1 && vortex_frame_input_pending (source) == 0) {
+		do {
+			read = splice (vortex_connection_get_socket (source), NULL, relay->pipe[1], NULL,
+				       VORTEX_TUNNEL_RELAY_SIZE, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+		} while (read < 0 && errno == VORTEX_EINTR);
+
+		if (read > 0) {
+			relay->pipe_pending += read;
+			vortex_connection_set_receive_stamp (source, read, 0);
+			return read;
+		} /* end if */
+		if (read == 0)
+			return 0;
+		if (errno == VORTEX_EAGAIN || errno == VORTEX_EWOULDBLOCK)
+			return -2;
+		if (errno != EINVAL)
+			return -1;
+
+		/* splice not supported for these sockets, use the
+		 * buffer from now on */
+		__vortex_tunnel_relay_close_pipe (relay);
+	} /* end if */
+#endif
+
+	if (relay->buffer == NULL)
+		relay->buffer = axl_new (char, VORTEX_TUNNEL_RELAY_SIZE + 1);
+
+	/* serve octets already read by the connection */
+	if (vortex_frame_input_pending (source) > 0) 
+		read = vortex_frame_receive_raw (source, relay->buffer, VORTEX_TUNNEL_RELAY_SIZE);
+	else {
+		do {
+			read = vortex_connection_invoke_receive (source, relay->buffer, VORTEX_TUNNEL_RELAY_SIZE);
+		} while (read < 0 && errno == VORTEX_EINTR);
+		if (read > 0)
+			vortex_connection_set_receive_stamp (source, read, 0);
+		else if (read == -2 || (read < 0 && (errno == VORTEX_EAGAIN || errno == VORTEX_EWOULDBLOCK)))
+			read = -2;
+	} /* end if */
+
+	if (read > 0)
+		relay->pending = read;
+	return read;
+}
+
+/** 
+ * @internal Moves octets from source into its partner until source
+ * has nothing more to read (or a max of rounds is reached), the
+ * partner doesn't accept more octets or some of them fails.
+ *
+ * @return 0 if the source must be watched again, 1 if the partner
+ * doesn't accept more octets (the relay is holding them) or -1 if
+ * both connections must be closed.
+ */
+int __vortex_tunnel_relay_pump (VortexConnection * source, VortexTunnelRelay * relay)
+{
+	int rounds = 0;
+	int result;
+
+	while (axl_true) {
+		/* write pending octets first */
+		result = __vortex_tunnel_relay_flush (relay);
+		if (result < 0)
+			return -1;
+		if (result > 0)
+			return 1;
+
+		/* remote peer closed and everything was written */
+		if (relay->eof)
+			return -1;
+
+		if (rounds == VORTEX_TUNNEL_RELAY_ROUNDS)
+			return 0;
+		rounds++;
+
+		result = __vortex_tunnel_relay_read (source, relay);
+		if (result == -2)
+			return 0;
+		if (result == 0)
+			relay->eof = axl_true;
+		else if (result < 0)
+			return -1;
+	} /* end while */
+
+	return -1;
+}
+
+/** 
+ * @internal Closes both connections of a tunnel hop.
+ */
+void __vortex_tunnel_relay_close (VortexConnection * source, VortexTunnelRelay * relay)
+{
+#if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
+	VortexCtx        * ctx     = vortex_connection_get_ctx (source);
+#endif
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "TUNNEL, connection(%s:%s) finished, closing tunnel hop", 
+		    vortex_connection_get_host (source),
+		    vortex_connection_get_port (source));
+
+	vortex_connection_shutdown (source);
+	vortex_connection_shutdown (relay->partner);
+	return;
+}
+
+/** 
+ * @internal Keeps on moving octets from a connection whose partner
+ * didn't accept more, while the source is not watched by the vortex
+ * reader. Once the partner accepts all octets and the source has
+ * nothing more to read, it is watched again (readers are woken up so
+ * it doesn't wait for their I/O wait to time out).
+ *
+ * @return axl_false if the partner still doesn't accept more octets,
+ * otherwise axl_true is returned (references acquired while the
+ * source was blocked are released).
+ */
+axl_bool __vortex_tunnel_relay_continue (VortexConnection * source, VortexTunnelRelay * relay)
+{
+	VortexConnection  * partner = relay->partner;
+	int                 result  = -1;
+
+	if (vortex_connection_is_ok (source, axl_false) && vortex_connection_is_ok (partner, axl_false))
+		result = __vortex_tunnel_relay_pump (source, relay);
+
+	/* partner still full */
+	if (result == 1)
+		return axl_false;
+
+	if (result == 0)
+		vortex_connection_block_nowait (source, axl_false);
+	else
+		__vortex_tunnel_relay_close (source, relay);
+
+	/* release references acquired while the source was blocked */
+	vortex_connection_unref (partner, "tunnel relay");
+	vortex_connection_unref (source, "tunnel relay");
+	return axl_true;
+}
+
+/** 
+ * @internal Event used to check again a relay whose partner didn't
+ * accept more octets when the output thread is not available to
+ * notify it.
+ */
+axl_bool __vortex_tunnel_relay_resume (VortexCtx * ctx, axlPointer _source, axlPointer _relay)
+{
+	/* partner still full, check later */
+	return __vortex_tunnel_relay_continue (_source, _relay);
+}
+
+void __vortex_tunnel_relay_wait (VortexConnection * source, VortexTunnelRelay * relay);
+
+/** 
+ * @internal Write readiness handler installed on the partner of a
+ * relay (see __vortex_tunnel_relay_wait).
+ */
+void __vortex_tunnel_relay_writable (VortexConnection * partner, axlPointer _source)
+{
+	VortexConnection  * source = _source;
+	VortexTunnelRelay * relay  = vortex_connection_get_slot (source, __vortex_tunnel_relay_slot);
+
+	if (! __vortex_tunnel_relay_continue (source, relay))
+		__vortex_tunnel_relay_wait (source, relay);
+	return;
+}
+
+/** 
+ * @internal Waits for the partner of a relay to accept the octets
+ * held. The partner is watched by the output thread, which notifies
+ * once its socket is writable. If the output thread is not running
+ * (see VORTEX_ASYNC_WRITES) the relay is checked periodically.
+ */
+void __vortex_tunnel_relay_wait (VortexConnection * source, VortexTunnelRelay * relay)
+{
+	VortexCtx * ctx = vortex_connection_get_ctx (source);
+
+	if (vortex_sequencer_watch_writable (ctx, relay->partner, __vortex_tunnel_relay_writable, source))
+		return;
+
+	vortex_thread_pool_new_event (ctx, VORTEX_TUNNEL_RELAY_RETRY, __vortex_tunnel_relay_resume, source, relay);
+	return;
+}
+
 /** 
  * @internal Then function that takes data from one connection and
  * write them into the partner connection.
+ *
+ * Writes never block the vortex reader: if the partner doesn't
+ * accept more octets, the connection is not watched (so no more
+ * octets are read from it) until the partner accepts those pending.
  * 
  * @param connection The connection that was notified to have data to
  * be read.
  */
 void __vortex_tunnel_pass_octets (VortexConnection * connection)
 {
-	/* get the connection partner */
-	VortexConnection * partner = vortex_connection_get_data (connection, VORTEX_TUNNEL_PARTNER_CONNECTION);
-	char             * buffer  = vortex_connection_get_data (connection, VORTEX_TUNNEL_BUFFER);
+	/* get the relay state (partner and octets pending) */
+	VortexTunnelRelay * relay  = vortex_connection_get_slot (connection, __vortex_tunnel_relay_slot);
 #if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
-	VortexCtx        * ctx     = vortex_connection_get_ctx (connection);
+	VortexCtx         * ctx    = vortex_connection_get_ctx (connection);
 #endif
-	int                read;
 
-	/* read data from the connection, and write it directly on the
-	 * connection partner */
-	read = vortex_frame_receive_raw (connection, buffer, VORTEX_MAX_BUFFER_SIZE - 2);
+	if (relay == NULL)
+		return;
 
-	/* check data read */
-	if (read == 0) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "TUNNEL, nothing read from the connection(%s:%s) close connection", 
+	switch (__vortex_tunnel_relay_pump (connection, relay)) {
+	case 0:
+		/* nothing more to do over here */
+		return;
+	case 1:
+		vortex_log (VORTEX_LEVEL_DEBUG, "TUNNEL, partner connection(%s:%s) is full, stop reading from %s:%s",
+			    vortex_connection_get_host (relay->partner),
+			    vortex_connection_get_port (relay->partner),
 			    vortex_connection_get_host (connection),
 			    vortex_connection_get_port (connection));
-		
-		/* close connections */
-		vortex_connection_shutdown (connection);
-		vortex_connection_shutdown (partner);
-		return;
-	}
 
-	/* buffer[read] = 0; */
-	vortex_log (VORTEX_LEVEL_DEBUG, "TUNNEL, passing octects (%s:%s --> %s:%s): %d", 
-		    vortex_connection_get_host (connection),
-		    vortex_connection_get_port (connection),
-		    vortex_connection_get_host (partner),
-		    vortex_connection_get_port (partner),
-		    read);
-
-	/* write data to the partner connection */
-	if (! vortex_frame_send_raw (partner, buffer, read)) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "failed to write data, seems connection is broken");
-	}
-	
-	/* there is nothing more to do over here */
-	return;
+		/* stop reading until the partner accepts octets
+		 * pending */
+		if (! vortex_connection_ref (connection, "tunnel relay"))
+			return;
+		if (! vortex_connection_ref (relay->partner, "tunnel relay")) {
+			vortex_connection_unref (connection, "tunnel relay");
+			return;
+		} /* end if */
+		vortex_connection_block_nowait (connection, axl_true);
+		__vortex_tunnel_relay_wait (connection, relay);
+		return;
+	default:
+		__vortex_tunnel_relay_close (connection, relay);
+		return;
+	} /* end switch */
 }
 
 /** 
@@ -825,7 +1165,6 @@ axl_bool  __vortex_tunnel_start_request (const char       * profile,
 	axlError               * error;
 	VortexConnection       * new_connection;
 	VortexTunnelSettings   * settings = NULL;
-	char                   * buffer;
 	axl_bool                 result;
 	VortexCtx              * ctx;
 	
@@ -984,16 +1323,11 @@ axl_bool  __vortex_tunnel_start_request (const char       * profile,
 
 		/* nice we have created the tunnel, now prepare both
 		 * connections to be handled by the vortex pre read
-		 * functions */
-		vortex_connection_set_data (connection,     VORTEX_TUNNEL_PARTNER_CONNECTION, new_connection);
-		vortex_connection_set_data (new_connection, VORTEX_TUNNEL_PARTNER_CONNECTION, connection);
-		
-		/* allocate buffers */
-		buffer = axl_new (char, VORTEX_MAX_BUFFER_SIZE);
-		vortex_connection_set_data_full (connection,     VORTEX_TUNNEL_BUFFER, buffer, NULL, axl_free);
-
-		buffer = axl_new (char, VORTEX_MAX_BUFFER_SIZE);
-		vortex_connection_set_data_full (new_connection, VORTEX_TUNNEL_BUFFER, buffer, NULL, axl_free);
+		 * functions (each one relaying octets to the other) */
+		vortex_connection_set_slot (connection,     __vortex_tunnel_relay_slot, 
+					    __vortex_tunnel_relay_new (connection, new_connection), __vortex_tunnel_relay_free);
+		vortex_connection_set_slot (new_connection, __vortex_tunnel_relay_slot, 
+					    __vortex_tunnel_relay_new (new_connection, connection), __vortex_tunnel_relay_free);
 		
 		/* configure the pre read handlers */
 		vortex_connection_set_preread_handler (connection,     __vortex_tunnel_pass_octets);
@@ -1043,6 +1377,13 @@ axl_bool               vortex_tunnel_accept_negotiation (VortexCtx
 							 VortexOnAcceptedConnection   accept_tunnel,
 							 axlPointer                   accept_tunnel_data)
 {
+	/* register the connection slot used to relay octets */
+	__vortex_tunnel_relay_slot = vortex_connection_slot_register (VORTEX_TUNNEL_RELAY);
+	if (__vortex_tunnel_relay_slot == -1) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to register TUNNEL connection slot, unable to activate TUNNEL profile");
+		return axl_false;
+	} /* end if */
+
 	/* configure handlers */
 	vortex_ctx_set_data (ctx, VORTEX_TUNNEL_ACCEPT, accept_tunnel);
 	vortex_ctx_set_data (ctx, VORTEX_TUNNEL_ACCEPT_DATA, accept_tunnel_data);
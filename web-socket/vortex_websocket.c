@@ -96,6 +96,9 @@ void __vortex_websocket_nopoll_on_close (noPollCtx * _ctx, noPollConn * conn, no
 	return;
 }
 
+/* connection slot holding the mutex that protects the noPollConn */
+int __vortex_websocket_mutex_slot = -1;
+
 /* call to check and init library */
 axl_bool __vortex_websocket_was_init = axl_false;
 void __vortex_websocket_check_and_init (void) {
@@ -104,6 +107,9 @@ void __vortex_websocket_check_and_init (void) {
 	if (__vortex_websocket_was_init)
 		return;
 
+	/* register connection slot used by the I/O handlers */
+	__vortex_websocket_mutex_slot = vortex_connection_slot_register ("vortex-websocket:mutex");
+
 	/* configure handlers */
 	nopoll_thread_handlers (__vortex_websocket_mutex_create, 
 				__vortex_websocket_mutex_destroy,
@@ -376,7 +382,7 @@ int vortex_websocket_read (VortexConnection * conn,
 		_conn = vortex_connection_get_data (conn, "nopoll-conn");
 
 	/* get mutex */
-	mutex = vortex_connection_get_data (conn, "ws:mutex");
+	mutex = vortex_connection_get_slot (conn, __vortex_websocket_mutex_slot);
 	if (mutex == NULL) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find mutex to protect ssl object to read data");
 		return -1;
@@ -416,7 +422,7 @@ int vortex_websocket_read (VortexConnection * conn,
 	 * Set unconditionally, including when nothing is pending, so the flag
 	 * always describes the transport right now instead of staying raised
 	 * from an earlier read. */
-	vortex_connection_set_data (conn, "try_read_pending", INT_TO_PTR (nopoll_conn_read_pending (_conn)));
+	vortex_connection_set_pending_input (conn, nopoll_conn_read_pending (_conn));
 	  
 	
 	return result;
@@ -437,7 +443,7 @@ int vortex_websocket_send (VortexConnection * conn,
 		_conn = vortex_connection_get_data (conn, "nopoll-conn");
 
 	/* get mutex */
-	mutex = vortex_connection_get_data (conn, "ws:mutex");
+	mutex = vortex_connection_get_slot (conn, __vortex_websocket_mutex_slot);
 	if (mutex == NULL) {
 		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to find mutex to protect ssl object to read data");
 		return -1;
@@ -601,8 +607,8 @@ axlPointer __vortex_websocket_connection_new (VortexWebsocketConnectionData * da
 	/* setup I/O handlers */
 	mutex = axl_new (VortexMutex, 1);
 	vortex_mutex_create (mutex);
-	vortex_connection_set_data_full (conn, "ws:mutex", mutex,
-					 NULL, (axlDestroyFunc) __vortex_websocket_free_mutex);
+	vortex_connection_set_slot (conn, __vortex_websocket_mutex_slot, mutex,
+				    (axlDestroyFunc) __vortex_websocket_free_mutex);
 
 	vortex_connection_set_send_handler (conn, vortex_websocket_send);
 	vortex_connection_set_receive_handler (conn, vortex_websocket_read);
@@ -805,8 +811,8 @@ void __vortex_websocket_setup_listener_connection (VortexConnection * new_conn,
 	/* setup I/O handlers */
 	mutex = axl_new (VortexMutex, 1);
 	vortex_mutex_create (mutex);
-	vortex_connection_set_data_full (new_conn, "ws:mutex", mutex,
-					 NULL, (axlDestroyFunc) __vortex_websocket_free_mutex);
+	vortex_connection_set_slot (new_conn, __vortex_websocket_mutex_slot, mutex,
+				    (axlDestroyFunc) __vortex_websocket_free_mutex);
 
 	vortex_connection_set_send_handler (new_conn, vortex_websocket_send);
 	vortex_connection_set_receive_handler (new_conn, vortex_websocket_read);
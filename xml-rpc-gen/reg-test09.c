@@ -0,0 +1,118 @@
+/* Hey emacs, show me this like 'c': -*- c -*-
+ *
+ * Test files for the xml-rpc-gen tool.
+ * Copyright (C) 2026 Advanced Software Production Line, S.L.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation; either version 2 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+ * USA.
+ */
+
+/* client for reg-test09.idl, generated with --direct-marshall */
+#include <test_xml_rpc.h>
+#include <_support.h>
+
+int  main (int  argc, char  ** argv)
+{
+
+	VortexChannel        * channel;
+	XmlRpcResponseStatus   status;
+	Values               * a;
+	Values               * b;
+	Values               * values;
+	ItemArray            * array;
+	Item                 * item;
+	Node                 * node;
+	Node                 * result;
+	int                    iterator;
+
+	/* starts the vortex engine and create the XML-RPC channel,
+	 * checking the result */
+	channel = start_and_create_channel ();
+	v_return_val_if_fail (channel, -1);
+
+	/* struct params and struct reply */
+	a      = test_values_new (3, 10.2, axl_false);
+	b      = test_values_new (7, 7.12, axl_true);
+	values = test_get_struct_values_values_s (a, b, channel, &status, NULL, NULL);
+	if (values == NULL || status != XML_RPC_OK) {
+		fprintf (stderr, "Expected to receive a struct from get_struct\n");
+		return -1;
+	}
+	if (values->count != 10 || values->fraction != 17.32 || ! values->status) {
+		fprintf (stderr, "Unexpected struct content received: count=%d, fraction=%g, status=%d\n",
+			 values->count, values->fraction, values->status);
+		return -1;
+	}
+	test_values_free (a);
+	test_values_free (b);
+	test_values_free (values);
+
+	/* array of structs reply */
+	array = test_get_array_s (channel, &status, NULL, NULL);
+	if (array == NULL || status != XML_RPC_OK || test_itemarray_count (array) != 10) {
+		fprintf (stderr, "Expected to receive an array with 10 items from get_array\n");
+		return -1;
+	}
+	for (iterator = 0; iterator < 10; iterator++) {
+		item = test_itemarray_get (array, iterator);
+		if (item == NULL || item->position != iterator || ! axl_cmp (item->string_position, "test content")) {
+			fprintf (stderr, "Unexpected item found at position %d\n", iterator);
+			return -1;
+		}
+	}
+	test_itemarray_free (array);
+
+	/* empty array reply */
+	array = test_get_empty_array_s (channel, &status, NULL, NULL);
+	if (array == NULL || status != XML_RPC_OK || test_itemarray_count (array) != 0) {
+		fprintf (stderr, "Expected to receive an empty array from get_empty_array\n");
+		return -1;
+	}
+	test_itemarray_free (array);
+
+	/* nested struct reply */
+	result = test_get_list_s (channel, &status, NULL, NULL);
+	if (result == NULL || status != XML_RPC_OK) {
+		fprintf (stderr, "Expected to receive a non NULL result from get_list\n");
+		return -1;
+	}
+	node = result;
+	for (iterator = 1; iterator < 10; iterator++) {
+		if (node == NULL || node->position != iterator) {
+			fprintf (stderr, "Unexpected node found at position %d\n", iterator);
+			return -1;
+		}
+		node = node->next;
+	}
+	if (node != NULL) {
+		fprintf (stderr, "Expected to find the list terminated by a none value\n");
+		return -1;
+	}
+	test_node_free (result);
+
+	/* none reply: NULL result but not a failure */
+	result = test_get_none_s (channel, &status, NULL, NULL);
+	if (result != NULL || status != XML_RPC_OK) {
+		fprintf (stderr, "Expected to receive a none reply with XML_RPC_OK status from get_none (status=%d)\n", status);
+		return -1;
+	}
+
+	/* stop the test */
+	close_channel_and_stop (channel);
+
+	printf ("09: test ok\n");
+
+	return 0;
+}
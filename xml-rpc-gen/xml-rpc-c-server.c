@@ -872,6 +872,9 @@ void xml_rpc_c_server_create_write_service (axlNode * service,
 	char    * comp_name_lower;
 	char    * service_name_upper;
 
+	/* struct and array results are marshalled directly */
+	axl_bool  direct_result;
+
 	/* get service name */
 	aux          = axl_node_get_child_nth (service, 0);
 	service_name = axl_node_get_content_trim (aux, NULL);
@@ -886,6 +889,8 @@ void xml_rpc_c_server_create_write_service (axlNode * service,
 	aux               = axl_node_get_next (aux);
 	return_type       = axl_node_get_content_trim (aux, NULL);
 	return_type_lower = xml_rpc_support_to_lower (return_type);
+	direct_result     = exarg_is_defined ("direct-marshall") &&
+		(xml_rpc_c_stub_type_is_array (doc, return_type) || xml_rpc_c_stub_type_is_struct (doc, return_type));
 
 	/* check if the service is inside a resource or next node is
 	 * the params */
@@ -1068,7 +1073,9 @@ void xml_rpc_c_server_create_write_service (axlNode * service,
 	else
 		xml_rpc_support_sl_write ("   result;\n\n");
 
-	if (xml_rpc_c_stub_type_is_array (doc, return_type))
+	if (direct_result)
+		xml_rpc_support_write ("XmlRpcWriter * _writer_;\n");
+	else if (xml_rpc_c_stub_type_is_array (doc, return_type))
 		xml_rpc_support_write ("XmlRpcArray * _result;\n");
 	else if (xml_rpc_c_stub_type_is_struct (doc, return_type))
 		xml_rpc_support_write ("XmlRpcStruct * _result;\n");
@@ -1133,39 +1140,50 @@ void xml_rpc_c_server_create_write_service (axlNode * service,
 	}
 
 
-	/* write unmarshalling code for array and structs */
-	if (xml_rpc_c_stub_type_is_array (doc, return_type) ||
-	    xml_rpc_c_stub_type_is_struct (doc, return_type)) {
-		xml_rpc_support_write ("/* Translate structure returned by the service */\n");
-		xml_rpc_support_write ("_result = %s_%s_marshall (ctx, result, axl_true);\n\n",
-				       comp_name_lower, return_type_lower);
-	}
+	/* write direct marshalling code for array and structs */
+	if (direct_result) {
+		xml_rpc_support_write ("/* Marshall structure returned by the service directly */\n");
+		xml_rpc_support_write ("_writer_ = vortex_xml_rpc_writer_new (0);\n");
+		xml_rpc_support_write ("%s_%s_write (_writer_, result);\n", comp_name_lower, return_type_lower);
+		xml_rpc_support_write ("%s_%s_free (result);\n\n", comp_name_lower, return_type_lower);
+		xml_rpc_support_multiple_write ("/* return reply generated */\n",
+						"return vortex_xml_rpc_method_response_new_from_writer (_writer_);\n",
+						NULL);
+	} else {
+		/* write unmarshalling code for array and structs */
+		if (xml_rpc_c_stub_type_is_array (doc, return_type) ||
+		    xml_rpc_c_stub_type_is_struct (doc, return_type)) {
+			xml_rpc_support_write ("/* Translate structure returned by the service */\n");
+			xml_rpc_support_write ("_result = %s_%s_marshall (ctx, result, axl_true);\n\n",
+					       comp_name_lower, return_type_lower);
+		}
 
-	xml_rpc_support_multiple_write ("/* return reply generated */\n",
-					"return CREATE_OK_REPLY (ctx, ", 
-					NULL);
+		xml_rpc_support_multiple_write ("/* return reply generated */\n",
+						"return CREATE_OK_REPLY (ctx, ", 
+						NULL);
 
-	/* write the variable that will hold the value */
-	if (axl_cmp (return_type, "int"))
-		xml_rpc_support_sl_write ("XML_RPC_INT_VALUE, INT_TO_PTR (result));\n");
+		/* write the variable that will hold the value */
+		if (axl_cmp (return_type, "int"))
+			xml_rpc_support_sl_write ("XML_RPC_INT_VALUE, INT_TO_PTR (result));\n");
 
-	if (axl_cmp (return_type, "double"))
-		xml_rpc_support_sl_write ("XML_RPC_DOUBLE_VALUE, &result);\n");
+		if (axl_cmp (return_type, "double"))
+			xml_rpc_support_sl_write ("XML_RPC_DOUBLE_VALUE, &result);\n");
 
-	if (axl_cmp (return_type, "bool"))
-		xml_rpc_support_sl_write ("XML_RPC_BOOLEAN_VALUE, INT_TO_PTR (result));\n");
+		if (axl_cmp (return_type, "bool"))
+			xml_rpc_support_sl_write ("XML_RPC_BOOLEAN_VALUE, INT_TO_PTR (result));\n");
 
-	if (axl_cmp (return_type, "string"))
-		xml_rpc_support_sl_write ("XML_RPC_STRING_REF_VALUE, result);\n");
+		if (axl_cmp (return_type, "string"))
+			xml_rpc_support_sl_write ("XML_RPC_STRING_REF_VALUE, result);\n");
 
-	if (axl_cmp (return_type, "base64"))
-		xml_rpc_support_sl_write ("XML_RPC_BASE64_REF_VALUE, result);\n");
+		if (axl_cmp (return_type, "base64"))
+			xml_rpc_support_sl_write ("XML_RPC_BASE64_REF_VALUE, result);\n");
 
-	if (xml_rpc_c_stub_type_is_struct (doc, return_type))
-		xml_rpc_support_sl_write ("XML_RPC_STRUCT_VALUE, _result);\n");
+		if (xml_rpc_c_stub_type_is_struct (doc, return_type))
+			xml_rpc_support_sl_write ("XML_RPC_STRUCT_VALUE, _result);\n");
 
-	if (xml_rpc_c_stub_type_is_array (doc, return_type))
-		xml_rpc_support_sl_write ("XML_RPC_ARRAY_VALUE, _result);\n");
+		if (xml_rpc_c_stub_type_is_array (doc, return_type))
+			xml_rpc_support_sl_write ("XML_RPC_ARRAY_VALUE, _result);\n");
+	} /* end if */
 	
 
 	/* restore the indent and close the function */
@@ -287,6 +287,50 @@ void xml_rpc_support_write_method_create_values (axlDoc * doc, axlNode * aux, ch
 	return;
 }
 
+/** 
+ * @internal
+ *
+ * Writes to the stub body file the instructions that marshall the
+ * method call parameters directly through a XmlRpcWriter (direct
+ * marshalling mode).
+ * 
+ * @param aux The \ref axlNode reference pointing to the params value.
+ */
+void xml_rpc_support_write_method_direct_values (axlDoc * doc, axlNode * aux, char  * comp_name)
+{
+	axlNode    * param;
+	const char * type;
+	const char * name;
+	char       * comp_name_lower;
+
+	/* nothing to write if the service have no parameters */
+	if (! axl_node_have_childs (aux))
+		return;
+
+	comp_name_lower = xml_rpc_support_to_lower (comp_name);
+
+	xml_rpc_support_multiple_write ("/* marshall parameters directly */\n",
+					"_writer_ = vortex_xml_rpc_writer_new (0);\n",
+					NULL);
+
+	param = axl_node_get_child_nth (aux, 0);
+	do {
+		/* get the parameter name and type */
+		name = axl_node_get_content_trim (axl_node_get_child_nth (param, 0), NULL);
+		type = axl_node_get_content_trim (axl_node_get_child_nth (param, 1), NULL);
+
+		xml_rpc_support_write ("vortex_xml_rpc_writer_param_open (_writer_);\n");
+		xml_rpc_c_stub_write_direct_value (doc, comp_name_lower, type, name);
+		xml_rpc_support_write ("vortex_xml_rpc_writer_param_close (_writer_);\n");
+
+	}while ((param = axl_node_get_next (param)) != NULL);
+
+	xml_rpc_support_write ("vortex_xml_rpc_method_call_set_writer (_invocator_, _writer_);\n\n");
+
+	axl_free (comp_name_lower);
+	return;
+}
+
 /** 
  * @internal
  * 
@@ -603,6 +647,246 @@ void xml_rpc_c_stub_write_struct_checkings (axlNode * _struct)
 	return;
 }
 
+/** 
+ * @internal
+ *
+ * Writes the sentence that marshalls the provided expression,
+ * holding the provided type, directly into the _writer_ variable
+ * (direct marshalling mode).
+ *
+ * @param doc The XML document that describes the interface.
+ *
+ * @param comp_name_lower The component name (lower case).
+ *
+ * @param type The type name hold by the expression.
+ *
+ * @param expr The expression to marshall.
+ */
+void xml_rpc_c_stub_write_direct_value (axlDoc * doc, const char * comp_name_lower, const char * type, const char * expr)
+{
+	char * type_lower;
+
+	if (axl_cmp (type, "int"))
+		xml_rpc_support_write ("vortex_xml_rpc_writer_int (_writer_, %s);\n", expr);
+	else if (axl_cmp (type, "bool"))
+		xml_rpc_support_write ("vortex_xml_rpc_writer_boolean (_writer_, %s);\n", expr);
+	else if (axl_cmp (type, "double"))
+		xml_rpc_support_write ("vortex_xml_rpc_writer_double (_writer_, %s);\n", expr);
+	else if (axl_cmp (type, "string"))
+		xml_rpc_support_write ("vortex_xml_rpc_writer_string (_writer_, %s);\n", expr);
+	else if (axl_cmp (type, "base64"))
+		xml_rpc_support_write ("vortex_xml_rpc_writer_base64 (_writer_, %s);\n", expr);
+	else if (xml_rpc_c_stub_type_is_struct (doc, type) || xml_rpc_c_stub_type_is_array (doc, type)) {
+		type_lower = xml_rpc_support_to_lower (type);
+		xml_rpc_support_write ("%s_%s_write (_writer_, %s);\n", comp_name_lower, type_lower, expr);
+		axl_free (type_lower);
+	} /* end if */
+
+	return;
+}
+
+/** 
+ * @internal
+ *
+ * Writes the condition that unmarshalls the next value, holding the
+ * provided type, from the _reader_ variable into the provided
+ * reference (direct marshalling mode).
+ *
+ * @param doc The XML document that describes the interface.
+ *
+ * @param comp_name_lower The component name (lower case).
+ *
+ * @param type The type name to read.
+ *
+ * @param ref The reference where the value is placed.
+ */
+void xml_rpc_c_stub_write_direct_read (axlDoc * doc, const char * comp_name_lower, const char * type, const char * ref)
+{
+	char * type_lower;
+
+	if (axl_cmp (type, "int") || axl_cmp (type, "bool"))
+		xml_rpc_support_write ("if (! vortex_xml_rpc_reader_int (_reader_, &%s))\n", ref);
+	else if (axl_cmp (type, "double"))
+		xml_rpc_support_write ("if (! vortex_xml_rpc_reader_double (_reader_, &%s))\n", ref);
+	else if (axl_cmp (type, "string") || axl_cmp (type, "base64")) {
+		/* release a previous value (repeated member) */
+		xml_rpc_support_write ("axl_free (%s);\n", ref);
+		xml_rpc_support_write ("%s = NULL;\n", ref);
+		xml_rpc_support_write ("if (! vortex_xml_rpc_reader_string (_reader_, &%s))\n", ref);
+	} else {
+		type_lower = xml_rpc_support_to_lower (type);
+
+		/* release a previous value (repeated member) */
+		xml_rpc_support_write ("%s_%s_free (%s);\n", comp_name_lower, type_lower, ref);
+		xml_rpc_support_write ("%s = NULL;\n", ref);
+		xml_rpc_support_write ("if (! %s_%s_read (_reader_, &%s))\n", comp_name_lower, type_lower, ref);
+		axl_free (type_lower);
+	} /* end if */
+	xml_rpc_support_write ("\tgoto failed;\n");
+
+	return;
+}
+
+/** 
+ * @internal
+ *
+ * Writes the reply reader for the provided type
+ * (<comp>_<type>_reply_reader), which has the exact \ref
+ * XmlRpcReplyReader signature and calls <comp>_<type>_read, so it
+ * can be installed with vortex_xml_rpc_method_call_set_reply_reader
+ * without casting the function.
+ *
+ * @param comp_name_lower The component name (lower case).
+ *
+ * @param name The struct or array name.
+ *
+ * @param name_lower The struct or array name (lower case).
+ */
+void xml_rpc_c_stub_write_reply_reader (const char * comp_name_lower,
+					const char * name,
+					const char * name_lower)
+{
+	write ("axl_bool %s_%s_reply_reader (XmlRpcReader * _reader_, axlPointer * result)\n{\n",
+	       comp_name_lower, name_lower);
+	push_indent ();
+
+	write ("%s * _value = NULL;\n", name);
+	write ("axl_bool _ok;\n\n");
+	write ("_ok         = %s_%s_read (_reader_, &_value);\n", comp_name_lower, name_lower);
+	xml_rpc_support_multiple_write ("(* result) = _value;\n",
+					"return _ok;\n",
+					NULL);
+	pop_indent ();
+	write ("}\n\n");
+
+	return;
+}
+
+/** 
+ * @internal
+ *
+ * Writes the direct marshalling functions for the struct provided
+ * (<comp>_<struct>_write and <comp>_<struct>_read), which translate
+ * the native struct from/to its XML-RPC representation without
+ * creating XmlRpcStruct objects.
+ */
+void xml_rpc_c_stub_write_struct_direct (axlDoc     * doc,
+					 const char * comp_name_lower,
+					 const char * struct_name,
+					 const char * struct_lower,
+					 axlNode    * _struct)
+{
+	axlNode    * member;
+	const char * _name;
+	const char * type;
+	char       * expr;
+	axl_bool     first;
+
+	/* write the direct marshaller */
+	write ("void %s_%s_write (XmlRpcWriter * _writer_, %s * ref)\n{\n",
+	       comp_name_lower, struct_lower, struct_name);
+	push_indent ();
+
+	xml_rpc_support_multiple_write ("/* write a none value for NULL references */\n",
+					"if (ref == NULL) {\n",
+					"\tvortex_xml_rpc_writer_none (_writer_);\n",
+					"\treturn;\n",
+					"}\n\n",
+					"vortex_xml_rpc_writer_struct_open (_writer_);\n\n",
+					NULL);
+
+	member = axl_node_get_child_nth (_struct, 1);
+	do {
+		_name = axl_node_get_content_trim (axl_node_get_child_nth (member, 0), NULL);
+		type  = axl_node_get_content_trim (axl_node_get_child_nth (member, 1), NULL);
+
+		write ("/* %s member */\n", _name);
+		write ("vortex_xml_rpc_writer_member (_writer_, \"%s\");\n", _name);
+		expr = axl_strdup_printf ("ref->%s", _name);
+		xml_rpc_c_stub_write_direct_value (doc, comp_name_lower, type, expr);
+		axl_free (expr);
+		write ("vortex_xml_rpc_writer_member_close (_writer_);\n\n");
+
+	}while ((member = axl_node_get_next (member)) != NULL);
+
+	xml_rpc_support_multiple_write ("vortex_xml_rpc_writer_struct_close (_writer_);\n",
+					"return;\n",
+					NULL);
+	pop_indent ();
+	write ("}\n\n");
+
+	/* write the direct unmarshaller */
+	write ("axl_bool %s_%s_read (XmlRpcReader * _reader_, %s ** result)\n{\n",
+	       comp_name_lower, struct_lower, struct_name);
+	push_indent ();
+
+	write ("%s * _result;\n", struct_name);
+	xml_rpc_support_multiple_write ("const char * _name;\n",
+					"axl_bool     _is_none;\n\n",
+					"(* result) = NULL;\n",
+					"if (! vortex_xml_rpc_reader_struct_open (_reader_, &_is_none))\n",
+					"\treturn axl_false;\n",
+					"if (_is_none)\n",
+					"\treturn axl_true;\n\n",
+					NULL);
+	write ("_result = axl_new (%s, 1);\n", struct_name);
+	write ("while (axl_true) {\n");
+	push_indent ();
+
+	xml_rpc_support_multiple_write ("/* get next member */\n",
+					"if (! vortex_xml_rpc_reader_struct_next (_reader_, &_name))\n",
+					"\tgoto failed;\n",
+					"if (_name == NULL)\n",
+					"\tbreak;\n\n",
+					NULL);
+
+	member = axl_node_get_child_nth (_struct, 1);
+	first  = axl_true;
+	do {
+		_name = axl_node_get_content_trim (axl_node_get_child_nth (member, 0), NULL);
+		type  = axl_node_get_content_trim (axl_node_get_child_nth (member, 1), NULL);
+
+		if (first)
+			write ("if (axl_cmp (_name, \"%s\")) {\n", _name);
+		else
+			write ("} else if (axl_cmp (_name, \"%s\")) {\n", _name);
+		first = axl_false;
+
+		push_indent ();
+		expr = axl_strdup_printf ("_result->%s", _name);
+		xml_rpc_c_stub_write_direct_read (doc, comp_name_lower, type, expr);
+		axl_free (expr);
+		pop_indent ();
+
+	}while ((member = axl_node_get_next (member)) != NULL);
+
+	xml_rpc_support_multiple_write ("} else if (! vortex_xml_rpc_reader_skip (_reader_)) {\n",
+					"\t/* unknown member */\n",
+					"\tgoto failed;\n",
+					"} /* end if */\n\n",
+					"if (! vortex_xml_rpc_reader_member_close (_reader_))\n",
+					"\tgoto failed;\n",
+					NULL);
+	pop_indent ();
+	write ("} /* end while */\n\n");
+
+	xml_rpc_support_multiple_write ("(* result) = _result;\n",
+					"return axl_true;\n\n",
+					NULL);
+	pop_indent ();
+	write (" failed:\n");
+	push_indent ();
+	write ("%s_%s_free (_result);\n", comp_name_lower, struct_lower);
+	write ("return axl_false;\n");
+	pop_indent ();
+	write ("}\n\n");
+
+	/* write the reply reader */
+	xml_rpc_c_stub_write_reply_reader (comp_name_lower, struct_name, struct_lower);
+
+	return;
+}
+
 /** 
  * @internal
  *
@@ -717,6 +1001,16 @@ void xml_rpc_c_stub_write_struct_def (char  * out_dir,
 			       comp_name_lower, struct_lower, struct_name);
 	xml_rpc_support_write ("%s * %s_%s_unmarshall (XmlRpcStruct * ref, axl_bool  dealloc);\n\n",
 			       struct_name, comp_name_lower, struct_lower);
+
+	if (exarg_is_defined ("direct-marshall")) {
+		xml_rpc_support_write ("/* direct (un)marshaller support functions  */\n");
+		xml_rpc_support_write ("void %s_%s_write (XmlRpcWriter * _writer_, %s * ref);\n",
+				       comp_name_lower, struct_lower, struct_name);
+		xml_rpc_support_write ("axl_bool %s_%s_read (XmlRpcReader * _reader_, %s ** result);\n",
+				       comp_name_lower, struct_lower, struct_name);
+		xml_rpc_support_write ("axl_bool %s_%s_reply_reader (XmlRpcReader * _reader_, axlPointer * result);\n\n",
+				       comp_name_lower, struct_lower);
+	} /* end if */
 	
 	xml_rpc_support_write ("/* memory (de)allocation functions */\n");
 	xml_rpc_support_write ("%s * %s_%s_new (", struct_name, comp_name_lower, struct_lower);
@@ -927,6 +1221,10 @@ void xml_rpc_c_stub_write_struct_def (char  * out_dir,
 
 	xml_rpc_support_write ("}\n\n");
 
+	/* write the direct (un)marshall implementation */
+	if (exarg_is_defined ("direct-marshall"))
+		xml_rpc_c_stub_write_struct_direct (doc, comp_name_lower, struct_name, struct_lower, _struct);
+
 	/* write the new function */
 	xml_rpc_support_write ("/* memory (de)allocation functions */\n");
 	xml_rpc_support_write ("%s * %s_%s_new (", struct_name, comp_name_lower, struct_lower);
@@ -1161,6 +1459,103 @@ void xml_rpc_c_stub_write_native_type (axlDoc * doc, const char  * type, axl_boo
 }
 
 
+/** 
+ * @internal
+ *
+ * Writes the direct marshalling functions for the array provided
+ * (<comp>_<array>_write and <comp>_<array>_read), which translate
+ * the native array from/to its XML-RPC representation without
+ * creating XmlRpcArray objects.
+ */
+void xml_rpc_c_stub_write_array_direct (axlDoc     * doc,
+					const char * comp_name_lower,
+					const char * name,
+					const char * name_lower,
+					const char * type)
+{
+	/* write the direct marshaller */
+	write ("void %s_%s_write (XmlRpcWriter * _writer_, %s * ref)\n{\n",
+	       comp_name_lower, name_lower, name);
+	push_indent ();
+
+	xml_rpc_support_multiple_write ("int iterator = 0;\n\n",
+					"/* write a none value for NULL references */\n",
+					"if (ref == NULL) {\n",
+					"\tvortex_xml_rpc_writer_none (_writer_);\n",
+					"\treturn;\n",
+					"}\n\n",
+					"vortex_xml_rpc_writer_array_open (_writer_);\n",
+					"while (iterator < ref->count) {\n",
+					NULL);
+	push_indent ();
+	xml_rpc_c_stub_write_direct_value (doc, comp_name_lower, type, "ref->array[iterator]");
+	write ("iterator++;\n");
+	pop_indent ();
+	xml_rpc_support_multiple_write ("}\n",
+					"vortex_xml_rpc_writer_array_close (_writer_);\n",
+					"return;\n",
+					NULL);
+	pop_indent ();
+	write ("}\n\n");
+
+	/* write the direct unmarshaller */
+	write ("axl_bool %s_%s_read (XmlRpcReader * _reader_, %s ** result)\n{\n",
+	       comp_name_lower, name_lower, name);
+	push_indent ();
+
+	write ("%s * _result;\n", name);
+	xml_rpc_c_stub_write_native_type (doc, type, axl_false);
+	xml_rpc_support_sl_write (" * _items;\n");
+	xml_rpc_support_multiple_write ("int          _allocated = 0;\n",
+					"axl_bool     _more;\n",
+					"axl_bool     _is_none;\n\n",
+					"(* result) = NULL;\n",
+					"if (! vortex_xml_rpc_reader_array_open (_reader_, &_is_none))\n",
+					"\treturn axl_false;\n",
+					"if (_is_none)\n",
+					"\treturn axl_true;\n\n",
+					NULL);
+	write ("_result = %s_%s_new (0);\n", comp_name_lower, name_lower);
+	write ("while (axl_true) {\n");
+	push_indent ();
+
+	xml_rpc_support_multiple_write ("/* check for more items */\n",
+					"if (! vortex_xml_rpc_reader_array_next (_reader_, &_more))\n",
+					"\tgoto failed;\n",
+					"if (! _more)\n",
+					"\tbreak;\n\n",
+					"/* grow the array when required */\n",
+					"if (_result->count == _allocated) {\n",
+					"\t_allocated = (_allocated > 0) ? (_allocated * 2) : 8;\n",
+					"\t_items     = axl_realloc (_result->array, sizeof (* _items) * _allocated);\n",
+					"\tif (_items == NULL)\n",
+					"\t\tgoto failed;\n",
+					"\t_result->array = _items;\n",
+					"} /* end if */\n",
+					"_result->array[_result->count] = 0;\n\n",
+					NULL);
+	xml_rpc_c_stub_write_direct_read (doc, comp_name_lower, type, "_result->array[_result->count]");
+	write ("_result->count++;\n");
+	pop_indent ();
+	write ("} /* end while */\n\n");
+
+	xml_rpc_support_multiple_write ("(* result) = _result;\n",
+					"return axl_true;\n\n",
+					NULL);
+	pop_indent ();
+	write (" failed:\n");
+	push_indent ();
+	write ("%s_%s_free (_result);\n", comp_name_lower, name_lower);
+	write ("return axl_false;\n");
+	pop_indent ();
+	write ("}\n\n");
+
+	/* write the reply reader */
+	xml_rpc_c_stub_write_reply_reader (comp_name_lower, name, name_lower);
+
+	return;
+}
+
 /** 
  * @internal
  *
@@ -1236,6 +1631,16 @@ void xml_rpc_c_stub_write_array_def (char  * out_dir, char  * comp_name, axlNode
 	xml_rpc_support_write ("%s * %s_%s_unmarshall (XmlRpcArray * ref, axl_bool  dealloc);\n\n",
 			       name, comp_name_lower, name_lower);
 
+	if (exarg_is_defined ("direct-marshall")) {
+		xml_rpc_support_write ("/* direct (un)marshaller support functions  */\n");
+		xml_rpc_support_write ("void %s_%s_write (XmlRpcWriter * _writer_, %s * ref);\n",
+				       comp_name_lower, name_lower, name);
+		xml_rpc_support_write ("axl_bool %s_%s_read (XmlRpcReader * _reader_, %s ** result);\n",
+				       comp_name_lower, name_lower, name);
+		xml_rpc_support_write ("axl_bool %s_%s_reply_reader (XmlRpcReader * _reader_, axlPointer * result);\n\n",
+				       comp_name_lower, name_lower);
+	} /* end if */
+
 	/* write memory allocators */
 	xml_rpc_support_write ("/* memory (de)allocation functions */\n");
 	xml_rpc_support_write ("%s * %s_%s_new  (int count);\n", name, comp_name_lower, name_lower);
@@ -1501,6 +1906,10 @@ void xml_rpc_c_stub_write_array_def (char  * out_dir, char  * comp_name, axlNode
 
 	xml_rpc_support_write ("}\n\n");
 
+	/* write the direct (un)marshall implementation */
+	if (exarg_is_defined ("direct-marshall"))
+		xml_rpc_c_stub_write_array_direct (doc, comp_name_lower, name, name_lower, type);
+
 	xml_rpc_support_write ("%s * %s_%s_new  (int count)\n{\n", name, comp_name_lower, name_lower);
 	
 	xml_rpc_support_push_indent ();
@@ -2117,6 +2526,10 @@ void xml_rpc_c_stub_write_service_body (axlDoc * doc, char  * comp_name, axlNode
 	const char * method_name;
 	axlNode    * aux2;
 
+	/* direct marshalling support */
+	axl_bool     direct = exarg_is_defined ("direct-marshall");
+	axl_bool     native_reply;
+
 	/* get service name */
 	aux          = axl_node_get_child_called (node, "name");
 	service_name = axl_node_get_content_trim (aux, NULL);
@@ -2129,6 +2542,11 @@ void xml_rpc_c_stub_write_service_body (axlDoc * doc, char  * comp_name, axlNode
 	/* get lower version */
 	comp_name_lower   = xml_rpc_support_to_lower (comp_name);
 
+	/* struct and array replies are read directly into the native
+	 * type by the sync stub when direct marshalling is enabled */
+	native_reply      = direct && (xml_rpc_c_stub_type_is_array (doc, return_type) || 
+				       xml_rpc_c_stub_type_is_struct (doc, return_type));
+
 	/* check if the service is inside a resource or next node is
 	 * the params */
 	aux          = axl_node_get_child_called (node, "params");
@@ -2157,8 +2575,10 @@ void xml_rpc_c_stub_write_service_body (axlDoc * doc, char  * comp_name, axlNode
 	/* push the indent */
 	xml_rpc_support_push_indent ();
 
-	xml_rpc_support_write ("XmlRpcMethodCall * _invocator_;\n\n");
-	xml_rpc_support_write ("/* create the method call invocator */\n");
+	xml_rpc_support_write ("XmlRpcMethodCall * _invocator_;\n");
+	if (direct)
+		xml_rpc_support_write ("XmlRpcWriter     * _writer_;\n");
+	xml_rpc_support_write ("\n/* create the method call invocator */\n");
 	
 	
 	/* check there is a method call defined (alternative method
@@ -2167,18 +2587,21 @@ void xml_rpc_c_stub_write_service_body (axlDoc * doc, char  * comp_name, axlNode
 	
 	if (aux2 == NULL) {
 		xml_rpc_support_write ("_invocator_ = method_call_new (_ctx_, \"%s\", %d);\n\n", 
-				       service_name, axl_node_get_child_num (aux));
+				       service_name, direct ? 0 : axl_node_get_child_num (aux));
 	} else {
 		/* we have method_name defined */
 		method_name = axl_node_get_content_trim (aux2, NULL);
 		xml_rpc_support_write ("_invocator_ = method_call_new (_ctx_, \"%s\", %d);\n\n", 
-				       method_name, axl_node_get_child_num (aux));
+				       method_name, direct ? 0 : axl_node_get_child_num (aux));
 	}
 											   
 
 
 	/* write method create values sentences */
-	xml_rpc_support_write_method_create_values (doc, aux, comp_name);
+	if (direct)
+		xml_rpc_support_write_method_direct_values (doc, aux, comp_name);
+	else
+		xml_rpc_support_write_method_create_values (doc, aux, comp_name);
 	
 	xml_rpc_support_multiple_write ("/* return invocator created */\n",
 					"return _invocator_;\n",
@@ -2218,23 +2641,34 @@ void xml_rpc_c_stub_write_service_body (axlDoc * doc, char  * comp_name, axlNode
 
 	xml_rpc_support_write_sl (");\n\n");
 
+	if (native_reply) {
+		/* read the reply straight into the native type */
+		xml_rpc_support_write ("/* read the reply directly into the native type */\n");
+		xml_rpc_support_write ("vortex_xml_rpc_method_call_set_reply_reader (_invocator_, %s_%s_reply_reader, (axlDestroyFunc) %s_%s_free);\n\n",
+				       comp_name_lower, return_type_lower, comp_name_lower, return_type_lower);
+	} /* end if */
+
 	xml_rpc_support_multiple_write ("/* perform the invocation, in a synchronous way, get blocked\n",
 					" * until it is received */\n",
 					"_response_ = vortex_xml_rpc_invoke_sync (channel, _invocator_);\n\n",
 					NULL);
 	xml_rpc_support_write ("/* unmarshall sync result */\n");
-	xml_rpc_support_write ("return %s ", xml_rpc_c_stub_write_service_body_sync_unmarshaller (doc, return_type));
-	
-	if (xml_rpc_c_stub_type_is_array (doc, return_type))
-		xml_rpc_support_sl_write (" (_response_, (XmlRpcArrayUnMarshaller) %s_%s_unmarshall, status, channel, fault_code, fault_string);\n",
-					  comp_name_lower, return_type_lower);
-	else if (xml_rpc_c_stub_type_is_struct (doc, return_type))
-		xml_rpc_support_sl_write (" (_response_, (XmlRpcStructUnMarshaller) %s_%s_unmarshall, status, channel, fault_code, fault_string);\n",
-					  comp_name_lower, return_type_lower);
-	else if (axl_cmp (return_type, "bool"))
-		xml_rpc_support_sl_write (" (_response_, status, channel, fault_code, fault_string) == axl_true;\n");
-	else
-		xml_rpc_support_sl_write (" (_response_, status, channel, fault_code, fault_string);\n");
+	if (native_reply)
+		xml_rpc_support_write ("return vortex_xml_rpc_unmarshall_native_sync (_response_, status, channel, fault_code, fault_string);\n");
+	else {
+		xml_rpc_support_write ("return %s ", xml_rpc_c_stub_write_service_body_sync_unmarshaller (doc, return_type));
+	
+		if (xml_rpc_c_stub_type_is_array (doc, return_type))
+			xml_rpc_support_sl_write (" (_response_, (XmlRpcArrayUnMarshaller) %s_%s_unmarshall, status, channel, fault_code, fault_string);\n",
+						  comp_name_lower, return_type_lower);
+		else if (xml_rpc_c_stub_type_is_struct (doc, return_type))
+			xml_rpc_support_sl_write (" (_response_, (XmlRpcStructUnMarshaller) %s_%s_unmarshall, status, channel, fault_code, fault_string);\n",
+						  comp_name_lower, return_type_lower);
+		else if (axl_cmp (return_type, "bool"))
+			xml_rpc_support_sl_write (" (_response_, status, channel, fault_code, fault_string) == axl_true;\n");
+		else
+			xml_rpc_support_sl_write (" (_response_, status, channel, fault_code, fault_string);\n");
+	} /* end if */
 
 	xml_rpc_support_pop_indent ();
 
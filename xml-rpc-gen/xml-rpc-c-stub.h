@@ -53,4 +53,9 @@ void     xml_rpc_c_stub_write_all_struct_and_array_defs (axlDoc * doc,
 							 char   * comp_name, 
 							 char   * result);
 
+void     xml_rpc_c_stub_write_direct_value          (axlDoc     * doc, 
+						     const char * comp_name_lower, 
+						     const char * type, 
+						     const char * expr);
+
 #endif
@@ -294,6 +294,7 @@ int main (int argc, char **argv)
 	exarg_install_arg ("out-stub-dir", NULL, EXARG_STRING, "Allows to fully configure stub output source code. This is not the same as --out-dir which is a directory where is placed both products.");
 	exarg_install_arg ("disable-main-file", NULL, EXARG_NONE, "Server side component option. It allows to disable creating a main.c file, allowing to produce a custom one. This option is useful while trying to create XML-RPC components mixed with other profiles");
 	exarg_install_arg ("to-xml", NULL, EXARG_NONE, "Makes the IDL input file to be translated into XML");
+	exarg_install_arg ("direct-marshall", NULL, EXARG_NONE, "Produces, for each struct and array, functions that marshall and unmarshall them directly from/to their XML-RPC representation, without creating intermediate XmlRpcStruct and XmlRpcArray values. They are used by the client stub (parameters and synchronous replies) and by the server stub (replies). Requires a XML-RPC library with XmlRpcWriter/XmlRpcReader support.");
 
 	exarg_install_arg ("add-search-path", NULL, EXARG_STRING, "Allows to configure a list of directories (separated by ;) that are added to the search path. This allows to locate DTD files required by the tool.");
 
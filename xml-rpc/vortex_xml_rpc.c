@@ -204,272 +204,1217 @@ void __vortex_xml_rpc_notify_response (XmlRpcInvokeNotify     notify,
 }
 				       
 
+/** 
+ * @internal
+ *
+ * Pull parser state used to unmarshall XML-RPC messages directly
+ * from the frame payload in one pass, producing \ref
+ * XmlRpcMethodValue trees without building an axlDoc first. The same
+ * state is exposed as \ref XmlRpcReader to read values straight into
+ * native types.
+ */
+struct _XmlRpcReader {
+	VortexCtx   * ctx;
+
+	/* content being parsed */
+	const char  * cursor;
+	const char  * end;
+
+	/* last tag read */
+	const char  * tag;
+	int           tag_size;
+	axl_bool      tag_close;
+	axl_bool      tag_empty;
+
+	/* decoded text content: text is written from text_mark so
+	 * enclosing elements can keep previous text (member names,
+	 * method name) in the same buffer while values are parsed */
+	char        * text;
+	int           text_size;
+	int           text_allocated;
+	int           text_mark;
+
+	/* reader state: <value> already read by array_next and
+	 * <struct/> or <data/> read by the container open */
+	axl_bool      pending_value;
+	axl_bool      container_empty;
+};
+
+/** 
+ * @internal Checks if the last tag read is the provided static name.
+ */
+#define XML_RPC_PARSER_TAG_IS(parser, name) ((parser)->tag_size == (int) (sizeof (name) - 1) && memcmp ((parser)->tag, name, sizeof (name) - 1) == 0)
+
+/** 
+ * @internal Checks if the parser cursor starts with the provided
+ * static string.
+ */
+#define XML_RPC_PARSER_STARTS(parser, str) (((parser)->end - (parser)->cursor) >= (int) (sizeof (str) - 1) && memcmp ((parser)->cursor, str, sizeof (str) - 1) == 0)
+
+#define XML_RPC_PARSER_IS_BLANK(c) ((c) == ' ' || (c) == '\t' || (c) == '\r' || (c) == '\n')
+
+/** 
+ * @internal Finds the provided pattern inside the remaining content,
+ * starting at from.
+ */
+const char * __vortex_xml_rpc_parser_find (XmlRpcReader * parser, const char * from, const char * pattern, int pattern_size)
+{
+	while ((parser->end - from) >= pattern_size) {
+		if (*from == *pattern && memcmp (from, pattern, pattern_size) == 0)
+			return from;
+		from++;
+	} /* end while */
+	return NULL;
+}
+
+/** 
+ * @internal Appends content to the parser text buffer, keeping it
+ * NUL terminated.
+ */
+axl_bool __vortex_xml_rpc_parser_append (XmlRpcReader * parser, const char * content, int size)
+{
+	char * new_text;
+	int    new_allocated;
+
+	if ((parser->text_size + size + 1) > parser->text_allocated) {
+		new_allocated = parser->text_allocated > 0 ? parser->text_allocated : 256;
+		while ((parser->text_size + size + 1) > new_allocated)
+			new_allocated = new_allocated * 2;
+		new_text = axl_realloc (parser->text, new_allocated);
+		if (new_text == NULL)
+			return axl_false;
+		parser->text           = new_text;
+		parser->text_allocated = new_allocated;
+	} /* end if */
+
+	memcpy (parser->text + parser->text_size, content, size);
+	parser->text_size              += size;
+	parser->text[parser->text_size] = 0;
+	return axl_true;
+}
+
+/** 
+ * @internal Decodes the entity reference found at the cursor (&...;)
+ * appending its value to the text buffer.
+ */
+axl_bool __vortex_xml_rpc_parser_entity (XmlRpcReader * parser)
+{
+	const char    * end;
+	const char    * name;
+	unsigned long   code;
+	char            utf8[4];
+	int             size;
+
+	/* find entity end */
+	name = parser->cursor + 1;
+	end  = name;
+	while (end < parser->end && *end != ';' && (end - name) < 10)
+		end++;
+	if (end >= parser->end || *end != ';')
+		return axl_false;
+	size = end - name;
+
+	if (size == 3 && memcmp (name, "amp", 3) == 0) {
+		utf8[0] = '&'; size = 1;
+	} else if (size == 2 && memcmp (name, "lt", 2) == 0) {
+		utf8[0] = '<'; size = 1;
+	} else if (size == 2 && memcmp (name, "gt", 2) == 0) {
+		utf8[0] = '>'; size = 1;
+	} else if (size == 4 && memcmp (name, "quot", 4) == 0) {
+		utf8[0] = '"'; size = 1;
+	} else if (size == 4 && memcmp (name, "apos", 4) == 0) {
+		utf8[0] = '\''; size = 1;
+	} else if (size > 1 && name[0] == '#') {
+		/* character reference */
+		if (name[1] == 'x' || name[1] == 'X')
+			code = strtoul (name + 2, NULL, 16);
+		else
+			code = strtoul (name + 1, NULL, 10);
+
+		/* encode as utf-8 */
+		if (code == 0 || code > 0x10FFFF) {
+			return axl_false;
+		} else if (code < 0x80) {
+			utf8[0] = (char) code;
+			size    = 1;
+		} else if (code < 0x800) {
+			utf8[0] = (char) (0xC0 | (code >> 6));
+			utf8[1] = (char) (0x80 | (code & 0x3F));
+			size    = 2;
+		} else if (code < 0x10000) {
+			utf8[0] = (char) (0xE0 | (code >> 12));
+			utf8[1] = (char) (0x80 | ((code >> 6) & 0x3F));
+			utf8[2] = (char) (0x80 | (code & 0x3F));
+			size    = 3;
+		} else {
+			utf8[0] = (char) (0xF0 | (code >> 18));
+			utf8[1] = (char) (0x80 | ((code >> 12) & 0x3F));
+			utf8[2] = (char) (0x80 | ((code >> 6) & 0x3F));
+			utf8[3] = (char) (0x80 | (code & 0x3F));
+			size    = 4;
+		} /* end if */
+	} else {
+		/* unknown entity */
+		return axl_false;
+	} /* end if */
+
+	parser->cursor = end + 1;
+	return __vortex_xml_rpc_parser_append (parser, utf8, size);
+}
+
+/** 
+ * @internal Skips blanks, comments, processing instructions and
+ * doctype declarations found before the next tag.
+ */
+axl_bool __vortex_xml_rpc_parser_skip (XmlRpcReader * parser)
+{
+	const char * aux;
+
+	while (parser->cursor < parser->end) {
+		if (XML_RPC_PARSER_IS_BLANK (*parser->cursor)) {
+			parser->cursor++;
+			continue;
+		} /* end if */
+
+		if (XML_RPC_PARSER_STARTS (parser, "<?")) {
+			aux = __vortex_xml_rpc_parser_find (parser, parser->cursor + 2, "?>", 2);
+			if (aux == NULL)
+				return axl_false;
+			parser->cursor = aux + 2;
+			continue;
+		} /* end if */
+
+		if (XML_RPC_PARSER_STARTS (parser, "<!--")) {
+			aux = __vortex_xml_rpc_parser_find (parser, parser->cursor + 4, "-->", 3);
+			if (aux == NULL)
+				return axl_false;
+			parser->cursor = aux + 3;
+			continue;
+		} /* end if */
+
+		if (XML_RPC_PARSER_STARTS (parser, "<!DOCTYPE")) {
+			aux = __vortex_xml_rpc_parser_find (parser, parser->cursor + 9, ">", 1);
+			if (aux == NULL)
+				return axl_false;
+			parser->cursor = aux + 1;
+			continue;
+		} /* end if */
+
+		break;
+	} /* end while */
+
+	return axl_true;
+}
+
+/** 
+ * @internal Reads the next tag (opening, closing or empty) skipping
+ * its attributes, which are not used by XML-RPC.
+ */
+axl_bool __vortex_xml_rpc_parser_next_tag (XmlRpcReader * parser)
+{
+	char quote = 0;
+
+	if (! __vortex_xml_rpc_parser_skip (parser))
+		return axl_false;
+	if (parser->cursor >= parser->end || *parser->cursor != '<')
+		return axl_false;
+	parser->cursor++;
+
+	parser->tag_close = axl_false;
+	parser->tag_empty = axl_false;
+	if (parser->cursor < parser->end && *parser->cursor == '/') {
+		parser->tag_close = axl_true;
+		parser->cursor++;
+	} /* end if */
+
+	/* tag name */
+	parser->tag = parser->cursor;
+	while (parser->cursor < parser->end && 
+	       ! XML_RPC_PARSER_IS_BLANK (*parser->cursor) && *parser->cursor != '>' && *parser->cursor != '/')
+		parser->cursor++;
+	parser->tag_size = parser->cursor - parser->tag;
+	if (parser->tag_size == 0)
+		return axl_false;
+
+	/* skip attributes until the tag end */
+	while (parser->cursor < parser->end) {
+		if (quote) {
+			if (*parser->cursor == quote)
+				quote = 0;
+		} else if (*parser->cursor == '"' || *parser->cursor == '\'') {
+			quote = *parser->cursor;
+		} else if (*parser->cursor == '>') {
+			break;
+		} /* end if */
+		parser->cursor++;
+	} /* end while */
+	if (parser->cursor >= parser->end)
+		return axl_false;
+
+	if (! parser->tag_close && parser->cursor[-1] == '/')
+		parser->tag_empty = axl_true;
+	parser->cursor++;
+
+	return axl_true;
+}
+
+/** 
+ * @internal Reads the next tag checking it is the expected one.
+ */
+axl_bool __vortex_xml_rpc_parser_expect_tag (XmlRpcReader * parser, const char * name, int size, axl_bool close)
+{
+	if (! __vortex_xml_rpc_parser_next_tag (parser))
+		return axl_false;
+	return parser->tag_close == close && parser->tag_size == size && memcmp (parser->tag, name, size) == 0;
+}
+
+#define __vortex_xml_rpc_parser_expect(parser, name, close) __vortex_xml_rpc_parser_expect_tag (parser, name, sizeof (name) - 1, close)
+
+/** 
+ * @internal Reads the text content found at the cursor (decoding
+ * entity references and joining CDATA sections) up to the next tag.
+ *
+ * @return A reference to the decoded text (valid until the next text
+ * read at the same mark) or NULL if it fails.
+ */
+const char * __vortex_xml_rpc_parser_text (XmlRpcReader * parser)
+{
+	const char * start;
+	const char * aux;
+
+	parser->text_size = parser->text_mark;
+	if (! __vortex_xml_rpc_parser_append (parser, "", 0))
+		return NULL;
+
+	while (parser->cursor < parser->end) {
+		if (*parser->cursor == '<') {
+			if (XML_RPC_PARSER_STARTS (parser, "<![CDATA[")) {
+				start = parser->cursor + 9;
+				aux   = __vortex_xml_rpc_parser_find (parser, start, "]]>", 3);
+				if (aux == NULL || ! __vortex_xml_rpc_parser_append (parser, start, aux - start))
+					return NULL;
+				parser->cursor = aux + 3;
+				continue;
+			} /* end if */
+
+			if (XML_RPC_PARSER_STARTS (parser, "<!--")) {
+				aux = __vortex_xml_rpc_parser_find (parser, parser->cursor + 4, "-->", 3);
+				if (aux == NULL)
+					return NULL;
+				parser->cursor = aux + 3;
+				continue;
+			} /* end if */
+
+			/* next tag found */
+			break;
+		} /* end if */
+
+		if (*parser->cursor == '&') {
+			if (! __vortex_xml_rpc_parser_entity (parser))
+				return NULL;
+			continue;
+		} /* end if */
+
+		start = parser->cursor;
+		while (parser->cursor < parser->end && *parser->cursor != '<' && *parser->cursor != '&')
+			parser->cursor++;
+		if (! __vortex_xml_rpc_parser_append (parser, start, parser->cursor - start))
+			return NULL;
+	} /* end while */
+
+	return parser->text + parser->text_mark;
+}
+
+/** 
+ * @internal Adds the provided item to a growable pointer array used
+ * to collect params, members and array values before creating the
+ * final container with its definitive size.
+ */
+axl_bool __vortex_xml_rpc_parser_push (axlPointer ** items, int * count, int * allocated, axlPointer item)
+{
+	axlPointer * new_items;
+
+	if (*count == *allocated) {
+		new_items = axl_realloc (*items, sizeof (axlPointer) * ((*allocated > 0) ? (*allocated * 2) : 8));
+		if (new_items == NULL)
+			return axl_false;
+		*items     = new_items;
+		*allocated = (*allocated > 0) ? (*allocated * 2) : 8;
+	} /* end if */
+
+	(*items)[*count] = item;
+	(*count)++;
+	return axl_true;
+}
+
+/** 
+ * @internal Reads the content of a non-composite value once its type
+ * tag was read, up to and including its closing tag.
+ *
+ * @param type Reference where the value type is returned.
+ *
+ * @return The decoded text (blanks trimmed for non-string types) or
+ * NULL if it fails.
+ */
+const char * __vortex_xml_rpc_parser_scalar (XmlRpcReader * parser, XmlRpcParamType * type)
+{
+#if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
+	VortexCtx         * ctx          = parser->ctx;
+#endif
+	char              * string_value;
+	const char        * type_tag;
+	int                 type_size;
+	int                 length;
+
+	if (XML_RPC_PARSER_TAG_IS (parser, "i4") || XML_RPC_PARSER_TAG_IS (parser, "int"))
+		(* type) = XML_RPC_INT_VALUE;
+	else if (XML_RPC_PARSER_TAG_IS (parser, "boolean"))
+		(* type) = XML_RPC_BOOLEAN_VALUE;
+	else if (XML_RPC_PARSER_TAG_IS (parser, "string"))
+		(* type) = XML_RPC_STRING_VALUE;
+	else if (XML_RPC_PARSER_TAG_IS (parser, "double"))
+		(* type) = XML_RPC_DOUBLE_VALUE;
+	else if (XML_RPC_PARSER_TAG_IS (parser, "dateTime.iso8601"))
+		(* type) = XML_RPC_DATE_VALUE;
+	else if (XML_RPC_PARSER_TAG_IS (parser, "base64"))
+		(* type) = XML_RPC_BASE64_VALUE;
+	else {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "received an unsupported value type <%.*s>", 
+			    parser->tag_size, parser->tag);
+		return NULL;
+	} /* end if */
+
+	/* reference to the internal content for simple,
+	 * non-composite values. */
+	type_tag  = parser->tag;
+	type_size = parser->tag_size;
+	if (parser->tag_empty) {
+		parser->text_size = parser->text_mark;
+		if (! __vortex_xml_rpc_parser_append (parser, "", 0))
+			return NULL;
+	} else if (__vortex_xml_rpc_parser_text (parser) == NULL ||
+		   ! __vortex_xml_rpc_parser_expect_tag (parser, type_tag, type_size, axl_true)) {
+		return NULL;
+	} /* end if */
+	string_value = parser->text + parser->text_mark;
+
+	if ((* type) != XML_RPC_STRING_VALUE) {
+		/* numbers, dates and base64 content can be
+		 * surrounded by blanks */
+		while (XML_RPC_PARSER_IS_BLANK (*string_value))
+			string_value++;
+		length = strlen (string_value);
+		while (length > 0 && XML_RPC_PARSER_IS_BLANK (string_value[length - 1]))
+			length--;
+		string_value[length] = 0;
+	} /* end if */
+
+	return string_value;
+}
+
+/* function prototype */
+XmlRpcMethodValue * __vortex_xml_rpc_parse_value (XmlRpcReader * parser);
+
+/** 
+ * @internal Parses the <value> content found after reading its
+ * opening tag, handling <value/> as an empty string.
+ */
+XmlRpcMethodValue * __vortex_xml_rpc_parse_value_tag (XmlRpcReader * parser)
+{
+	if (parser->tag_empty)
+		return method_value_new_from_string (parser->ctx, XML_RPC_STRING_VALUE, "");
+	return __vortex_xml_rpc_parse_value (parser);
+}
+
 /** 
  * @internal
  *
  * Internal function to support parsing xml content received,
  * representing an struct construction. This function is called from
- * __vortex_xml_rpc_parse_value.
- * 
- * @param child The node received represents the xml node reference
- * pointing to the <struct>.
+ * __vortex_xml_rpc_parse_value once the <struct> tag was read.
  * 
  * @return A newly allocated method value, containing a representation
  * of a struct or NULL if fails.
  */
-XmlRpcMethodValue * __vortex_xml_rpc_parse_struct_value (VortexCtx * ctx, axlNode * struct_node)
+XmlRpcMethodValue * __vortex_xml_rpc_parse_struct_value (XmlRpcReader * parser)
 {
-	/* the variable which will hold the result */
-	const char         * member_name;
+#if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
+	VortexCtx          * ctx      = parser->ctx;
+#endif
+	axlPointer         * members  = NULL;
+	int                  count    = 0;
+	int                  allocated = 0;
+	int                  saved_mark;
+	int                  name_offset;
 	XmlRpcMethodValue  * member_value;
-	XmlRpcStruct       * _struct;
 	XmlRpcStructMember * member;
-	
-
-	/* some node references */
-	axlNode            * name;
-	axlNode            * value;
-	axlNode            * node_member;
-
-
-	/* some iterators */
+	XmlRpcStruct       * _struct;
 	int                  iterator;
-	int                  length;
-
-	/* check the struct node name */
-	if (! NODE_CMP_NAME (struct_node, "struct")) {
-		/* it seems we have received a node reference which is
-		   not an struct */
-		return NULL; 
-	} 
 
-	/* get the count number of childs inside the struct */
-	length   = axl_node_get_child_num (struct_node);
-
-	if (length == 0) {
+	if (parser->tag_empty) {
 		/* it seems we have received an struct with no
 		 * members */
 		return NULL;
-	}
-
-	/* create the struct */
-	_struct = vortex_xml_rpc_struct_new (length);
+	} /* end if */
 
-	/* iterate over all childs (<member> items) inside the
-	 * <struct> received */
-	iterator = 0;
-	while (iterator < length) {
-		/* get a referenced to the member node */
-		node_member = axl_node_get_child_nth (struct_node, iterator);
-		
-		/* get the member name */
-		name         = axl_node_get_child_nth (node_member, 0);
-		member_name  = axl_node_get_content (name, NULL);
+	saved_mark = parser->text_mark;
+	while (axl_true) {
+		if (! __vortex_xml_rpc_parser_next_tag (parser))
+			goto failed;
+		if (parser->tag_close && XML_RPC_PARSER_TAG_IS (parser, "struct"))
+			break;
+		if (parser->tag_close || parser->tag_empty || ! XML_RPC_PARSER_TAG_IS (parser, "member"))
+			goto failed;
+
+		/* get the member name, keeping it in the text buffer
+		 * while the value is parsed */
+		if (! __vortex_xml_rpc_parser_expect (parser, "name", axl_false))
+			goto failed;
+		name_offset = parser->text_mark;
+		if (parser->tag_empty) {
+			parser->text_size = parser->text_mark;
+			if (! __vortex_xml_rpc_parser_append (parser, "", 0))
+				goto failed;
+		} else if (__vortex_xml_rpc_parser_text (parser) == NULL || 
+			   ! __vortex_xml_rpc_parser_expect (parser, "name", axl_true)) {
+			goto failed;
+		} /* end if */
+		parser->text_mark = parser->text_size + 1;
 
-		vortex_log (VORTEX_LEVEL_DEBUG, "parsing struct member name=%s",
-			    member_name);
-		
 		/* get the member content */
-		value        = axl_node_get_child_nth (node_member, 1);
-		member_value = __vortex_xml_rpc_parse_value (ctx, value);
+		member_value = NULL;
+		if (__vortex_xml_rpc_parser_expect (parser, "value", axl_false))
+			member_value = __vortex_xml_rpc_parse_value_tag (parser);
+		parser->text_mark = saved_mark;
+		if (member_value == NULL)
+			goto failed;
+
+		/* create the member */
+		member = vortex_xml_rpc_struct_member_new (parser->text + name_offset, member_value);
+		if (! __vortex_xml_rpc_parser_expect (parser, "member", axl_true) ||
+		    ! __vortex_xml_rpc_parser_push (&members, &count, &allocated, member)) {
+			vortex_xml_rpc_struct_member_free (member);
+			goto failed;
+		} /* end if */
+	} /* end while */
+
+	if (count == 0) {
+		/* it seems we have received an struct with no
+		 * members */
+		axl_free (members);
+		return NULL;
+	} /* end if */
 
-		/* create the member and add it to the struct */
-		member = vortex_xml_rpc_struct_member_new (member_name, member_value);
-		vortex_xml_rpc_struct_add_member (_struct, member);
-		
-		/* next member to parse */
-		iterator++;
-	}
+	/* create the struct with its final size */
+	vortex_log (VORTEX_LEVEL_DEBUG, "creating xml rpc struct with %d members", count);
+	_struct = vortex_xml_rpc_struct_new (count);
+	for (iterator = 0; iterator < count; iterator++)
+		vortex_xml_rpc_struct_add_member (_struct, members[iterator]);
+	axl_free (members);
 
 	/* return the structure parsed */
-	return method_value_new (ctx, XML_RPC_STRUCT_VALUE, _struct);
+	return method_value_new (parser->ctx, XML_RPC_STRUCT_VALUE, _struct);
+
+ failed:
+	parser->text_mark = saved_mark;
+	for (iterator = 0; iterator < count; iterator++)
+		vortex_xml_rpc_struct_member_free (members[iterator]);
+	axl_free (members);
+	return NULL;
 }
 
 /** 
  * @internal
  *
- * Parses a received xml stream representing an xml rpc array.
- *
- * @param array_node The node pointing to the first node <array>.
+ * Parses a received xml stream representing an xml rpc array, once
+ * the <array> tag was read.
  * 
  * @return A newly allocated xml-rpc array.
  */
-XmlRpcMethodValue * __vortex_xml_rpc_parse_array_value (VortexCtx * ctx, axlNode * array_node)
+XmlRpcMethodValue * __vortex_xml_rpc_parse_array_value (XmlRpcReader * parser)
 {
-	/* the variable which will hold the result */
+#if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
+	VortexCtx          * ctx       = parser->ctx;
+#endif
+	axlPointer         * values    = NULL;
+	int                  count     = 0;
+	int                  allocated = 0;
 	XmlRpcMethodValue  * method_value;
 	XmlRpcArray        * array;
-	
-	/* some node references */
-	axlNode            * value  = NULL;
-	axlNode            * data   = NULL;
-
-	/* some iterators */
+	axl_bool             data_empty;
 	int                  iterator;
-	int                  length;
-
-	/* check the struct node name */
-	if (! NODE_CMP_NAME (array_node, "array")) {
-		/* it seems we have received a node reference which is
-		   not an struct */
-		return NULL; 
-	} 
-
-	/* get a reference to the child node */
-	data = axl_node_get_child_nth (array_node, 0);
-
-	/* check the struct node name */
-	if (! NODE_CMP_NAME (data, "data")) {
-		/* it seems we have received a node reference which is
-		   not an struct */
-		return NULL; 
-	} 
-
-	/* get the count number of childs inside the array (<data> node) */
-	length   = axl_node_get_child_num (data);
-
-	/* create the struct */
-	vortex_log (VORTEX_LEVEL_DEBUG, "creating xml rpc array with %d items", length);
-	array = vortex_xml_rpc_array_new (length);
-
-	/* iterate over all childs inside the <data> node */
-	iterator = 0;
-	while (iterator < length) {
-
-		if (iterator == 0) {
-			/* get the first value inside the <data> node */
-			value = axl_node_get_child_nth (data, iterator);
-		}else {
-			/* get the next element in the sequence */
-			value = axl_node_get_next (value);
-		}
-
-		/* parse the value node */
-		method_value = __vortex_xml_rpc_parse_value (ctx, value);
-
-		/* create the member and add it to the struct */
-		vortex_xml_rpc_array_add (array, method_value);
 
-		/* next member to parse */
-		iterator++;
-	}
+	/* get a reference to the <data> node */
+	if (parser->tag_empty || ! __vortex_xml_rpc_parser_expect (parser, "data", axl_false))
+		return NULL;
+	data_empty = parser->tag_empty;
 
-	vortex_log (VORTEX_LEVEL_DEBUG, "returning an array with (%d) items", 
-		    vortex_xml_rpc_array_count (array));
+	/* iterate over all values inside the <data> node */
+	while (! data_empty) {
+		if (! __vortex_xml_rpc_parser_next_tag (parser))
+			goto failed;
+		if (parser->tag_close && XML_RPC_PARSER_TAG_IS (parser, "data"))
+			break;
+		if (parser->tag_close || ! XML_RPC_PARSER_TAG_IS (parser, "value"))
+			goto failed;
 
-	/* return the structure parsed */
-	return method_value_new (ctx, XML_RPC_ARRAY_VALUE, array);
+		/* parse the value node */
+		method_value = __vortex_xml_rpc_parse_value_tag (parser);
+		if (method_value == NULL)
+			goto failed;
+		if (! __vortex_xml_rpc_parser_push (&values, &count, &allocated, method_value)) {
+			method_value_free (method_value);
+			goto failed;
+		} /* end if */
+	} /* end while */
+
+	if (! __vortex_xml_rpc_parser_expect (parser, "array", axl_true))
+		goto failed;
+
+	/* create the array with its final size */
+	vortex_log (VORTEX_LEVEL_DEBUG, "creating xml rpc array with %d items", count);
+	array = vortex_xml_rpc_array_new (count);
+	for (iterator = 0; iterator < count; iterator++)
+		vortex_xml_rpc_array_add (array, values[iterator]);
+	axl_free (values);
+
+	/* return the array parsed */
+	return method_value_new (parser->ctx, XML_RPC_ARRAY_VALUE, array);
+
+ failed:
+	for (iterator = 0; iterator < count; iterator++)
+		method_value_free (values[iterator]);
+	axl_free (values);
+	return NULL;
 }
 
 /** 
  * @internal 
  *
- * @brief Parse the given chunk of xml data, supposing that it points
- * to ta <value /> node.
+ * @brief Parses the content of a <value> node, once its opening tag
+ * was read, up to and including its closing tag.
  *
  * The function returns an allocated \ref XmlRpcMethodValue
  * representing the value that the XML chunk contains.
  * 
- * @param cursor The cursor representing the value to be read.
+ * @param parser The parser positioned after the <value> tag.
  * 
- * @return A newly allocated \ref XmlRpcMethodValue.
+ * @return A newly allocated \ref XmlRpcMethodValue or NULL if it fails.
  */
-XmlRpcMethodValue * __vortex_xml_rpc_parse_value (VortexCtx * ctx, axlNode * value)
+XmlRpcMethodValue * __vortex_xml_rpc_parse_value (XmlRpcReader * parser)
 {
-	const char        * string_value = NULL;
+	VortexCtx         * ctx          = parser->ctx;
 	XmlRpcMethodValue * result       = NULL;
-	axlNode           * child        = NULL;
+	XmlRpcParamType     type         = XML_RPC_UNKNOWN_VALUE;
+	const char        * string_value;
 
-	v_return_val_if_fail (value, NULL);
+	/* read the text before the type tag: values without a type
+	 * are strings */
+	if (__vortex_xml_rpc_parser_text (parser) == NULL || ! __vortex_xml_rpc_parser_next_tag (parser))
+		return NULL;
+	if (parser->tag_close) {
+		if (! XML_RPC_PARSER_TAG_IS (parser, "value"))
+			return NULL;
+		return method_value_new_from_string (ctx, XML_RPC_STRING_VALUE, parser->text + parser->text_mark);
+	} /* end if */
 
-	/* check that the received cursor contains a <value/> node */
-	if (! NODE_CMP_NAME (value, "value")) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, 
-		       "received a wrong top level node where expected <value />. Received <%s>.", 
-		       axl_node_get_name (value));
-		return NULL;		
-	}
-	
-	/* get children node */
-	child = axl_node_get_child_nth (value, 0);
-	vortex_log (VORTEX_LEVEL_DEBUG, "received a value tag, containing a <%s>", 
-	       axl_node_get_name (child));
-
-	/* check for the none value */
-	if (NODE_CMP_NAME (child, "none")) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "none value received");
-		return method_value_new (ctx, XML_RPC_NONE_VALUE, NULL);
-	}
+	if (XML_RPC_PARSER_TAG_IS (parser, "struct")) {
+		/* struct case */
+		result = __vortex_xml_rpc_parse_struct_value (parser);
+	} else if (XML_RPC_PARSER_TAG_IS (parser, "array")) {
+		/* array case */
+		result = __vortex_xml_rpc_parse_array_value (parser);
+	} else if (XML_RPC_PARSER_TAG_IS (parser, "none")) {
+		/* check for the none value */
+		if (parser->tag_empty || __vortex_xml_rpc_parser_expect (parser, "none", axl_true))
+			result = method_value_new (ctx, XML_RPC_NONE_VALUE, NULL);
+	} else {
+		/* for each value tag, convert into XML-RPC parameter */
+		string_value = __vortex_xml_rpc_parser_scalar (parser, &type);
+		if (string_value == NULL)
+			return NULL;
+		result = method_value_new_from_string (ctx, type, string_value);
+	} /* end if */
 
-	/* in the case of simple top level values, get the reference
-	 * to the internal content */
-	if (NODE_CMP_NAME (child, "i4") ||
-	    NODE_CMP_NAME (child, "int") ||
-	    NODE_CMP_NAME (child, "boolean") ||
-	    NODE_CMP_NAME (child, "string") ||
-	    NODE_CMP_NAME (child, "double") ||
-	    NODE_CMP_NAME (child, "dateTime.iso8601") ||
-	    NODE_CMP_NAME (child, "base64")) {
+	if (result == NULL)
+		return NULL;
 
-		/* reference to the internal content for simple,
-		 * non-composite values. */
-		string_value = axl_node_get_content (child, NULL);
-		v_return_val_if_fail (string_value, NULL);
+	/* close the <value> node */
+	if (! __vortex_xml_rpc_parser_expect (parser, "value", axl_true)) {
+		method_value_free (result);
+		return NULL;
+	} /* end if */
 
-		vortex_log (VORTEX_LEVEL_DEBUG, "received simple value='%s'", 
-			    string_value ? string_value : "NULL");
+	return result;
+}
 
-		/* for each value tag, convert into XML-RPC parameter */
-		if (NODE_CMP_NAME (child, "i4") || NODE_CMP_NAME (child, "int"))
-			result        = method_value_new_from_string (ctx, XML_RPC_INT_VALUE, string_value);
-		
-		/* boolean case */
-		if (NODE_CMP_NAME (child, "boolean"))
-			result        = method_value_new_from_string (ctx, XML_RPC_BOOLEAN_VALUE, string_value);
-		
-		/* string case */
-		if (NODE_CMP_NAME (child, "string"))
-			result        = method_value_new_from_string (ctx, XML_RPC_STRING_VALUE, string_value);
-		       
-		/* double case */
-		if (NODE_CMP_NAME (child, "double"))
-			result        = method_value_new_from_string (ctx, XML_RPC_DOUBLE_VALUE, string_value);
-		
-		/* dateTime.iso8601 */
-		if (NODE_CMP_NAME (child, "dateTime.iso8601"))
-			result        = method_value_new_from_string (ctx, XML_RPC_DATE_VALUE, string_value);
-		
-		/* base64 case */
-		if (NODE_CMP_NAME (child, "base64"))
-			result        = method_value_new_from_string (ctx, XML_RPC_BASE64_VALUE, string_value);
-		
-		/* free and return */
-		return result;
-	}
-	
-	/* struct case */
-	if (NODE_CMP_NAME (child, "struct")) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "received a complex value <struct>");
-		
-		/* parse the struct value */
-		result = __vortex_xml_rpc_parse_struct_value (ctx, child);
-		
-		vortex_log (VORTEX_LEVEL_DEBUG, "struct parsed: type %d", 
-			    method_value_get_type (result));
+/** 
+ * @internal Reads the opening <value> tag, unless it was already read
+ * by \ref vortex_xml_rpc_reader_array_next.
+ */
+axl_bool __vortex_xml_rpc_reader_value_open (XmlRpcReader * reader)
+{
+	if (reader == NULL)
+		return axl_false;
+	if (reader->pending_value) {
+		reader->pending_value = axl_false;
+		return axl_true;
+	} /* end if */
+	return __vortex_xml_rpc_parser_expect (reader, "value", axl_false);
+}
 
-	}else if (NODE_CMP_NAME (child, "array")) {
-		/* array case */
-		vortex_log (VORTEX_LEVEL_DEBUG, "received a complex value <array> (2)");
-		
-		/* parse the array value */
-		result = __vortex_xml_rpc_parse_array_value (ctx, child);
+/** 
+ * @internal Reads a complete non-composite <value>, returning its
+ * decoded text and its type.
+ */
+const char * __vortex_xml_rpc_reader_scalar (XmlRpcReader * reader, XmlRpcParamType * type)
+{
+	const char * text;
 
-		vortex_log (VORTEX_LEVEL_DEBUG, "array parsed: type %d", 
-			    method_value_get_type (result));
-	}
+	if (! __vortex_xml_rpc_reader_value_open (reader))
+		return NULL;
 	
-	/* release memory no longer used */
-	return result;
+	/* <value/> is an empty string */
+	(* type) = XML_RPC_STRING_VALUE;
+	if (reader->tag_empty) {
+		reader->text_size = reader->text_mark;
+		if (! __vortex_xml_rpc_parser_append (reader, "", 0))
+			return NULL;
+		return reader->text + reader->text_mark;
+	} /* end if */
+
+	/* values without a type are strings */
+	if (__vortex_xml_rpc_parser_text (reader) == NULL || ! __vortex_xml_rpc_parser_next_tag (reader))
+		return NULL;
+	if (reader->tag_close) {
+		if (! XML_RPC_PARSER_TAG_IS (reader, "value"))
+			return NULL;
+		return reader->text + reader->text_mark;
+	} /* end if */
+
+	if (XML_RPC_PARSER_TAG_IS (reader, "none")) {
+		(* type) = XML_RPC_NONE_VALUE;
+		if (! reader->tag_empty && ! __vortex_xml_rpc_parser_expect (reader, "none", axl_true))
+			return NULL;
+		text = "";
+	} else {
+		text = __vortex_xml_rpc_parser_scalar (reader, type);
+		if (text == NULL)
+			return NULL;
+	} /* end if */
+
+	/* close the <value> node */
+	if (! __vortex_xml_rpc_parser_expect (reader, "value", axl_true))
+		return NULL;
+	return text;
+}
+
+/** 
+ * @internal Reads the container opening tag (<struct> or <array><data>)
+ * after its <value>, handling <none/> values.
+ */
+axl_bool __vortex_xml_rpc_reader_container_open (XmlRpcReader * reader, axl_bool is_struct, axl_bool * is_none)
+{
+	if (is_none != NULL)
+		(* is_none) = axl_false;
+	if (! __vortex_xml_rpc_reader_value_open (reader) || reader->tag_empty || ! __vortex_xml_rpc_parser_next_tag (reader))
+		return axl_false;
+	if (reader->tag_close)
+		return axl_false;
+
+	if (XML_RPC_PARSER_TAG_IS (reader, "none")) {
+		if (is_none == NULL)
+			return axl_false;
+		(* is_none) = axl_true;
+		if (! reader->tag_empty && ! __vortex_xml_rpc_parser_expect (reader, "none", axl_true))
+			return axl_false;
+		return __vortex_xml_rpc_parser_expect (reader, "value", axl_true);
+	} /* end if */
+
+	if (is_struct) {
+		if (! XML_RPC_PARSER_TAG_IS (reader, "struct"))
+			return axl_false;
+	} else {
+		if (! XML_RPC_PARSER_TAG_IS (reader, "array") || reader->tag_empty ||
+		    ! __vortex_xml_rpc_parser_expect (reader, "data", axl_false))
+			return axl_false;
+	} /* end if */
+	reader->container_empty = reader->tag_empty;
+	return axl_true;
+}
+
+/** 
+ * @brief Reads an int value (also accepting booleans) from the
+ * provided reader, used by \ref XmlRpcReplyReader handlers.
+ * 
+ * @param reader The reader, placed before the value.
+ *
+ * @param value Reference where the value is returned.
+ * 
+ * @return axl_true if the value was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_int               (XmlRpcReader  * reader, 
+							     int           * value)
+{
+	XmlRpcParamType   type;
+	const char      * text;
+
+	text = __vortex_xml_rpc_reader_scalar (reader, &type);
+	if (text == NULL || (type != XML_RPC_INT_VALUE && type != XML_RPC_BOOLEAN_VALUE))
+		return axl_false;
+	if (value != NULL)
+		(* value) = strtol (text, NULL, 10);
+	return axl_true;
+}
+
+/** 
+ * @brief Reads a double value (also accepting ints) from the
+ * provided reader.
+ * 
+ * @param reader The reader, placed before the value.
+ *
+ * @param value Reference where the value is returned.
+ * 
+ * @return axl_true if the value was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_double            (XmlRpcReader  * reader, 
+							     double        * value)
+{
+	XmlRpcParamType   type;
+	const char      * text;
+
+	text = __vortex_xml_rpc_reader_scalar (reader, &type);
+	if (text == NULL || (type != XML_RPC_DOUBLE_VALUE && type != XML_RPC_INT_VALUE))
+		return axl_false;
+	if (value != NULL)
+		(* value) = strtod (text, NULL);
+	return axl_true;
+}
+
+/** 
+ * @brief Reads a string value (also accepting base64 content, which
+ * is returned without decoding) from the provided reader. A none value
+ * is returned as NULL.
+ * 
+ * @param reader The reader, placed before the value.
+ *
+ * @param value Reference where the value is returned, dynamically
+ * allocated. A previous value found at the reference is released.
+ * 
+ * @return axl_true if the value was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_string            (XmlRpcReader  * reader, 
+							     char         ** value)
+{
+	XmlRpcParamType   type;
+	const char      * text;
+
+	text = __vortex_xml_rpc_reader_scalar (reader, &type);
+	if (text == NULL || (type != XML_RPC_STRING_VALUE && type != XML_RPC_BASE64_VALUE && type != XML_RPC_NONE_VALUE))
+		return axl_false;
+	if (value != NULL) {
+		axl_free (* value);
+		(* value) = (type == XML_RPC_NONE_VALUE) ? NULL : axl_strdup (text);
+	} /* end if */
+	return axl_true;
+}
+
+/** 
+ * @brief Reads the opening of a struct value. Members are then
+ * iterated with \ref vortex_xml_rpc_reader_struct_next, reading each
+ * member value followed by \ref vortex_xml_rpc_reader_member_close.
+ * 
+ * @param reader The reader, placed before the value.
+ *
+ * @param is_none Optional reference that is set to axl_true if a none
+ * value was read instead of a struct (nothing more to read). If not
+ * provided, none values are not accepted.
+ * 
+ * @return axl_true if the struct (or none) was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_struct_open       (XmlRpcReader  * reader, 
+							     axl_bool      * is_none)
+{
+	return __vortex_xml_rpc_reader_container_open (reader, axl_true, is_none);
+}
+
+/** 
+ * @brief Reads the next struct member name.
+ * 
+ * @param reader The reader, inside a struct.
+ *
+ * @param name Reference where the member name is returned (valid
+ * until the member value is read) or NULL once the struct end was
+ * read.
+ * 
+ * @return axl_true if the member (or the struct end) was read,
+ * otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_struct_next       (XmlRpcReader  * reader, 
+							     const char   ** name)
+{
+	(* name) = NULL;
+	if (reader->container_empty) {
+		reader->container_empty = axl_false;
+		return __vortex_xml_rpc_parser_expect (reader, "value", axl_true);
+	} /* end if */
+
+	if (! __vortex_xml_rpc_parser_next_tag (reader))
+		return axl_false;
+	if (reader->tag_close && XML_RPC_PARSER_TAG_IS (reader, "struct"))
+		return __vortex_xml_rpc_parser_expect (reader, "value", axl_true);
+	if (reader->tag_close || reader->tag_empty || ! XML_RPC_PARSER_TAG_IS (reader, "member"))
+		return axl_false;
+
+	/* get the member name */
+	if (! __vortex_xml_rpc_parser_expect (reader, "name", axl_false))
+		return axl_false;
+	if (reader->tag_empty) {
+		reader->text_size = reader->text_mark;
+		if (! __vortex_xml_rpc_parser_append (reader, "", 0))
+			return axl_false;
+	} else if (__vortex_xml_rpc_parser_text (reader) == NULL || 
+		   ! __vortex_xml_rpc_parser_expect (reader, "name", axl_true)) {
+		return axl_false;
+	} /* end if */
+
+	(* name) = reader->text + reader->text_mark;
+	return axl_true;
+}
+
+/** 
+ * @brief Reads the end of the struct member whose value was read.
+ * 
+ * @param reader The reader, after a member value.
+ * 
+ * @return axl_true if the member end was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_member_close      (XmlRpcReader  * reader)
+{
+	return __vortex_xml_rpc_parser_expect (reader, "member", axl_true);
+}
+
+/** 
+ * @brief Reads the opening of an array value. Items are then
+ * iterated with \ref vortex_xml_rpc_reader_array_next, reading each
+ * item value.
+ * 
+ * @param reader The reader, placed before the value.
+ *
+ * @param is_none Optional reference that is set to axl_true if a none
+ * value was read instead of an array (nothing more to read). If not
+ * provided, none values are not accepted.
+ * 
+ * @return axl_true if the array (or none) was read, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_array_open        (XmlRpcReader  * reader, 
+							     axl_bool      * is_none)
+{
+	return __vortex_xml_rpc_reader_container_open (reader, axl_false, is_none);
+}
+
+/** 
+ * @brief Checks if there are more items to read inside the array.
+ * 
+ * @param reader The reader, inside an array.
+ *
+ * @param more Reference set to axl_true if an item is available
+ * (which must be read next) or axl_false once the array end was read.
+ * 
+ * @return axl_true if the item (or the array end) was found,
+ * otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_array_next        (XmlRpcReader  * reader, 
+							     axl_bool      * more)
+{
+	(* more) = axl_false;
+	if (! reader->container_empty) {
+		if (! __vortex_xml_rpc_parser_next_tag (reader))
+			return axl_false;
+		if (! reader->tag_close && XML_RPC_PARSER_TAG_IS (reader, "value")) {
+			/* keep the <value> read for the item */
+			reader->pending_value = axl_true;
+			(* more) = axl_true;
+			return axl_true;
+		} /* end if */
+		if (! reader->tag_close || ! XML_RPC_PARSER_TAG_IS (reader, "data"))
+			return axl_false;
+	} /* end if */
+
+	reader->container_empty = axl_false;
+	return __vortex_xml_rpc_parser_expect (reader, "array", axl_true) &&
+		__vortex_xml_rpc_parser_expect (reader, "value", axl_true);
+}
+
+/** 
+ * @brief Reads a value of any type as a \ref XmlRpcMethodValue,
+ * allowing to mix generic values with values read directly.
+ * 
+ * @param reader The reader, placed before the value.
+ * 
+ * @return A newly allocated \ref XmlRpcMethodValue or NULL if it fails.
+ */
+XmlRpcMethodValue * vortex_xml_rpc_reader_value             (XmlRpcReader  * reader)
+{
+	if (! __vortex_xml_rpc_reader_value_open (reader))
+		return NULL;
+	return __vortex_xml_rpc_parse_value_tag (reader);
+}
+
+/** 
+ * @brief Skips the next value (for example, unknown struct members).
+ * 
+ * @param reader The reader, placed before the value.
+ * 
+ * @return axl_true if the value was skipped, otherwise axl_false.
+ */
+axl_bool            vortex_xml_rpc_reader_skip              (XmlRpcReader  * reader)
+{
+	XmlRpcMethodValue * value;
+
+	value = vortex_xml_rpc_reader_value (reader);
+	if (value == NULL)
+		return axl_false;
+	method_value_free (value);
+	return axl_true;
+}
+
+/** 
+ * @internal Initializes the parser to read the provided content.
+ */
+void __vortex_xml_rpc_parser_init (XmlRpcReader * parser, VortexCtx * ctx, const char * content, int size)
+{
+	memset (parser, 0, sizeof (XmlRpcReader));
+	parser->ctx    = ctx;
+	parser->cursor = content;
+	parser->end    = content + size;
+	return;
+}
+
+/** 
+ * @internal Releases memory used by the parser.
+ */
+void __vortex_xml_rpc_parser_free (XmlRpcReader * parser)
+{
+	axl_free (parser->text);
+	parser->text = NULL;
+	return;
+}
+
+/** 
+ * @internal Reads the <params> section (either for a method call or
+ * a method response), collecting all values found.
+ */
+axl_bool __vortex_xml_rpc_parse_params (XmlRpcReader * parser, axlPointer ** values, int * count)
+{
+	int                 allocated = 0;
+	axl_bool            params_empty = parser->tag_empty;
+	XmlRpcMethodValue * value;
+
+	while (! params_empty) {
+		if (! __vortex_xml_rpc_parser_next_tag (parser))
+			return axl_false;
+		if (parser->tag_close && XML_RPC_PARSER_TAG_IS (parser, "params"))
+			break;
+		if (parser->tag_close || parser->tag_empty || ! XML_RPC_PARSER_TAG_IS (parser, "param"))
+			return axl_false;
+
+		/* get a referece to the <value> tag inside */
+		if (! __vortex_xml_rpc_parser_expect (parser, "value", axl_false))
+			return axl_false;
+		value = __vortex_xml_rpc_parse_value_tag (parser);
+		if (value == NULL)
+			return axl_false;
+		if (! __vortex_xml_rpc_parser_push (values, count, &allocated, value)) {
+			method_value_free (value);
+			return axl_false;
+		} /* end if */
+
+		if (! __vortex_xml_rpc_parser_expect (parser, "param", axl_true))
+			return axl_false;
+	} /* end while */
+
+	return axl_true;
+}
+
+/** 
+ * @internal
+ *
+ * @brief Unmarshalls the provided XML-RPC method call content into a
+ * \ref XmlRpcMethodCall, in one pass.
+ * 
+ * @return A newly allocated XmlRpcMethodCall or NULL if fails.
+ */
+XmlRpcMethodCall * __vortex_xml_rpc_parse_method_call (VortexCtx * ctx, const char * content, int size)
+{
+	XmlRpcReader  parser;
+	XmlRpcMethodCall  * method_call = NULL;
+	axlPointer        * values      = NULL;
+	int                 count       = 0;
+	int                 iterator;
+
+	__vortex_xml_rpc_parser_init (&parser, ctx, content, size);
+
+	/* get method name, keeping it at the text buffer start */
+	if (! __vortex_xml_rpc_parser_expect (&parser, "methodCall", axl_false) || parser.tag_empty ||
+	    ! __vortex_xml_rpc_parser_expect (&parser, "methodName", axl_false) || parser.tag_empty ||
+	    __vortex_xml_rpc_parser_text (&parser) == NULL ||
+	    ! __vortex_xml_rpc_parser_expect (&parser, "methodName", axl_true)) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to get method name value");
+		goto finish;
+	} /* end if */
+	parser.text_mark = parser.text_size + 1;
+
+	/* get all parameters if <params> is found */
+	if (! __vortex_xml_rpc_parser_next_tag (&parser))
+		goto failed;
+	if (! parser.tag_close && XML_RPC_PARSER_TAG_IS (&parser, "params")) {
+		if (! __vortex_xml_rpc_parse_params (&parser, &values, &count))
+			goto failed;
+		if (! __vortex_xml_rpc_parser_next_tag (&parser))
+			goto failed;
+	} /* end if */
+	if (! parser.tag_close || ! XML_RPC_PARSER_TAG_IS (&parser, "methodCall"))
+		goto failed;
+
+	vortex_log (VORTEX_LEVEL_DEBUG, "invocation detected for: %s, with %d parameters", parser.text, count);
+
+	/* build the method call */
+	method_call = method_call_new (ctx, parser.text, count);
+	for (iterator = 0; iterator < count; iterator++)
+		method_call_add_value (method_call, values[iterator]);
+	count = 0;
+	goto finish;
+
+ failed:
+	vortex_log (VORTEX_LEVEL_CRITICAL, "unable to parse incoming xml-rpc method call data, failure found at offset %d",
+		    (int) (parser.cursor - content));
+ finish:
+	for (iterator = 0; iterator < count; iterator++)
+		method_value_free (values[iterator]);
+	axl_free (values);
+	__vortex_xml_rpc_parser_free (&parser);
+
+	/* return method call received */
+	return method_call;
+}
+
+/** 
+ * @internal
+ *
+ * @brief Unmarshalls the provided XML-RPC method response content,
+ * in one pass.
+ *
+ * @param reader Optional reader used to read the positive reply value
+ * into a native type.
+ *
+ * @param native Reference where the native value read is returned.
+ *
+ * @param destroy Function used to release the native value read if
+ * the rest of the reply is not properly formated.
+ *
+ * @param is_fault Set to axl_true if the value returned is the fault
+ * struct.
+ *
+ * @param error_msg Set to a static error description when the
+ * function fails, or to NULL if the reply was read into a native
+ * value.
+ * 
+ * @return The value found inside the reply (or the fault struct) or
+ * NULL if fails or the reply was read into a native value.
+ */
+XmlRpcMethodValue * __vortex_xml_rpc_parse_method_response (VortexCtx          * ctx, 
+							    const char         * content, 
+							    int                  size,
+							    XmlRpcReplyReader    reader,
+							    axlPointer         * native,
+							    axlDestroyFunc       destroy,
+							    axl_bool           * is_fault,
+							    const char        ** error_msg)
+{
+	XmlRpcReader  parser;
+	XmlRpcMethodValue * value  = NULL;
+	axlPointer        * values = NULL;
+	int                 count  = 0;
+	int                 iterator;
+
+	__vortex_xml_rpc_parser_init (&parser, ctx, content, size);
+	(* is_fault)  = axl_false;
+	(* error_msg) = "received a positive formated method response but, the content inside, is not properly formated";
+
+	if (! __vortex_xml_rpc_parser_expect (&parser, "methodResponse", axl_false) || parser.tag_empty) {
+		(* error_msg) = "received a different top level tag where expected a <methodResponse>";
+		goto finish;
+	} /* end if */
+
+	if (! __vortex_xml_rpc_parser_next_tag (&parser) || parser.tag_close || parser.tag_empty) {
+		(* error_msg) = "received a bad child top level node to <methodResponse>";
+		goto finish;
+	} /* end if */
+
+	if (XML_RPC_PARSER_TAG_IS (&parser, "fault")) {
+		/* we got a fault reply, now read the <value /> */
+		(* is_fault)  = axl_true;
+		(* error_msg) = "Unable to decode the fault structure received, the remote peer is sending a not properly formated fault struct";
+		if (! __vortex_xml_rpc_parser_expect (&parser, "value", axl_false))
+			goto finish;
+		value = __vortex_xml_rpc_parse_value_tag (&parser);
+		if (value != NULL && ! __vortex_xml_rpc_parser_expect (&parser, "fault", axl_true)) {
+			method_value_free (value);
+			value = NULL;
+		} /* end if */
+	} else if (XML_RPC_PARSER_TAG_IS (&parser, "params") && reader != NULL) {
+		/* received a positive response, read its only value
+		 * into a native type */
+		(* native) = NULL;
+		if (__vortex_xml_rpc_parser_expect (&parser, "param", axl_false) && ! parser.tag_empty &&
+		    reader (&parser, native)) {
+			if (__vortex_xml_rpc_parser_expect (&parser, "param", axl_true) &&
+			    __vortex_xml_rpc_parser_expect (&parser, "params", axl_true) &&
+			    __vortex_xml_rpc_parser_expect (&parser, "methodResponse", axl_true)) {
+				(* error_msg) = NULL;
+				__vortex_xml_rpc_parser_free (&parser);
+				return NULL;
+			} /* end if */
+
+			/* reply not properly closed: release the
+			 * native value already read */
+			if (destroy != NULL && (* native) != NULL)
+				destroy (* native);
+			(* native) = NULL;
+		} /* end if */
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to read xml-rpc reply received into a native value, failure found at offset %d",
+			    (int) (parser.cursor - content));
+		__vortex_xml_rpc_parser_free (&parser);
+		return NULL;
+	} else if (XML_RPC_PARSER_TAG_IS (&parser, "params")) {
+		/* received a positive response, get its only value */
+		if (__vortex_xml_rpc_parse_params (&parser, &values, &count) && count == 1) {
+			value = values[0];
+			count = 0;
+		} /* end if */
+	} else {
+		(* error_msg) = "received a bad child top level node to <methodResponse>";
+		goto finish;
+	} /* end if */
+
+	/* check the reply is properly closed */
+	if (value != NULL && ! __vortex_xml_rpc_parser_expect (&parser, "methodResponse", axl_true)) {
+		method_value_free (value);
+		value = NULL;
+	} /* end if */
+
+ finish:
+	if (value == NULL) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to parse xml-rpc reply received, failure found at offset %d",
+			    (int) (parser.cursor - content));
+	} /* end if */
+	for (iterator = 0; iterator < count; iterator++)
+		method_value_free (values[iterator]);
+	axl_free (values);
+	__vortex_xml_rpc_parser_free (&parser);
+
+	return value;
 }
 
 
@@ -1095,6 +2040,8 @@ typedef struct _VortexXmlRpcInvokeData {
 	XmlRpcMethodCall     * invocator;
 	XmlRpcInvokeNotify     reply_notify;
 	axlPointer             user_data;
+	XmlRpcReplyReader      reply_reader;
+	axlDestroyFunc         reply_destroy;
 }VortexXmlRpcInvokeData;
 
 
@@ -1102,27 +2049,17 @@ typedef struct _VortexXmlRpcInvokeData {
  * @internal
  * 
  * Internal function used to get faultCode and faultString values,
- * from the XML-RPC response received. The node received points to the
- * <value> node which contains the <struct> structure with the desired
- * values.
+ * from the XML-RPC fault struct received.
  */
-axl_bool      __vortex_xml_rpc_get_fault_values (VortexCtx          * ctx,
-						 axlNode            * node, 
+axl_bool      __vortex_xml_rpc_get_fault_values (XmlRpcMethodValue  * value, 
 						 int                * faultCode, 
-						 char              ** faultString,
-						 XmlRpcMethodValue ** _value)
+						 char              ** faultString)
 {
-	XmlRpcMethodValue * value;
 	XmlRpcStruct      * _struct;
 
-	/* get the struct */
-	value = __vortex_xml_rpc_parse_value (ctx, node);
-
 	/* check that we have received an struct */
-	if (method_value_get_type (value) != XML_RPC_STRUCT_VALUE) {
-		method_value_free (value);
+	if (method_value_get_type (value) != XML_RPC_STRUCT_VALUE) 
 		return axl_false;
-	}
 
 	/* get the struct inside */
 	_struct = vortex_xml_rpc_method_value_get_as_struct (value);
@@ -1133,9 +2070,6 @@ axl_bool      __vortex_xml_rpc_get_fault_values (VortexCtx          * ctx,
 	/* get the fault String */
 	*faultString = vortex_xml_rpc_struct_get_member_value_as_string (_struct, "faultString");
 
-	/* set the value reference */
-	*_value    = value;
-	
 	return axl_true;
 }
 
@@ -1168,14 +2102,16 @@ void __vortex_xml_rpc_invoke_process_reply (VortexChannel      * channel,
 	VortexXmlRpcInvokeData * invocator_data  = __invocator_data;
 	XmlRpcInvokeNotify       reply_notify    = invocator_data->reply_notify;
 	axlPointer               user_data       = invocator_data->user_data;
+	XmlRpcReplyReader        reply_reader    = invocator_data->reply_reader;
+	axlDestroyFunc           reply_destroy   = invocator_data->reply_destroy;
 	VortexCtx              * ctx             = vortex_connection_get_ctx (connection);
 	XmlRpcMethodValue      * value;
 	XmlRpcMethodResponse   * response        = NULL;
+	axlPointer               native          = NULL;
 
-	/* variable declaration for the xml stuff */
-	axlDoc                 * doc;
-	axlNode                * node;
-	axlError               * error;
+	/* variables for the reply unmarshalling */
+	axl_bool                 is_fault;
+	const char             * error_msg;
 
 	/* variables for fault errors */
 	char                   * faultString;
@@ -1190,113 +2126,62 @@ void __vortex_xml_rpc_invoke_process_reply (VortexChannel      * channel,
 	/* flag the channel to have its reply processed */
 	vortex_channel_flag_reply_processed (channel, axl_true);
 	
-	/* parse incoming data */
-	doc = axl_doc_parse (vortex_frame_get_payload (frame), 
-			     vortex_frame_get_payload_size (frame), &error);
-	if (!doc) {
-		/* drop a log */
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to parse document received, error was: %s", axl_error_get (error));
-		axl_error_free (error);
-
-		/* notify user space  */
-		__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_BAD_REPLY_RECEIVED,
-						  -1, "unable to parse reply received due to a XML-RPC invocation, xml parsing in memory has failed.",
-						  channel, NULL, user_data);
-		/* nothing more to do */
+	/* unmarshall incoming data directly from the payload */
+	value = __vortex_xml_rpc_parse_method_response (ctx, vortex_frame_get_payload (frame), 
+							vortex_frame_get_payload_size (frame), 
+							reply_reader, &native, reply_destroy,
+							&is_fault, &error_msg);
+	if (value == NULL && error_msg == NULL) {
+		/* positive reply read into a native value */
+		response = vortex_xml_rpc_method_response_new_from_native (native, reply_destroy);
+		__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_OK,
+						  -1, NULL,
+						  channel, response, user_data);
 		return;
-	}
-	
-	/* get the root node */
-	node = axl_doc_get_root (doc);
-	if (! NODE_CMP_NAME (node, "methodResponse")) {
+	} /* end if */
 
+	if (value == NULL) {
 		/* notify user space  */
 		__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_BAD_REPLY_RECEIVED,
-						  -1, "received a different top level tag where expected a <methodResponse>",
+						  -1, (char *) error_msg,
 						  channel, NULL, user_data);
 		/* nothing more to do */
-		axl_doc_free (doc);
 		return;
 	}
 
-	/* walk into the first child */
-	node = axl_node_get_child_nth (node, 0);
-
 	/* check if we have received a fault reply */
-	if (NODE_CMP_NAME (node, "fault")) {
-
-		/* we got a fault reply, now point to the <value />  */
-		node = axl_node_get_child_nth (node, 0);
+	if (is_fault) {
 
 		/* get the fault error code and the fault string */
-		if (! __vortex_xml_rpc_get_fault_values (ctx, node, &faultCode, &faultString, &value)) {
+		if (! __vortex_xml_rpc_get_fault_values (value, &faultCode, &faultString)) {
 			/* notify the user space */
 			__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_BAD_REPLY_RECEIVED,
-							  -1, "Unable to decode the fault structure received, the remote peer is sending a not properly formated fault struct",
+							  -1, (char *) error_msg,
 							  channel, NULL, user_data);
 		}else {
 			/* notify the user space */
 			__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_FAULT_REPLY,
 							  faultCode,  faultString,
 							  channel, NULL, user_data);
-			/* free the struct received */
-			method_value_free (value);
 		}
 
-		/* free the document */
-		axl_doc_free (doc);
+		/* free the struct received */
+		method_value_free (value);
 		return;
 	}
 	
-	/* we got something else, check if that is a params as a first
-	 * top level node */
-	if (NODE_CMP_NAME (node, "params")) {
-		/* perform here the code to read data received */
-		vortex_log (VORTEX_LEVEL_DEBUG, "received a positive response..");
-
-		/* we got a fault reply, now point to the <param />  */
-		node = axl_node_get_child_nth (node, 0);
-
-		/* now get the <value> node */
-		node = axl_node_get_child_nth (node, 0);
-
-		/* get the value */
-		value    = __vortex_xml_rpc_parse_value (ctx, node);
-		if (value != NULL) {
-
-			vortex_log (VORTEX_LEVEL_DEBUG, "received method value with type: (%d)", 
-				    method_value_get_type (value));
+	/* perform here the code to read data received */
+	vortex_log (VORTEX_LEVEL_DEBUG, "received method value with type: (%d)", 
+		    method_value_get_type (value));
 			
-			/* create the response object */
-			response = vortex_xml_rpc_method_response_new (XML_RPC_OK,
-								       -1, NULL, /* fault code especification */
-								       value);
-			/* notify reply received */
-			__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_OK,
-							  -1, NULL,
-							  channel, response, user_data);
-		}else {
-			/* notify reply received */
-			__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_BAD_REPLY_RECEIVED,
-							  -1, "received a positive formated method response but, the content inside, is not properly formated",
-							  channel, NULL, user_data);
-		}
-
-		/* free the document */
-		axl_doc_free (doc);
-		return;
-	}
-	
-	
-	/* it seems that we have received something that is not the
-	 * data expected */
-	__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_BAD_REPLY_RECEIVED,
-					  -1, "received a bad child top level node to <methodResponse>",
-					  channel, NULL, user_data);
-	/* nothing more to do */
-	axl_doc_free (doc);
-
-
+	/* create the response object */
+	response = vortex_xml_rpc_method_response_new (XML_RPC_OK,
+						       -1, NULL, /* fault code especification */
+						       value);
+	/* notify reply received */
+	__vortex_xml_rpc_notify_response (reply_notify, XML_RPC_OK,
+					  -1, NULL,
+					  channel, response, user_data);
 	return;
 }
 
@@ -1449,6 +2334,7 @@ axl_bool                 vortex_xml_rpc_invoke                  (VortexChannel
 	data->invocator    = method_call;
 	data->reply_notify = reply_notify;
 	data->user_data    = user_data;
+	data->reply_reader = vortex_xml_rpc_method_call_get_reply_reader (method_call, &data->reply_destroy);
 
 	/* perform the invocation in a non blocking manner */
 	vortex_thread_pool_new_task (ctx, (VortexThreadFunc) __vortex_xml_rpc_invoke, data);
@@ -1623,82 +2509,10 @@ VortexXmlRpcState   vortex_xml_rpc_channel_status   (VortexChannel * channel)
  */
 XmlRpcMethodCall * __vortex_xml_rpc_frame_received_parse_method_call (VortexFrame * frame)
 {
-	axlDoc            * doc;
-	axlNode           * node;
-	axlNode           * node_aux;
-	
-	const char        * method_name;
-	int                 param_count;
-	int                 iterator;
-
-	XmlRpcMethodCall  * method_call;
-	XmlRpcMethodValue * value;
-	/* get a reference to the context */
-	VortexCtx         * ctx = vortex_frame_get_ctx (frame);
-
-	/* parse incoming xml data */
-	doc = axl_doc_parse (vortex_frame_get_payload (frame), 
-			     vortex_frame_get_payload_size (frame), NULL);
-	if (!doc) {
-		vortex_log (VORTEX_LEVEL_DEBUG, "unable to parse incoming xml data");
-		return NULL;
-	}
-	
-	/* get method name */
-	method_name = axl_doc_get_content_at (doc, "/methodCall/methodName", NULL);
-	if (method_name == NULL) {
-		vortex_log (VORTEX_LEVEL_CRITICAL, "unable to get method name value");
-
-		/* free the document */
-		axl_doc_free (doc);
-		return NULL;
-	}
-
-	/* get a reference to the <params> node */
-	node        = axl_doc_get (doc, "/methodCall/params");
-
-	/* get how many childs have the <params> tag */
-	if (node != NULL)
-		param_count = axl_node_get_child_num (node);
-	else
-		param_count = 0;
-
-	vortex_log (VORTEX_LEVEL_DEBUG, "invocation detected for: %s, with %d parameters", method_name, param_count);
-
-	/* build the method call */
-	method_call = method_call_new (vortex_frame_get_ctx (frame), method_name, param_count);
-
-	/* now get all parameters */
-	iterator = 0;
-	while ((param_count > 0) && (iterator < axl_node_get_child_num (node))) {
-		
-		/* get a reference a reference to the <param> tag */
-		node_aux = axl_node_get_child_nth (node, iterator);
-
-		vortex_log (VORTEX_LEVEL_DEBUG, "node name=<%s>", 
-		       axl_node_get_name (node_aux));
-		
-		/* get a referece to the <value> tag inside */
-		node_aux = axl_node_get_child_nth (node_aux, 0);
-
-		vortex_log (VORTEX_LEVEL_DEBUG, "node name(2)=<%s>", 
-		       axl_node_get_name (node_aux));
-
-		/* parse param value and add it to the method call */
-		value = __vortex_xml_rpc_parse_value (ctx, node_aux);
-		
-		/* add the value to the method call */
-		method_call_add_value (method_call, value);
-		
-		/* get a reference to the next element */
-		iterator++;
-	}
-
-	/* free xml document */
-	axl_doc_free (doc);
-
-	/* return method call received */
-	return method_call;
+	/* unmarshall incoming xml data directly from the payload */
+	return __vortex_xml_rpc_parse_method_call (vortex_frame_get_ctx (frame),
+						   vortex_frame_get_payload (frame), 
+						   vortex_frame_get_payload_size (frame));
 }
 
 /** 
@@ -2944,6 +3758,54 @@ axlPointer vortex_xml_rpc_unmarshall_array_sync (XmlRpcMethodResponse    * respo
 }
 
 
+/** 
+ * @brief Gets the native value read from the \ref
+ * XmlRpcMethodResponse (see \ref
+ * vortex_xml_rpc_method_call_set_reply_reader), setting the fault
+ * code and the fault string, releasing the \ref XmlRpcMethodResponse
+ * passed in.
+ *
+ * This function is used by the C client stubs generated by
+ * xml-rpc-gen with direct marshalling enabled.
+ * 
+ * @param response The XmlRpcMethodResponse to unmarshall.
+ *
+ * @param status A reference to a XmlRpcResponseStatus to return value
+ * stored in the method response.
+ *
+ * @param channel The channel where the XML-RPC message was received.
+ *
+ * @param fault_code The fault code reference to fill up the reference
+ * if an error is found.
+ *
+ * @param fault_string The fault string reference to fill up if an
+ * error is found. 
+ * 
+ * @return The native value, now owned by the caller, or NULL if it
+ * fails.
+ */
+axlPointer vortex_xml_rpc_unmarshall_native_sync (XmlRpcMethodResponse  * response, 
+						  XmlRpcResponseStatus  * status, 
+						  VortexChannel         * channel,
+						  int                   * fault_code,
+						  char                 ** fault_string)
+{
+	axlPointer result = NULL;
+
+	/* get status/fault_code/fault_string */
+	__vortex_xml_rpc_unmarshall_common_sync (response, status, channel, fault_code, fault_string);
+	if (method_response_get_status (response) == XML_RPC_OK) {
+		/* take the native value */
+		result = vortex_xml_rpc_method_response_get_native (response);
+		vortex_xml_rpc_method_response_nullify (response);
+	} /* end if */
+
+	/* free response received */
+	method_response_free (response);
+
+	return result;
+}
+
 /** 
  * @brief Inits the vortex xml-rpc module state.
  *
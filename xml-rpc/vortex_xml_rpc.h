@@ -321,14 +321,6 @@ axl_bool            vortex_xml_rpc_accept_negotiation      (VortexCtx
 
 axl_bool            vortex_xml_rpc_listener_parse_conf_and_start_listeners (VortexCtx * ctx);
 
-/** 
- * @internal
- * 
- * Internal prototype declaration to support a reference from
- * __vortex_xml_rpc_parse_struct_value to this function.
- */
-XmlRpcMethodValue * __vortex_xml_rpc_parse_value (VortexCtx * ctx, axlNode * value);
-
 /* int unmarshallers */
 void vortex_xml_rpc_unmarshall_int      (VortexChannel *channel, 
 					 XmlRpcMethodResponse *response, 
@@ -387,6 +379,41 @@ axlPointer vortex_xml_rpc_unmarshall_array_sync (XmlRpcMethodResponse    * respo
 						 int                     * fault_code,
 						 char                   ** fault_string);
 
+/* native unmarshallers */
+axlPointer vortex_xml_rpc_unmarshall_native_sync (XmlRpcMethodResponse  * response, 
+						  XmlRpcResponseStatus  * status, 
+						  VortexChannel         * channel,
+						  int                   * fault_code,
+						  char                 ** fault_string);
+
+/* readers used by XmlRpcReplyReader handlers */
+axl_bool            vortex_xml_rpc_reader_int               (XmlRpcReader  * reader, 
+							     int           * value);
+
+axl_bool            vortex_xml_rpc_reader_double            (XmlRpcReader  * reader, 
+							     double        * value);
+
+axl_bool            vortex_xml_rpc_reader_string            (XmlRpcReader  * reader, 
+							     char         ** value);
+
+axl_bool            vortex_xml_rpc_reader_struct_open       (XmlRpcReader  * reader, 
+							     axl_bool      * is_none);
+
+axl_bool            vortex_xml_rpc_reader_struct_next       (XmlRpcReader  * reader, 
+							     const char   ** name);
+
+axl_bool            vortex_xml_rpc_reader_member_close      (XmlRpcReader  * reader);
+
+axl_bool            vortex_xml_rpc_reader_array_open        (XmlRpcReader  * reader, 
+							     axl_bool      * is_none);
+
+axl_bool            vortex_xml_rpc_reader_array_next        (XmlRpcReader  * reader, 
+							     axl_bool      * more);
+
+XmlRpcMethodValue * vortex_xml_rpc_reader_value             (XmlRpcReader  * reader);
+
+axl_bool            vortex_xml_rpc_reader_skip              (XmlRpcReader  * reader);
+
 axl_bool  vortex_xml_rpc_init    (VortexCtx * ctx);
 
 void      vortex_xml_rpc_cleanup (VortexCtx * ctx);
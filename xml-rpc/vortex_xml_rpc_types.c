@@ -105,6 +105,23 @@ struct _XmlRpcMethodCall {
 	 * correlate the method reply to be generated.
 	 */
 	int                   msg_no;
+
+	/** 
+	 * @internal
+	 *
+	 * Params already marshalled through a \ref XmlRpcWriter
+	 * (used instead of params).
+	 */
+	XmlRpcWriter        * writer;
+
+	/** 
+	 * @internal
+	 *
+	 * Optional reader used to unmarshall the reply value straight
+	 * into a native type, and the function to release it.
+	 */
+	XmlRpcReplyReader     reply_reader;
+	axlDestroyFunc        reply_destroy;
 };
 
 struct _XmlRpcMethodResponse {
@@ -142,6 +159,20 @@ struct _XmlRpcMethodResponse {
 	 */
 	char                 * fault_string;
 
+	/** 
+	 * @internal
+	 * @brief Reply value already marshalled (used instead of value).
+	 */
+	XmlRpcWriter         * writer;
+
+	/** 
+	 * @internal
+	 * @brief Reply value read into a native type by a \ref
+	 * XmlRpcReplyReader (used instead of value) and the function
+	 * to release it.
+	 */
+	axlPointer             native;
+	axlDestroyFunc         native_destroy;
 };
 
 
@@ -202,8 +233,21 @@ struct _XmlRpcStruct {
 	 * @brief An array of members stored on this struct.
 	 */
 	XmlRpcStructMember ** members;
+
+	/** 
+	 * @internal Member index by name, only built once the struct
+	 * holds \ref XML_RPC_STRUCT_INDEX_THRESHOLD members so small
+	 * structs keep using the plain scan.
+	 */
+	axlHash             * index;
 };
 
+/** 
+ * @internal Number of members from which struct lookups by name are
+ * served from a hash rather than scanning all members.
+ */
+#define XML_RPC_STRUCT_INDEX_THRESHOLD 8
+
 struct _XmlRpcStructMember {
 	/**
 	 * @internal
@@ -1271,8 +1315,284 @@ XmlRpcArray       * vortex_xml_rpc_method_call_get_param_value_as_array  (XmlRpc
 	return vortex_xml_rpc_method_value_get_as_array (value);	
 }
 
-/* function prototype */
-char  * vortex_xml_rpc_marshall_method_value (XmlRpcMethodValue * value);
+/** 
+ * @internal
+ *
+ * Growable output buffer used by all marshalling functions so the
+ * XML-RPC message is produced by appending into a single memory
+ * block rather than reformatting the partial result on each
+ * element.
+ */
+typedef struct _XmlRpcMarshallBuffer {
+	char  * content;
+	int     size;
+	int     allocated;
+} XmlRpcMarshallBuffer;
+
+/** 
+ * @internal Initializes the provided buffer with the given initial
+ * capacity.
+ */
+axl_bool __vortex_xml_rpc_buffer_init (XmlRpcMarshallBuffer * buffer, int initial)
+{
+	if (initial < 64)
+		initial = 64;
+
+	buffer->content   = axl_new (char, initial);
+	buffer->size      = 0;
+	buffer->allocated = initial;
+
+	return buffer->content != NULL;
+}
+
+/** 
+ * @internal Appends the provided content (with the given size) to the
+ * buffer, doubling its capacity when required so the overall
+ * marshalling cost keeps linear with the message size.
+ */
+axl_bool __vortex_xml_rpc_buffer_append (XmlRpcMarshallBuffer * buffer, const char * content, int size)
+{
+	char * new_content;
+	int    new_allocated;
+
+	if (buffer->content == NULL)
+		return axl_false;
+
+	if (size < 0)
+		size = strlen (content);
+
+	/* keep room for the trailing \0 */
+	if ((buffer->size + size + 1) > buffer->allocated) {
+		new_allocated = buffer->allocated;
+		while ((buffer->size + size + 1) > new_allocated)
+			new_allocated = new_allocated * 2;
+
+		new_content = axl_realloc (buffer->content, new_allocated);
+		if (new_content == NULL) {
+			axl_free (buffer->content);
+			buffer->content = NULL;
+			return axl_false;
+		} /* end if */
+		buffer->content   = new_content;
+		buffer->allocated = new_allocated;
+	} /* end if */
+
+	memcpy (buffer->content + buffer->size, content, size);
+	buffer->size                   += size;
+	buffer->content[buffer->size]   = 0;
+
+	return axl_true;
+}
+
+/** 
+ * @internal Appends a static string to the buffer.
+ */
+#define __vortex_xml_rpc_buffer_append_str(buffer, str) __vortex_xml_rpc_buffer_append (buffer, str, sizeof (str) - 1)
+
+/** 
+ * @internal Appends the provided text escaping xml entities (&, < and
+ * >). Used for element content that is not placed inside a CDATA
+ * section (method and member names).
+ */
+axl_bool __vortex_xml_rpc_buffer_append_escaped (XmlRpcMarshallBuffer * buffer, const char * content)
+{
+	const char * start;
+
+	if (content == NULL)
+		return axl_true;
+
+	start = content;
+	while (*content) {
+		if (*content == '&' || *content == '<' || *content == '>') {
+			/* flush pending content */
+			if (! __vortex_xml_rpc_buffer_append (buffer, start, content - start))
+				return axl_false;
+			if (*content == '&') {
+				if (! __vortex_xml_rpc_buffer_append_str (buffer, "&amp;"))
+					return axl_false;
+			} else if (*content == '<') {
+				if (! __vortex_xml_rpc_buffer_append_str (buffer, "&lt;"))
+					return axl_false;
+			} else {
+				if (! __vortex_xml_rpc_buffer_append_str (buffer, "&gt;"))
+					return axl_false;
+			} /* end if */
+			start = content + 1;
+		} /* end if */
+		content++;
+	} /* end while */
+
+	return __vortex_xml_rpc_buffer_append (buffer, start, content - start);
+}
+
+/** 
+ * @internal Appends the provided text as a CDATA section. Any "]]>"
+ * found inside the text is split across two sections so the
+ * content can't close the section prematurely.
+ */
+axl_bool __vortex_xml_rpc_buffer_append_cdata (XmlRpcMarshallBuffer * buffer, const char * content)
+{
+	const char * start;
+
+	if (! __vortex_xml_rpc_buffer_append_str (buffer, "<![CDATA["))
+		return axl_false;
+
+	if (content != NULL) {
+		start = content;
+		while (*content) {
+			if (content[0] == ']' && content[1] == ']' && content[2] == '>') {
+				/* flush up to "]]" and reopen a new section before ">" */
+				if (! __vortex_xml_rpc_buffer_append (buffer, start, (content - start) + 2))
+					return axl_false;
+				if (! __vortex_xml_rpc_buffer_append_str (buffer, "]]><![CDATA["))
+					return axl_false;
+				content += 2;
+				start    = content;
+				continue;
+			} /* end if */
+			content++;
+		} /* end while */
+
+		if (! __vortex_xml_rpc_buffer_append (buffer, start, content - start))
+			return axl_false;
+	} /* end if */
+
+	return __vortex_xml_rpc_buffer_append_str (buffer, "]]>");
+}
+
+/* function prototypes */
+axl_bool __vortex_xml_rpc_marshall_value_to  (XmlRpcMarshallBuffer * buffer, XmlRpcMethodValue * value);
+char  *  vortex_xml_rpc_marshall_method_value (XmlRpcMethodValue * value);
+
+/** 
+ * @internal Writes the provided struct into the buffer.
+ */
+axl_bool __vortex_xml_rpc_marshall_struct_to (XmlRpcMarshallBuffer * buffer, XmlRpcStruct * _struct)
+{
+	int iterator;
+
+	if (! __vortex_xml_rpc_buffer_append_str (buffer, "<struct>"))
+		return axl_false;
+
+	for (iterator = 0; iterator < _struct->added_count; iterator++) {
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "<member><name>"))
+			return axl_false;
+		if (! __vortex_xml_rpc_buffer_append_escaped (buffer, _struct->members[iterator]->name))
+			return axl_false;
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "</name>"))
+			return axl_false;
+		if (! __vortex_xml_rpc_marshall_value_to (buffer, _struct->members[iterator]->value))
+			return axl_false;
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "</member>"))
+			return axl_false;
+	} /* end for */
+
+	return __vortex_xml_rpc_buffer_append_str (buffer, "</struct>");
+}
+
+/** 
+ * @internal Writes the provided array into the buffer.
+ */
+axl_bool __vortex_xml_rpc_marshall_array_to (XmlRpcMarshallBuffer * buffer, XmlRpcArray * array)
+{
+	int iterator;
+
+	if (! __vortex_xml_rpc_buffer_append_str (buffer, "<array><data>"))
+		return axl_false;
+
+	for (iterator = 0; iterator < array->added_count; iterator++) {
+		if (! __vortex_xml_rpc_marshall_value_to (buffer, array->values[iterator]))
+			return axl_false;
+	} /* end for */
+
+	return __vortex_xml_rpc_buffer_append_str (buffer, "</data></array>");
+}
+
+/** 
+ * @internal Writes the provided method value (including its
+ * <value> envelope) into the buffer.
+ *
+ * @return axl_false if the value type can't be marshalled (date
+ * values are not implemented yet) or memory allocation fails.
+ */
+axl_bool __vortex_xml_rpc_marshall_value_to (XmlRpcMarshallBuffer * buffer, XmlRpcMethodValue * value)
+{
+	char number[64];
+	int  size;
+
+	if (value == NULL)
+		return axl_false;
+
+	switch (method_value_get_type (value)) {
+	case XML_RPC_INT_VALUE:
+		size = snprintf (number, sizeof (number), "<value><i4>%d</i4></value>", 
+				 method_value_get_as_int (value));
+		return __vortex_xml_rpc_buffer_append (buffer, number, size);
+	case XML_RPC_BOOLEAN_VALUE:
+		size = snprintf (number, sizeof (number), "<value><boolean>%d</boolean></value>", 
+				 method_value_get_as_int (value));
+		return __vortex_xml_rpc_buffer_append (buffer, number, size);
+	case XML_RPC_DOUBLE_VALUE:
+		size = snprintf (number, sizeof (number), "<value><double>%g</double></value>", 
+				 method_value_get_as_double (value));
+		return __vortex_xml_rpc_buffer_append (buffer, number, size);
+	case XML_RPC_STRING_VALUE:
+	case XML_RPC_STRING_REF_VALUE:
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "<value><string>"))
+			return axl_false;
+		if (! __vortex_xml_rpc_buffer_append_cdata (buffer, (char  *) value->value.string_value))
+			return axl_false;
+		return __vortex_xml_rpc_buffer_append_str (buffer, "</string></value>");
+	case XML_RPC_BASE64_VALUE:
+	case XML_RPC_BASE64_REF_VALUE:
+		/* base64 alphabet doesn't require escaping */
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "<value><base64>"))
+			return axl_false;
+		if (value->value.string_value != NULL && 
+		    ! __vortex_xml_rpc_buffer_append (buffer, value->value.string_value, -1))
+			return axl_false;
+		return __vortex_xml_rpc_buffer_append_str (buffer, "</base64></value>");
+	case XML_RPC_STRUCT_VALUE:
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "<value>"))
+			return axl_false;
+		if (! __vortex_xml_rpc_marshall_struct_to (buffer, value->value.rpc_struct))
+			return axl_false;
+		return __vortex_xml_rpc_buffer_append_str (buffer, "</value>");
+	case XML_RPC_ARRAY_VALUE:
+		if (! __vortex_xml_rpc_buffer_append_str (buffer, "<value>"))
+			return axl_false;
+		if (! __vortex_xml_rpc_marshall_array_to (buffer, value->value.rpc_array))
+			return axl_false;
+		return __vortex_xml_rpc_buffer_append_str (buffer, "</value>");
+	case XML_RPC_NONE_VALUE:
+		/* return the none value */
+		return __vortex_xml_rpc_buffer_append_str (buffer, "<value><none /></value>");
+	case XML_RPC_DATE_VALUE:
+		/* not implemented yet */
+	default:
+		/* nothing to do */
+		return axl_false;
+	}
+	
+	/* this point is never reached */
+	return axl_false;
+}
+
+/** 
+ * @internal Releases the buffer content in case of failure or returns
+ * it to the caller (updating size) if the marshalling was completed.
+ */
+char * __vortex_xml_rpc_buffer_finish (XmlRpcMarshallBuffer * buffer, axl_bool status, int * size)
+{
+	if (! status) {
+		axl_free (buffer->content);
+		return NULL;
+	} /* end if */
+
+	if (size != NULL)
+		(* size) = buffer->size;
+	return buffer->content;
+}
 
 /** 
  * @internal
@@ -1287,44 +1607,12 @@ char  * vortex_xml_rpc_marshall_method_value (XmlRpcMethodValue * value);
  */
 char  * vortex_xml_rpc_types_marshall_struct (XmlRpcStruct * _struct)
 {
-	char  * stream_aux;
-	char  * stream_aux2;
-	char  * stream_result;
-	int     iterator;
-	
-
-	/* initial struct header */
-	stream_result = axl_strdup ("<struct>");
-	iterator      = 0;
-
-	while (iterator < _struct->added_count) {
+	XmlRpcMarshallBuffer buffer;
 
-		/* marshall the method member */
-		stream_aux2 = vortex_xml_rpc_marshall_method_value (_struct->members[iterator]->value);
-		
-		/* get the member representation */
-		stream_aux  = axl_strdup_printf ("%s<member><name>%s</name>%s</member>",
-						 stream_result,
-						 _struct->members[iterator]->name,
-						 stream_aux2);
-
-		/* release the member method value allocated */
-		axl_free (stream_aux2);
-		axl_free (stream_result);
-
-		/* update the new stream result */
-		stream_result = stream_aux;
+	if (! __vortex_xml_rpc_buffer_init (&buffer, 256))
+		return NULL;
 
-		/* update iterator count */
-		iterator++;
-	}
-	
-	/* add final representation for the struct */
-	stream_aux   = stream_result;
-	stream_result = axl_strdup_printf ("%s</struct>", stream_result);
-	axl_free (stream_aux);
-	
-	return stream_result;
+	return __vortex_xml_rpc_buffer_finish (&buffer, __vortex_xml_rpc_marshall_struct_to (&buffer, _struct), NULL);
 }
 
 
@@ -1340,42 +1628,12 @@ char  * vortex_xml_rpc_types_marshall_struct (XmlRpcStruct * _struct)
  */
 char  * vortex_xml_rpc_types_marshall_array (XmlRpcArray * array)
 {
-	char  * stream_aux;
-	char  * stream_aux2;
-	char  * stream_result;
-	int     iterator;
-
-	/* initial struct header */
-	stream_result = axl_strdup ("<array><data>");
-	iterator      = 0;
-
-	while (iterator < array->added_count) {
-
-		/* marshall the method member */
-		stream_aux2 = vortex_xml_rpc_marshall_method_value (array->values[iterator]);
-		
-		/* get the member representation */
-		stream_aux  = axl_strdup_printf ("%s%s",
-						 stream_result,
-						 stream_aux2);
-
-		/* release the member method value allocated */
-		axl_free (stream_aux2);
-		axl_free (stream_result);
+	XmlRpcMarshallBuffer buffer;
 
-		/* update the new stream result */
-		stream_result = stream_aux;
+	if (! __vortex_xml_rpc_buffer_init (&buffer, 256))
+		return NULL;
 
-		/* update iterator count */
-		iterator++;
-	}
-	
-	/* add final representation for the struct */
-	stream_aux    = stream_result;
-	stream_result = axl_strdup_printf ("%s</data></array>", stream_result);
-	axl_free (stream_aux);
-	
-	return stream_result;
+	return __vortex_xml_rpc_buffer_finish (&buffer, __vortex_xml_rpc_marshall_array_to (&buffer, array), NULL);
 }
 
 /** 
@@ -1389,65 +1647,277 @@ char  * vortex_xml_rpc_types_marshall_array (XmlRpcArray * array)
  */
 char  * vortex_xml_rpc_marshall_method_value (XmlRpcMethodValue * value)
 {
-	char  * stream_result;
-	char  * stream_aux;
+	XmlRpcMarshallBuffer buffer;
 
-	switch (method_value_get_type (value)) {
-	case XML_RPC_INT_VALUE:
-		return axl_strdup_printf ("<value><i4>%d</i4></value>", 
-					  method_value_get_as_int (value));
-		break;
-	case XML_RPC_BOOLEAN_VALUE:
-		return axl_strdup_printf ("<value><boolean>%d</boolean></value>", 
-					  method_value_get_as_int (value));
-	case XML_RPC_DOUBLE_VALUE:
-		return axl_strdup_printf ("<value><double>%g</double></value>", 
-					  method_value_get_as_double (value));
-		break;
-	case XML_RPC_STRING_VALUE:
-		return axl_strdup_printf ("<value><string><![CDATA[%s]]></string></value>",
-					  (char  *) value->value.string_value);
-		break;
-	case XML_RPC_DATE_VALUE:
-		/* not implemented yet */
-		break;
+	if (! __vortex_xml_rpc_buffer_init (&buffer, 128))
+		return NULL;
 
-	case XML_RPC_BASE64_VALUE:
-		/* not implemented yet */
-		break;
-	case XML_RPC_STRUCT_VALUE:
-		/* marshall the value */
-		stream_aux    = vortex_xml_rpc_types_marshall_struct (value->value.rpc_struct);
-		
-		/* use the value marshalled */
-		stream_result = axl_strdup_printf ("<value>%s</value>",
-						   stream_aux);
-		/* free the marshalled value */
-		axl_free (stream_aux);
+	return __vortex_xml_rpc_buffer_finish (&buffer, __vortex_xml_rpc_marshall_value_to (&buffer, value), NULL);
+}
 
-		return stream_result;
-	case XML_RPC_ARRAY_VALUE:
-		/* marshall the value */
-		stream_aux    = vortex_xml_rpc_types_marshall_array (value->value.rpc_array);
-		
-		/* use the value marshalled */
-		stream_result = axl_strdup_printf ("<value>%s</value>",
-						   stream_aux);
-		/* free the marshalled value */
-		axl_free (stream_aux);
+/** 
+ * @internal
+ *
+ * Writer used by generated code (and any code knowing the value
+ * types in advance) to marshall values straight into a buffer
+ * without building \ref XmlRpcMethodValue trees.
+ */
+struct _XmlRpcWriter {
+	XmlRpcMarshallBuffer   buffer;
+	axl_bool               failed;
+};
 
-		return stream_result;
-		break;
-	case XML_RPC_NONE_VALUE:
-		/* return the none value */
-		return axl_strdup_printf ("<value><none /></value>");
-	default:
-		/* nothing to do */
+/** 
+ * @internal Records the result of a write operation, keeping the
+ * writer failed once an operation fails.
+ */
+#define __vortex_xml_rpc_writer_status(writer, op) do { if ((writer) != NULL && ! (writer)->failed && ! (op)) (writer)->failed = axl_true; } while (0)
+
+/** 
+ * @brief Creates a new \ref XmlRpcWriter that allows to marshall
+ * values directly into its internal buffer.
+ *
+ * Writers are used to produce method call params (see \ref
+ * vortex_xml_rpc_method_call_set_writer) or method response values
+ * (see \ref vortex_xml_rpc_method_response_new_from_writer) without
+ * creating intermediate \ref XmlRpcMethodValue objects. Write
+ * operations do not report errors: once one fails, the writer is
+ * flagged and the method call or reply using it will fail.
+ *
+ * @param size_hint Initial buffer size (0 for the default size).
+ *
+ * @return A newly allocated writer or NULL if it fails.
+ */
+XmlRpcWriter      * vortex_xml_rpc_writer_new               (int  size_hint)
+{
+	XmlRpcWriter * writer;
+
+	writer = axl_new (XmlRpcWriter, 1);
+	if (writer == NULL)
 		return NULL;
-	}
-	
-	/* this point is never reached */
-	return NULL;
+
+	if (! __vortex_xml_rpc_buffer_init (&writer->buffer, size_hint > 0 ? size_hint : 256)) {
+		axl_free (writer);
+		return NULL;
+	} /* end if */
+
+	return writer;
+}
+
+/** 
+ * @brief Writes an int value (<value><i4>).
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_int               (XmlRpcWriter * writer, int  value)
+{
+	char number[64];
+	int  size;
+
+	size = snprintf (number, sizeof (number), "<value><i4>%d</i4></value>", value);
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append (&writer->buffer, number, size));
+	return;
+}
+
+/** 
+ * @brief Writes a boolean value (<value><boolean>).
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_boolean           (XmlRpcWriter * writer, axl_bool  value)
+{
+	if (value)
+		__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><boolean>1</boolean></value>"));
+	else
+		__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><boolean>0</boolean></value>"));
+	return;
+}
+
+/** 
+ * @brief Writes a double value (<value><double>).
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_double            (XmlRpcWriter * writer, double  value)
+{
+	char number[64];
+	int  size;
+
+	size = snprintf (number, sizeof (number), "<value><double>%g</double></value>", value);
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append (&writer->buffer, number, size));
+	return;
+}
+
+/** 
+ * @brief Writes a string value (<value><string>). A NULL value is
+ * written as an empty string.
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_string            (XmlRpcWriter * writer, const char * value)
+{
+	__vortex_xml_rpc_writer_status (writer, 
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><string>") &&
+					__vortex_xml_rpc_buffer_append_cdata (&writer->buffer, value) &&
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "</string></value>"));
+	return;
+}
+
+/** 
+ * @brief Writes a base64 value (<value><base64>). The value must be
+ * already base64 encoded. A NULL value is written as an empty value.
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_base64            (XmlRpcWriter * writer, const char * value)
+{
+	__vortex_xml_rpc_writer_status (writer, 
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><base64>") &&
+					(value == NULL || __vortex_xml_rpc_buffer_append (&writer->buffer, value, -1)) &&
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "</base64></value>"));
+	return;
+}
+
+/** 
+ * @brief Writes a none value (<value><none />).
+ *
+ * @param writer The writer where the value is written.
+ */
+void                vortex_xml_rpc_writer_none              (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><none /></value>"));
+	return;
+}
+
+/** 
+ * @brief Writes the provided \ref XmlRpcMethodValue, allowing to mix
+ * generic values with values written directly.
+ *
+ * @param writer The writer where the value is written.
+ * @param value The value to write.
+ */
+void                vortex_xml_rpc_writer_value             (XmlRpcWriter * writer, XmlRpcMethodValue * value)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_marshall_value_to (&writer->buffer, value));
+	return;
+}
+
+/** 
+ * @brief Opens a struct value (<value><struct>). Members are added
+ * with \ref vortex_xml_rpc_writer_member, followed by its value and
+ * \ref vortex_xml_rpc_writer_member_close. The struct is closed with
+ * \ref vortex_xml_rpc_writer_struct_close.
+ *
+ * @param writer The writer where the struct is written.
+ */
+void                vortex_xml_rpc_writer_struct_open       (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><struct>"));
+	return;
+}
+
+/** 
+ * @brief Opens a struct member with the provided name (<member><name>).
+ *
+ * @param writer The writer where the member is written.
+ * @param name The member name.
+ */
+void                vortex_xml_rpc_writer_member            (XmlRpcWriter * writer, const char * name)
+{
+	__vortex_xml_rpc_writer_status (writer, 
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "<member><name>") &&
+					__vortex_xml_rpc_buffer_append_escaped (&writer->buffer, name) &&
+					__vortex_xml_rpc_buffer_append_str (&writer->buffer, "</name>"));
+	return;
+}
+
+/** 
+ * @brief Closes the member opened by \ref vortex_xml_rpc_writer_member.
+ *
+ * @param writer The writer where the member is written.
+ */
+void                vortex_xml_rpc_writer_member_close      (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "</member>"));
+	return;
+}
+
+/** 
+ * @brief Closes the struct opened by \ref vortex_xml_rpc_writer_struct_open.
+ *
+ * @param writer The writer where the struct is written.
+ */
+void                vortex_xml_rpc_writer_struct_close      (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "</struct></value>"));
+	return;
+}
+
+/** 
+ * @brief Opens an array value (<value><array><data>). Items are
+ * written with the value functions and the array is closed with
+ * \ref vortex_xml_rpc_writer_array_close.
+ *
+ * @param writer The writer where the array is written.
+ */
+void                vortex_xml_rpc_writer_array_open        (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<value><array><data>"));
+	return;
+}
+
+/** 
+ * @brief Closes the array opened by \ref vortex_xml_rpc_writer_array_open.
+ *
+ * @param writer The writer where the array is written.
+ */
+void                vortex_xml_rpc_writer_array_close       (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "</data></array></value>"));
+	return;
+}
+
+/** 
+ * @brief Opens a method call parameter (<param>). Used when the
+ * writer holds method call params (see \ref
+ * vortex_xml_rpc_method_call_set_writer).
+ *
+ * @param writer The writer where the param is written.
+ */
+void                vortex_xml_rpc_writer_param_open        (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "<param>"));
+	return;
+}
+
+/** 
+ * @brief Closes the param opened by \ref vortex_xml_rpc_writer_param_open.
+ *
+ * @param writer The writer where the param is written.
+ */
+void                vortex_xml_rpc_writer_param_close       (XmlRpcWriter * writer)
+{
+	__vortex_xml_rpc_writer_status (writer, __vortex_xml_rpc_buffer_append_str (&writer->buffer, "</param>"));
+	return;
+}
+
+/** 
+ * @brief Releases the provided writer and its content.
+ *
+ * @param writer The writer to release.
+ */
+void                vortex_xml_rpc_writer_free              (XmlRpcWriter * writer)
+{
+	if (writer == NULL)
+		return;
+	axl_free (writer->buffer.content);
+	axl_free (writer);
+	return;
 }
 
 /**
@@ -1501,73 +1971,58 @@ char              * vortex_xml_rpc_method_call_marshall     (XmlRpcMethodCall  *
 #if defined(ENABLE_VORTEX_LOG) && ! defined(SHOW_FORMAT_BUGS)
 	VortexCtx         * ctx = METHOD_CALL_CTX(method_call);
 #endif
-	XmlRpcMethodValue * value;
-	char              * stream_result;
-	char              * stream_aux;
-	char              * stream_aux2;
-
-	int                 iterator;
+	XmlRpcMarshallBuffer buffer;
+	axl_bool             status;
+	int                  iterator;
 
 	v_return_val_if_fail_msg (method_call, NULL, 
 				  "failed to marshall method call, received null reference for method call");
 	v_return_val_if_fail_msg (method_call->count == method_call->added_count, NULL, 
 				  "failed to marshall method call, number of parameters added do not match (added count != count)");
 
+	/* all the message is written into a single growable buffer */
+	if (! __vortex_xml_rpc_buffer_init (&buffer, 256 + (method_call->count * 64)))
+		return NULL;
+
 	/* get initial method header */
-	stream_result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodCall><methodName>%s</methodName>",
-					   method_call->methodName);
+	status = __vortex_xml_rpc_buffer_append_str (&buffer, "<?xml version=\"1.0\"?><methodCall><methodName>") &&
+		__vortex_xml_rpc_buffer_append_escaped (&buffer, method_call->methodName) &&
+		__vortex_xml_rpc_buffer_append_str (&buffer, "</methodName>");
 
 	/* if the method have at least one parameter, add them */
-	if (method_call->count > 0) {
-		/* get a refence to the previous message, add initial
-		 * <params> header and release no longer used
-		 * memory */
-		stream_aux    = stream_result;
-		stream_result = axl_strdup_printf ("%s<params>", stream_aux);
-		axl_free (stream_aux);
+	if (status && method_call->count > 0) {
+		status = __vortex_xml_rpc_buffer_append_str (&buffer, "<params>");
 
 		/* iterate over all param values */
-		for (iterator = 0; iterator < method_call->count; iterator++) {
-			/* get a reference to the value */
-			value       = method_call_get_param_value (method_call, iterator);
-			
-			/* marshall the param value according to its type */
-			stream_aux  = vortex_xml_rpc_marshall_method_value (value);
-			
-			/* get the concatenated result */
-			stream_aux2 = axl_strdup_printf ("%s<param>%s</param>", stream_result, stream_aux);
-			
-			/* free previous data */
-			axl_free (stream_aux);
-			axl_free (stream_result);
-
-			/* set the new stream result */
-			stream_result = stream_aux2;
+		for (iterator = 0; status && iterator < method_call->count; iterator++) {
+			status = __vortex_xml_rpc_buffer_append_str (&buffer, "<param>") &&
+				__vortex_xml_rpc_marshall_value_to (&buffer, method_call_get_param_value (method_call, iterator)) &&
+				__vortex_xml_rpc_buffer_append_str (&buffer, "</param>");
+		} /* end for */
+
+		/* finally close the param values section */
+		if (status)
+			status = __vortex_xml_rpc_buffer_append_str (&buffer, "</params>");
+	} else if (status && method_call->writer != NULL) {
+		/* params already marshalled */
+		status = ! method_call->writer->failed &&
+			__vortex_xml_rpc_buffer_append_str (&buffer, "<params>") &&
+			__vortex_xml_rpc_buffer_append (&buffer, method_call->writer->buffer.content, method_call->writer->buffer.size) &&
+			__vortex_xml_rpc_buffer_append_str (&buffer, "</params>");
+	} /* end if */
 
-		}
+	/* close the message */
+	if (status)
+		status = __vortex_xml_rpc_buffer_append_str (&buffer, "</methodCall>");
 
-		/* finally close the param values section for the
-		 * invocation xml message */
-		stream_aux    = stream_result;
-		stream_result = axl_strdup_printf ("%s</params>", 
-						   (stream_aux != NULL) ? stream_aux : NULL);
-		axl_free (stream_aux);
-	}
+	if (! status) {
+		vortex_log (VORTEX_LEVEL_CRITICAL, "failed to marshall method call %s, unsupported parameter type or memory allocation failure",
+			    method_call->methodName);
+	} /* end if */
 
-	/* close the message and return the value */
-	stream_aux    = stream_result;
-	stream_result = axl_strdup_printf ("%s</methodCall>", stream_aux);
-	axl_free (stream_aux);
-	
-	/* return current result, setting current size. The following
-	 * operation is based on strlen operation. This is ok because
-	 * XML-RPC standard doesn't support raw binary formats. To
-	 * include binary data, it should be encoded into a base64
-	 * format.
-	 */
-	if (size != NULL) 
-		(* size ) = strlen (stream_result);
-	return stream_result;
+	/* return current result, setting current size from the
+	 * buffer (no strlen required) */
+	return __vortex_xml_rpc_buffer_finish (&buffer, status, size);
 }
 
 
@@ -1592,6 +2047,7 @@ void                vortex_xml_rpc_method_call_free         (XmlRpcMethodCall  *
 
 	/* unref params container */
 	axl_free (method_call->params);
+	vortex_xml_rpc_writer_free (method_call->writer);
 	
 	/* unref methodName value */
 	axl_free (method_call->methodName);
@@ -1645,6 +2101,80 @@ axl_bool                 vortex_xml_rpc_method_call_must_release (XmlRpcMethodCa
 	return method_call->release_after_invoke;
 }
 
+/** 
+ * @brief Configures params already marshalled through the provided
+ * \ref XmlRpcWriter (written with \ref vortex_xml_rpc_writer_param_open
+ * and \ref vortex_xml_rpc_writer_param_close) to be sent instead of
+ * params added with \ref vortex_xml_rpc_method_call_add_value.
+ *
+ * The method call must be created with 0 params. The writer is
+ * owned by the method call from now on and released with it.
+ * 
+ * @param method_call The method call to configure.
+ *
+ * @param writer The writer holding the marshalled params.
+ *
+ * @return axl_true if the writer was configured, otherwise axl_false
+ * is returned (and the writer is released).
+ */
+axl_bool                 vortex_xml_rpc_method_call_set_writer (XmlRpcMethodCall * method_call,
+								XmlRpcWriter     * writer)
+{
+	if (method_call == NULL || method_call->count != 0) {
+		vortex_xml_rpc_writer_free (writer);
+		return axl_false;
+	} /* end if */
+
+	vortex_xml_rpc_writer_free (method_call->writer);
+	method_call->writer = writer;
+	return axl_true;
+}
+
+/** 
+ * @brief Configures a reader that is used to unmarshall the positive
+ * reply value straight into a native type, skipping the \ref
+ * XmlRpcMethodValue tree. The result is available through \ref
+ * vortex_xml_rpc_method_response_get_native.
+ * 
+ * @param method_call The method call to configure.
+ *
+ * @param reader The reader to use.
+ *
+ * @param destroy Optional function used to release the value
+ * produced by the reader.
+ */
+void                     vortex_xml_rpc_method_call_set_reply_reader (XmlRpcMethodCall  * method_call,
+								      XmlRpcReplyReader   reader,
+								      axlDestroyFunc      destroy)
+{
+	v_return_if_fail (method_call);
+
+	method_call->reply_reader  = reader;
+	method_call->reply_destroy = destroy;
+	return;
+}
+
+/** 
+ * @brief Returns the reply reader configured with \ref
+ * vortex_xml_rpc_method_call_set_reply_reader.
+ * 
+ * @param method_call The method call to check.
+ *
+ * @param destroy Optional reference where the destroy function is
+ * returned.
+ *
+ * @return The reply reader or NULL if not configured.
+ */
+XmlRpcReplyReader        vortex_xml_rpc_method_call_get_reply_reader (XmlRpcMethodCall  * method_call,
+								      axlDestroyFunc    * destroy)
+{
+	if (destroy != NULL)
+		(* destroy) = method_call != NULL ? method_call->reply_destroy : NULL;
+	if (method_call == NULL)
+		return NULL;
+	return method_call->reply_reader;
+}
+
 /** 
  * @brief Allows to check if the given method call meets the requirements provided.
  * 
@@ -2035,6 +2565,80 @@ XmlRpcMethodResponse * vortex_xml_rpc_method_response_new  (XmlRpcResponseStatus
 	return response;
 }
 
+/** 
+ * @brief Creates a new positive \ref XmlRpcMethodResponse object
+ * whose value was already marshalled through the provided \ref
+ * XmlRpcWriter (holding exactly one value).
+ * 
+ * @param writer The writer holding the reply value. The response
+ * owns the writer from now on.
+ * 
+ * @return A new \ref XmlRpcMethodResponse or NULL if it fails.
+ */
+XmlRpcMethodResponse * vortex_xml_rpc_method_response_new_from_writer (XmlRpcWriter * writer)
+{
+	XmlRpcMethodResponse * response;
+
+	v_return_val_if_fail (writer, NULL);
+
+	response = axl_new (XmlRpcMethodResponse, 1);
+	if (response == NULL) {
+		vortex_xml_rpc_writer_free (writer);
+		return NULL;
+	} /* end if */
+	response->status = XML_RPC_OK;
+	response->writer = writer;
+
+	return response;
+}
+
+/** 
+ * @brief Creates a new positive \ref XmlRpcMethodResponse object
+ * holding a value already unmarshalled into a native type (see \ref
+ * XmlRpcReplyReader).
+ * 
+ * @param native The native value.
+ *
+ * @param native_destroy Optional function to release the native
+ * value with the response.
+ * 
+ * @return A new \ref XmlRpcMethodResponse or NULL if it fails.
+ */
+XmlRpcMethodResponse * vortex_xml_rpc_method_response_new_from_native (axlPointer      native,
+									axlDestroyFunc  native_destroy)
+{
+	XmlRpcMethodResponse * response;
+
+	response = axl_new (XmlRpcMethodResponse, 1);
+	if (response == NULL) {
+		if (native != NULL && native_destroy != NULL)
+			native_destroy (native);
+		return NULL;
+	} /* end if */
+	response->status         = XML_RPC_OK;
+	response->native         = native;
+	response->native_destroy = native_destroy;
+
+	return response;
+}
+
+/** 
+ * @brief Returns the native value hold by the response (see \ref
+ * vortex_xml_rpc_method_response_new_from_native). The value is
+ * still owned by the response: use \ref
+ * vortex_xml_rpc_method_response_nullify to take it.
+ * 
+ * @param response The response to check.
+ * 
+ * @return The native value or NULL.
+ */
+axlPointer             vortex_xml_rpc_method_response_get_native (XmlRpcMethodResponse * response)
+{
+	v_return_val_if_fail (response, NULL);
+
+	return response->native;
+}
+
 /** 
  * @brief Creates a new positive \ref XmlRpcMethodResponse object,
  * inserting a \ref XmlRpcMethodValue instance created by providing
@@ -2091,6 +2695,10 @@ void vortex_xml_rpc_method_response_free (XmlRpcMethodResponse * response)
 
 	if (response->fault_string != NULL)
 		axl_free (response->fault_string);
+
+	vortex_xml_rpc_writer_free (response->writer);
+	if (response->native != NULL && response->native_destroy != NULL)
+		response->native_destroy (response->native);
 	
 	/* deallocates the node itself */
 	axl_free (response);
@@ -2128,7 +2736,8 @@ void                   vortex_xml_rpc_method_response_nullify          (XmlRpcMe
 	v_return_if_fail (response);
 	
 	/* nullify  */
-	response->value = NULL;
+	response->value  = NULL;
+	response->native = NULL;
 
 	return;
 }
@@ -2146,84 +2755,71 @@ void                   vortex_xml_rpc_method_response_nullify          (XmlRpcMe
 char                 * vortex_xml_rpc_method_response_marshall         (XmlRpcMethodResponse * response,
 									int                  * size)
 {
-	char  * result     = NULL;
-	char  * string_aux = NULL;
+	XmlRpcMarshallBuffer buffer;
+	axl_bool             status;
+	char                 number[64];
+	int                  length;
 	
 	/* check received method response */
 	v_return_val_if_fail (response, NULL);
 
 	switch (response->status) {
 	case XML_RPC_OK:
+		/* reply value already marshalled */
+		if (response->writer != NULL) {
+			if (response->writer->failed || ! __vortex_xml_rpc_buffer_init (&buffer, response->writer->buffer.size + 128))
+				return NULL;
+			status = __vortex_xml_rpc_buffer_append_str (&buffer, "<?xml version=\"1.0\"?><methodResponse><params><param>") &&
+				__vortex_xml_rpc_buffer_append (&buffer, response->writer->buffer.content, response->writer->buffer.size) &&
+				__vortex_xml_rpc_buffer_append_str (&buffer, "</param></params></methodResponse>");
+			break;
+		} /* end if */
+
 		/* check that the XmlRpcMethodValue is defined */
 		v_return_val_if_fail (response->value, NULL);
 		switch (response->value->type) {
 		case XML_RPC_INT_VALUE:
-			/* implement the int value */
-			result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value><i4>%d</i4></value></param></params></methodResponse>",
-						    response->value->value.int_value);
-			break;
 		case XML_RPC_BOOLEAN_VALUE:
-			/* implement the boolean value */
-			result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value><boolean>%d</boolean></value></param></params></methodResponse>",
-						    response->value->value.int_value);
-			
-			break;
 		case XML_RPC_DOUBLE_VALUE:
-			/* implement the double value */
-			result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value><double>%g</double></value></param></params></methodResponse>",
-						    response->value->value.double_value);
-			break;
 		case XML_RPC_STRING_VALUE:
 		case XML_RPC_STRING_REF_VALUE:
-			/* implement the string value */
-			result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value><string><![CDATA[%s]]></string></value></param></params></methodResponse>",
-						    response->value->value.string_value);
-			break;
-		case XML_RPC_DATE_VALUE:
-			/* the already not implemented */
-			break;
 		case XML_RPC_BASE64_VALUE:
 		case XML_RPC_BASE64_REF_VALUE:
-			/* implemented as string, by performing the
-			 * translation automatically */
-			result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value><base64>%s</base64></value></param></params></methodResponse>",
-						    response->value->value.string_value);
-			break;
 		case XML_RPC_STRUCT_VALUE:
-			/* marshall the struct */
-			string_aux = vortex_xml_rpc_types_marshall_struct (response->value->value.rpc_struct);
-			result     = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value>%s</value></param></params></methodResponse>",
-							string_aux);
-			axl_free (string_aux);
-			break;
 		case XML_RPC_ARRAY_VALUE:
-			/* marshall the array received */
-			string_aux = vortex_xml_rpc_types_marshall_array (response->value->value.rpc_array);
-			result     = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><params><param><value>%s</value></param></params></methodResponse>",
-						      string_aux);
-			axl_free (string_aux);
+			/* supported reply values */
 			break;
 		default:
-			/* nothing to do, seems an error */
+			/* nothing to do, seems an error (date values
+			 * are not implemented yet) */
 			return NULL;
-			   
 		}
+
+		if (! __vortex_xml_rpc_buffer_init (&buffer, 256))
+			return NULL;
+
+		status = __vortex_xml_rpc_buffer_append_str (&buffer, "<?xml version=\"1.0\"?><methodResponse><params><param>") &&
+			__vortex_xml_rpc_marshall_value_to (&buffer, response->value) &&
+			__vortex_xml_rpc_buffer_append_str (&buffer, "</param></params></methodResponse>");
 		/* reply generated */
 		break;
 	default:
 		/* generate a error reply */
-		result = axl_strdup_printf ("<?xml version=\"1.0\"?><methodResponse><fault><value><struct><member><name>faultCode</name><value><int>%d</int></value></member><member><name>faultString</name><value><string><![CDATA[%s]]></string></value></member></struct></value></fault></methodResponse>",
-					    response->fault_code, response->fault_string);
+		if (! __vortex_xml_rpc_buffer_init (&buffer, 512))
+			return NULL;
+
+		length = snprintf (number, sizeof (number), "%d", response->fault_code);
+		status = __vortex_xml_rpc_buffer_append_str (&buffer, "<?xml version=\"1.0\"?><methodResponse><fault><value><struct><member><name>faultCode</name><value><int>") &&
+			__vortex_xml_rpc_buffer_append (&buffer, number, length) &&
+			__vortex_xml_rpc_buffer_append_str (&buffer, "</int></value></member><member><name>faultString</name><value><string>") &&
+			__vortex_xml_rpc_buffer_append_cdata (&buffer, response->fault_string) &&
+			__vortex_xml_rpc_buffer_append_str (&buffer, "</string></value></member></struct></value></fault></methodResponse>");
 		/* negative replies */
 		break;
 	}
 	
-	/* get size for the xml content generated */
-	if (result != NULL && size != NULL)
-		(* size ) = strlen (result);
-	
-	/* return what we have generated */
-	return result;
+	/* return what we have generated, setting size from the buffer */
+	return __vortex_xml_rpc_buffer_finish (&buffer, status, size);
 }
 
 /** 
@@ -2605,6 +3201,8 @@ XmlRpcStructMember   * vortex_xml_rpc_struct_member_new                (const ch
 void                   vortex_xml_rpc_struct_add_member                (XmlRpcStruct * _struct, 
 									XmlRpcStructMember * member)
 {
+	int iterator;
+
 	/* some environment checks */
 	v_return_if_fail (_struct);
 	v_return_if_fail (member);
@@ -2615,6 +3213,21 @@ void                   vortex_xml_rpc_struct_add_member                (XmlRpcSt
 
 	/* increase the cound */
 	_struct->added_count++;
+
+	/* keep the member index updated, building it once the
+	 * threshold is reached */
+	if (_struct->index != NULL) {
+		/* do not replace the first member with the same name,
+		 * scanning also returns the first one */
+		if (axl_hash_get (_struct->index, member->name) == NULL)
+			axl_hash_insert (_struct->index, member->name, member);
+	} else if (_struct->added_count >= XML_RPC_STRUCT_INDEX_THRESHOLD) {
+		_struct->index = axl_hash_new (axl_hash_string, axl_hash_equal_string);
+		for (iterator = 0; iterator < _struct->added_count; iterator++) {
+			if (axl_hash_get (_struct->index, _struct->members[iterator]->name) == NULL)
+				axl_hash_insert (_struct->index, _struct->members[iterator]->name, _struct->members[iterator]);
+		} /* end for */
+	} /* end if */
 	
 	/* job done */
 	return;
@@ -2635,6 +3248,10 @@ XmlRpcStructMember * __vortex_xml_rpc_struct_get_member_by_name (XmlRpcStruct *
 	v_return_val_if_fail (_struct, NULL);
 	v_return_val_if_fail (member_name, NULL);
 
+	/* use the member index if the struct is big enough to have one */
+	if (_struct->index != NULL)
+		return axl_hash_get (_struct->index, (axlPointer) member_name);
+
 	/* lookup for the member */
 	while (iterator < _struct->added_count) {
 		
@@ -2932,8 +3549,11 @@ void                    vortex_xml_rpc_struct_free                      (XmlRpcS
 		iterator++;
 	}
 
-	/* free the members array */
+	/* free the members array and its index (keys are owned by
+	 * the members) */
 	axl_free (_struct->members);
+	if (_struct->index != NULL)
+		axl_hash_free (_struct->index);
 	
 	/* release the memory hold by the struct itself */
 	axl_free (_struct);
@@ -429,6 +429,36 @@ typedef struct _XmlRpcStructMember    XmlRpcStructMember;
  */
 typedef struct _XmlRpcArray           XmlRpcArray;
 
+/** 
+ * @brief Writer used to marshall values directly into their XML-RPC
+ * representation without building \ref XmlRpcMethodValue trees.
+ *
+ * It is mainly used by code generated by xml-rpc-gen, which knows
+ * the value types in advance. See \ref vortex_xml_rpc_writer_new.
+ */
+typedef struct _XmlRpcWriter          XmlRpcWriter;
+
+/** 
+ * @brief Reader used to unmarshall XML-RPC values directly into
+ * native types without building \ref XmlRpcMethodValue trees.
+ *
+ * Readers are provided to \ref XmlRpcReplyReader handlers. See
+ * \ref vortex_xml_rpc_reader_int and related functions.
+ */
+typedef struct _XmlRpcReader          XmlRpcReader;
+
+/** 
+ * @brief Handler used to read a reply value straight into a native
+ * type (see \ref vortex_xml_rpc_method_call_set_reply_reader).
+ *
+ * @param reader The reader, placed before the <value> to read.
+ *
+ * @param result Reference where the native value is returned.
+ *
+ * @return axl_true if the value was read, otherwise axl_false.
+ */
+typedef axl_bool (*XmlRpcReplyReader) (XmlRpcReader * reader, axlPointer * result);
+
 /** 
  * @brief Alias definition for \ref vortex_xml_rpc_method_call_new
  */
@@ -615,6 +645,16 @@ void                vortex_xml_rpc_method_call_release_after_invoke (XmlRpcMetho
 
 axl_bool            vortex_xml_rpc_method_call_must_release (XmlRpcMethodCall * method_call);
 
+axl_bool            vortex_xml_rpc_method_call_set_writer   (XmlRpcMethodCall * method_call,
+							     XmlRpcWriter     * writer);
+
+void                vortex_xml_rpc_method_call_set_reply_reader (XmlRpcMethodCall  * method_call,
+								 XmlRpcReplyReader   reader,
+								 axlDestroyFunc      destroy);
+
+XmlRpcReplyReader   vortex_xml_rpc_method_call_get_reply_reader (XmlRpcMethodCall  * method_call,
+								 axlDestroyFunc    * destroy);
+
 axl_bool            vortex_xml_rpc_method_call_is           (XmlRpcMethodCall * method_call, 
 							     const char       * method_name,
 							     int                param_num,
@@ -827,6 +867,13 @@ XmlRpcMethodResponse * vortex_xml_rpc_method_response_create           (VortexCt
 									XmlRpcParamType       type,
 									axlPointer            value);
 
+XmlRpcMethodResponse * vortex_xml_rpc_method_response_new_from_writer  (XmlRpcWriter        * writer);
+
+XmlRpcMethodResponse * vortex_xml_rpc_method_response_new_from_native  (axlPointer            native,
+									axlDestroyFunc        native_destroy);
+
+axlPointer             vortex_xml_rpc_method_response_get_native       (XmlRpcMethodResponse * response);
+
 void                   vortex_xml_rpc_method_response_free             (XmlRpcMethodResponse * response);
 
 void                   vortex_xml_rpc_method_response_nullify          (XmlRpcMethodResponse * response);
@@ -920,6 +967,44 @@ void                   vortex_xml_rpc_array_set                        (XmlRpcAr
 void                   vortex_xml_rpc_array_add                        (XmlRpcArray * array,
 									XmlRpcMethodValue * value);
 
+/* 
+ * The following header definitions comes to allow marshalling values
+ * directly through a \ref XmlRpcWriter.
+ */
+XmlRpcWriter         * vortex_xml_rpc_writer_new                       (int  size_hint);
+
+void                   vortex_xml_rpc_writer_int                       (XmlRpcWriter * writer, int  value);
+
+void                   vortex_xml_rpc_writer_boolean                   (XmlRpcWriter * writer, axl_bool  value);
+
+void                   vortex_xml_rpc_writer_double                    (XmlRpcWriter * writer, double  value);
+
+void                   vortex_xml_rpc_writer_string                    (XmlRpcWriter * writer, const char * value);
+
+void                   vortex_xml_rpc_writer_base64                    (XmlRpcWriter * writer, const char * value);
+
+void                   vortex_xml_rpc_writer_none                      (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_value                     (XmlRpcWriter * writer, XmlRpcMethodValue * value);
+
+void                   vortex_xml_rpc_writer_struct_open               (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_member                    (XmlRpcWriter * writer, const char * name);
+
+void                   vortex_xml_rpc_writer_member_close              (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_struct_close              (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_array_open                (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_array_close               (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_param_open                (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_param_close               (XmlRpcWriter * writer);
+
+void                   vortex_xml_rpc_writer_free                      (XmlRpcWriter * writer);
+
 /** 
  * @brief Perform an error reply inside a XML-RPC server stub
  * implementation.